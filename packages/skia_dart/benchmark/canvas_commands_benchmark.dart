@@ -0,0 +1,90 @@
+// Compares drawing many small primitives with one FFI call per command
+// against recording them into an SkCanvasCommandBuffer and executing the
+// whole batch with a single call.
+//
+// Run with: dart run benchmark/canvas_commands_benchmark.dart
+
+import 'package:skia_dart/skia_dart.dart';
+
+const _width = 512;
+const _height = 512;
+const _commandsPerFrame = 10000;
+const _frames = 50;
+
+void _drawDirect(SkCanvas canvas, SkPaint paint) {
+  for (var i = 0; i < _commandsPerFrame; i++) {
+    final x = (i * 7 % _width).toDouble();
+    final y = (i * 13 % _height).toDouble();
+    canvas.save();
+    canvas.translate(x, y);
+    canvas.drawRect(SkRect.fromLTRB(0, 0, 4, 4), paint);
+    canvas.restore();
+  }
+}
+
+void _drawBatched(
+  SkCanvas canvas,
+  SkCanvasCommandBuffer commands,
+  SkPaint paint,
+) {
+  commands.reset();
+  for (var i = 0; i < _commandsPerFrame; i++) {
+    final x = (i * 7 % _width).toDouble();
+    final y = (i * 13 % _height).toDouble();
+    commands.save();
+    commands.translate(x, y);
+    commands.drawRect(SkRect.fromLTRB(0, 0, 4, 4), paint);
+    commands.restore();
+  }
+  canvas.executeCommands(commands);
+}
+
+Duration _measure(void Function() frame) {
+  // Warm up.
+  for (var i = 0; i < 5; i++) {
+    frame();
+  }
+  final stopwatch = Stopwatch()..start();
+  for (var i = 0; i < _frames; i++) {
+    frame();
+  }
+  return stopwatch.elapsed;
+}
+
+void _report(String name, Duration elapsed) {
+  final commands = _frames * _commandsPerFrame * 4;
+  final perCommandNs = elapsed.inMicroseconds * 1000 / commands;
+  final perFrameMs = elapsed.inMicroseconds / 1000 / _frames;
+  print(
+    '$name: ${perFrameMs.toStringAsFixed(2)} ms/frame, '
+    '${perCommandNs.toStringAsFixed(1)} ns/command',
+  );
+}
+
+void main() {
+  SkAutoDisposeScope.run(() {
+    final surface = SkSurface.raster(
+      SkImageInfo(
+        width: _width,
+        height: _height,
+        colorType: SkColorType.rgba8888,
+        alphaType: SkAlphaType.premul,
+      ),
+    )!;
+    final canvas = surface.canvas;
+    final paint = SkPaint()..color = SkColor(0xFF3366CC);
+    final commands = SkCanvasCommandBuffer(
+      initialCapacity: _commandsPerFrame * 4 * 12,
+    );
+
+    final direct = _measure(() => _drawDirect(canvas, paint));
+    final batched = _measure(() => _drawBatched(canvas, commands, paint));
+
+    _report('direct ', direct);
+    _report('batched', batched);
+    print(
+      'speedup: '
+      '${(direct.inMicroseconds / batched.inMicroseconds).toStringAsFixed(2)}x',
+    );
+  });
+}
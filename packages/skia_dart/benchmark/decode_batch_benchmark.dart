@@ -0,0 +1,108 @@
+// Measures how SkCodec.decodeBatch scales with the number of threads when
+// decoding a corpus of JPEG, PNG and WebP images into thumbnails.
+//
+// Run with: dart run benchmark/decode_batch_benchmark.dart
+
+import 'dart:io';
+import 'dart:math' as math;
+
+import 'package:skia_dart/skia_dart.dart';
+
+const _width = 1024;
+const _height = 768;
+const _imagesPerFormat = 32;
+const _thumbnailWidth = 160;
+const _iterations = 5;
+
+SkPixmap _renderSource(SkSurface surface, int seed) {
+  final random = math.Random(seed);
+  final canvas = surface.canvas;
+  final paint = SkPaint();
+  canvas.clear(SkColor(0xFFFFFFFF));
+  for (var i = 0; i < 200; i++) {
+    paint.color = SkColor(0xFF000000 | random.nextInt(0xFFFFFF));
+    canvas.drawCircle(
+      random.nextDouble() * _width,
+      random.nextDouble() * _height,
+      10 + random.nextDouble() * 90,
+      paint,
+    );
+  }
+  final pixmap = SkPixmap();
+  surface.peekPixels(pixmap);
+  return pixmap;
+}
+
+List<SkData> _buildCorpus() {
+  final surface = SkSurface.raster(
+    SkImageInfo(
+      width: _width,
+      height: _height,
+      colorType: SkColorType.rgba8888,
+      alphaType: SkAlphaType.premul,
+    ),
+  )!;
+  final corpus = <SkData>[];
+  for (var i = 0; i < _imagesPerFormat; i++) {
+    final pixmap = _renderSource(surface, i);
+    for (final encode in [
+      (SkWStream s) => SkJpegEncoder.encode(s, pixmap),
+      (SkWStream s) => SkPngEncoder.encode(s, pixmap),
+      (SkWStream s) => SkWebPEncoder.encode(s, pixmap),
+    ]) {
+      final stream = SkDynamicMemoryWStream();
+      if (!encode(stream)) {
+        throw StateError('Failed to encode benchmark image');
+      }
+      corpus.add(stream.detachAsData());
+    }
+  }
+  return corpus;
+}
+
+Duration _measure(List<SkCodecDecodeRequest> requests, int threads) {
+  final stopwatch = Stopwatch();
+  for (var i = 0; i < _iterations + 1; i++) {
+    // The first iteration warms up.
+    if (i == 1) {
+      stopwatch.start();
+    }
+    SkAutoDisposeScope.run(() {
+      for (final result in SkCodec.decodeBatch(
+        requests,
+        maxThreads: threads,
+      )) {
+        if (result.result != SkCodecResult.success) {
+          throw StateError('Decoding failed: ${result.result}');
+        }
+      }
+    });
+  }
+  return stopwatch.elapsed ~/ _iterations;
+}
+
+void main() {
+  SkAutoDisposeScope.run(() {
+    final corpus = _buildCorpus();
+    final requests = [
+      for (final data in corpus)
+        SkCodecDecodeRequest(data, width: _thumbnailWidth),
+    ];
+
+    final baseline = _measure(requests, 1);
+    for (
+      var threads = 1;
+      threads <= Platform.numberOfProcessors;
+      threads *= 2
+    ) {
+      final elapsed = threads == 1 ? baseline : _measure(requests, threads);
+      final perImageUs = elapsed.inMicroseconds / requests.length;
+      final speedup = baseline.inMicroseconds / elapsed.inMicroseconds;
+      print(
+        '$threads thread(s): ${elapsed.inMilliseconds} ms/batch, '
+        '${perImageUs.toStringAsFixed(0)} us/image, '
+        '${speedup.toStringAsFixed(2)}x',
+      );
+    }
+  });
+}
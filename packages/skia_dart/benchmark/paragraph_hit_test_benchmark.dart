@@ -0,0 +1,111 @@
+// Measures glyph position lookups on a 10k-line paragraph with and without the
+// hit-test index, one query per call and in batches, and checks that both
+// give the same positions. Lines end in hard breaks and are laid out without
+// wrapping, where the index matches the linear lookup exactly.
+//
+// Run with: dart run benchmark/paragraph_hit_test_benchmark.dart
+
+import 'dart:io';
+import 'dart:math' as math;
+
+import 'package:skia_dart/skia_dart.dart';
+
+import '../test/icu.dart';
+
+const _fontPath = 'test/NotoSans-ASCII.ttf';
+const _lineCount = 10000;
+const _queryCount = 2000;
+const _width = 10000.0;
+
+String _buildText() {
+  final random = math.Random(11);
+  const words = ['hit', 'test', 'glyph', 'cluster', 'line', 'the', 'of', 'a'];
+  return List.generate(
+    _lineCount,
+    (_) => List.generate(
+      4 + random.nextInt(8),
+      (_) => words[random.nextInt(words.length)],
+    ).join(' '),
+  ).join('\n');
+}
+
+List<SkPoint> _buildPoints(SkParagraph paragraph) {
+  final random = math.Random(3);
+  return List.generate(
+    _queryCount,
+    (_) => SkPoint(
+      random.nextDouble() * paragraph.longestLine,
+      random.nextDouble() * paragraph.height,
+    ),
+  );
+}
+
+Duration _time(void Function() body) {
+  final stopwatch = Stopwatch()..start();
+  body();
+  return stopwatch.elapsed;
+}
+
+void main() {
+  loadIcuData();
+  SkAutoDisposeScope.run(() {
+    final unicode =
+        SkUnicode.icu() ?? SkUnicode.icu4x() ?? SkUnicode.libgrapheme();
+    if (unicode == null) {
+      stderr.writeln('No SkUnicode implementation available.');
+      exitCode = 1;
+      return;
+    }
+    final fontMgr = SkFontMgr.createPlatformDefault()!;
+    final typeface = fontMgr.createFromFile(_fontPath)!;
+    final fontCollection = SkFontCollection()
+      ..setDefaultFontManagerWithFamilyNames(fontMgr, [typeface.familyName]);
+    final style = SkTextStyle()
+      ..typeface = typeface
+      ..fontSize = 14;
+    final builder = SkParagraphBuilder(
+      style: SkParagraphStyle(),
+      fontCollection: fontCollection,
+      unicode: unicode,
+    )..pushStyle(style)..addText(_buildText());
+    final paragraph = builder.build()..layout(_width);
+    final points = _buildPoints(paragraph);
+
+    List<SkParagraphPositionWithAffinity> single() => [
+      for (final point in points)
+        paragraph.getGlyphPositionAtCoordinate(point.x, point.y),
+    ];
+
+    final linear = single();
+    final linearSingle = _time(single);
+    final linearBatch = _time(
+      () => paragraph.getGlyphPositionsAtCoordinates(points),
+    );
+
+    paragraph.hitTestIndexEnabled = true;
+    final build = _time(() => paragraph.getGlyphPositionAtCoordinate(0, 0));
+    final indexed = single();
+    for (var i = 0; i < points.length; i++) {
+      if (indexed[i] != linear[i]) {
+        throw StateError('Query $i differs from the linear lookup');
+      }
+    }
+    final indexedSingle = _time(single);
+    final indexedBatch = _time(
+      () => paragraph.getGlyphPositionsAtCoordinates(points),
+    );
+
+    String perQuery(Duration elapsed) =>
+        '${(elapsed.inMicroseconds / _queryCount).toStringAsFixed(2)} us/query';
+    print('${paragraph.lineNumber} lines');
+    print(
+      'linear:  ${perQuery(linearSingle)}, '
+      'batched ${perQuery(linearBatch)}',
+    );
+    print(
+      'indexed: ${perQuery(indexedSingle)}, '
+      'batched ${perQuery(indexedBatch)}, '
+      'built in ${build.inMilliseconds} ms',
+    );
+  });
+}
@@ -0,0 +1,146 @@
+// Measures how SkParagraph.layoutBatch scales with the number of threads when
+// laying out a page worth of independent paragraphs that share one font
+// collection, and checks that every thread count gives the serial result.
+//
+// Run with: dart run benchmark/paragraph_layout_batch_benchmark.dart
+
+import 'dart:io';
+import 'dart:math' as math;
+
+import 'package:skia_dart/skia_dart.dart';
+
+import '../test/icu.dart';
+
+const _fontPath = 'test/NotoSans-ASCII.ttf';
+const _paragraphCount = 400;
+const _iterations = 5;
+
+const _vocabulary =
+    'layout paragraph shaping glyph cluster baseline font the of and a to in '
+    'is that with for on';
+final _words = _vocabulary.split(' ');
+
+List<String> _buildTexts() {
+  final random = math.Random(7);
+  return List.generate(_paragraphCount, (_) {
+    final length = 20 + random.nextInt(120);
+    return List.generate(
+      length,
+      (_) => _words[random.nextInt(_words.length)],
+    ).join(' ');
+  });
+}
+
+List<SkParagraph> _buildParagraphs(
+  List<String> texts,
+  SkFontCollection fontCollection,
+  SkTypeface typeface,
+  SkUnicode unicode,
+) {
+  final style = SkTextStyle()
+    ..typeface = typeface
+    ..fontSize = 14;
+  final paragraphStyle = SkParagraphStyle();
+  return [
+    for (final text in texts)
+      (SkParagraphBuilder(
+        style: paragraphStyle,
+        fontCollection: fontCollection,
+        unicode: unicode,
+      )..pushStyle(style)..addText(text)).build(),
+  ];
+}
+
+List<double> _widths() => [
+  for (var i = 0; i < _paragraphCount; i++) 200.0 + 40 * (i % 8),
+];
+
+List<double> _heights(List<SkParagraph> paragraphs) => [
+  for (final paragraph in paragraphs) paragraph.height,
+];
+
+void main() {
+  loadIcuData();
+  SkAutoDisposeScope.run(() {
+    final unicode =
+        SkUnicode.icu() ?? SkUnicode.icu4x() ?? SkUnicode.libgrapheme();
+    if (unicode == null) {
+      stderr.writeln('No SkUnicode implementation available.');
+      exitCode = 1;
+      return;
+    }
+    final fontMgr = SkFontMgr.createPlatformDefault()!;
+    final typeface = fontMgr.createFromFile(_fontPath)!;
+    SkFontCollection createFontCollection() => SkFontCollection()
+      ..setDefaultFontManagerWithFamilyNames(fontMgr, [typeface.familyName]);
+    final fontCollection = createFontCollection();
+
+    final texts = _buildTexts();
+    final widths = _widths();
+
+    // Skia caches shaping results per font collection, so every layout below
+    // uses text that has not been shaped before: each run is tagged.
+    var run = 0;
+    List<SkParagraph> build([SkFontCollection? collection]) {
+      final tag = 'run${run++}';
+      return _buildParagraphs(
+        [for (final text in texts) '$tag $text'],
+        collection ?? fontCollection,
+        typeface,
+        unicode,
+      );
+    }
+
+    // The serial reference uses its own font collection so that it does not
+    // reuse shaping results of the batch.
+    void check(int threads) {
+      final paragraphs = build();
+      run--;
+      final reference = build(createFontCollection());
+      SkParagraph.layoutBatch(paragraphs, widths, maxThreads: threads);
+      for (var i = 0; i < reference.length; i++) {
+        reference[i].layout(widths[i]);
+      }
+      final actual = _heights(paragraphs);
+      final expected = _heights(reference);
+      for (var i = 0; i < actual.length; i++) {
+        if (actual[i] != expected[i]) {
+          throw StateError('Paragraph $i differs from serial layout');
+        }
+      }
+    }
+
+    Duration measure(int threads) {
+      SkAutoDisposeScope.run(() => check(threads));
+      final stopwatch = Stopwatch();
+      for (var i = 0; i < _iterations + 1; i++) {
+        SkAutoDisposeScope.run(() {
+          final paragraphs = build();
+          // The first iteration warms up.
+          if (i > 0) {
+            stopwatch.start();
+          }
+          SkParagraph.layoutBatch(paragraphs, widths, maxThreads: threads);
+          stopwatch.stop();
+        });
+      }
+      return stopwatch.elapsed ~/ _iterations;
+    }
+
+    final baseline = measure(1);
+    for (
+      var threads = 1;
+      threads <= Platform.numberOfProcessors;
+      threads *= 2
+    ) {
+      final elapsed = threads == 1 ? baseline : measure(threads);
+      final perParagraphUs = elapsed.inMicroseconds / _paragraphCount;
+      final speedup = baseline.inMicroseconds / elapsed.inMicroseconds;
+      print(
+        '$threads thread(s): ${elapsed.inMilliseconds} ms/page, '
+        '${perParagraphUs.toStringAsFixed(1)} us/paragraph, '
+        '${speedup.toStringAsFixed(2)}x',
+      );
+    }
+  });
+}
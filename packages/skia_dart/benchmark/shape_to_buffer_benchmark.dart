@@ -0,0 +1,156 @@
+// Measures shaping a batch of short strings through a Dart run handler, which
+// is called back for every line and run, and with a single shapeToBuffer
+// call, and checks that both produce the same glyphs.
+//
+// Run with: dart run benchmark/shape_to_buffer_benchmark.dart
+
+import 'dart:ffi';
+import 'dart:io';
+import 'dart:math' as math;
+
+import 'package:ffi/ffi.dart' as ffi;
+import 'package:skia_dart/skia_dart.dart';
+
+import '../test/icu.dart';
+
+const _fontPath = 'test/NotoSans-ASCII.ttf';
+const _textCount = 2000;
+const _iterations = 5;
+
+class _CollectingRunHandler extends SkShaperRunHandler {
+  final List<int> glyphs = [];
+
+  Pointer<Uint16> _glyphs = nullptr;
+  Pointer<SkShaperRunBufferPoint> _positions = nullptr;
+  int _capacity = 0;
+  int _count = 0;
+
+  @override
+  void beginLine() {}
+
+  @override
+  void runInfo(SkShaperRunInfo info) {}
+
+  @override
+  void commitRunInfo() {}
+
+  @override
+  SkShaperRunBuffer runBuffer(SkShaperRunInfo info) {
+    if (info.glyphCount > _capacity) {
+      _free();
+      _capacity = info.glyphCount;
+      _glyphs = ffi.malloc<Uint16>(_capacity);
+      _positions = ffi.malloc<SkShaperRunBufferPoint>(_capacity);
+    }
+    _count = info.glyphCount;
+    return SkShaperRunBuffer(
+      glyphs: _glyphs,
+      positions: _positions,
+      point: SkPoint(0, 0),
+    );
+  }
+
+  @override
+  void commitRunBuffer(SkShaperRunInfo info) {
+    glyphs.addAll(_glyphs.asTypedList(_count));
+  }
+
+  @override
+  void commitLine() {}
+
+  void _free() {
+    if (_glyphs != nullptr) {
+      ffi.malloc.free(_glyphs);
+      ffi.malloc.free(_positions);
+    }
+  }
+
+  @override
+  void dispose() {
+    _free();
+    _glyphs = nullptr;
+    _positions = nullptr;
+    _capacity = 0;
+    super.dispose();
+  }
+}
+
+List<String> _buildTexts() {
+  final random = math.Random(5);
+  const words = ['shape', 'glyph', 'buffer', 'run', 'line', 'text', 'a', 'of'];
+  return List.generate(
+    _textCount,
+    (_) => List.generate(
+      2 + random.nextInt(6),
+      (_) => words[random.nextInt(words.length)],
+    ).join(' '),
+  );
+}
+
+Duration _best(void Function() body) {
+  var best = const Duration(days: 1);
+  for (var i = 0; i < _iterations; i++) {
+    final stopwatch = Stopwatch()..start();
+    body();
+    if (stopwatch.elapsed < best) best = stopwatch.elapsed;
+  }
+  return best;
+}
+
+void main() {
+  loadIcuData();
+  SkAutoDisposeScope.run(() {
+    final unicode = SkUnicode.icu();
+    final shaper = unicode == null
+        ? null
+        : SkShaper.harfbuzzShapeThenWrap(unicode);
+    if (unicode == null || shaper == null) {
+      stderr.writeln('HarfBuzz shaping with ICU is not available.');
+      exitCode = 1;
+      return;
+    }
+    final fontMgr = SkFontMgr.createPlatformDefault()!;
+    final typeface = fontMgr.createFromFile(_fontPath)!;
+    final font = SkFont(typeface: typeface, size: 14);
+    final texts = _buildTexts();
+
+    List<int> callbacks() {
+      final handler = _CollectingRunHandler();
+      for (final text in texts) {
+        shaper.shape(
+          text,
+          fontIterator: SkFontRunIterator(text, font, fallback: fontMgr),
+          bidiIterator: SkBiDiRunIterator.unicode(unicode, text)!,
+          scriptIterator: SkScriptRunIterator.harfBuzz(text)!,
+          languageIterator: SkLanguageRunIterator(text),
+          width: double.infinity,
+          handler: handler,
+        );
+      }
+      return handler.glyphs;
+    }
+
+    final buffer = SkShaperBuffer();
+    final batch = [for (final text in texts) SkShaperText(text, font: font)];
+    void buffered() => shaper.shapeToBuffer(batch, buffer);
+
+    final expected = callbacks();
+    buffered();
+    if (buffer.glyphs.length != expected.length) {
+      throw StateError('Glyph counts differ');
+    }
+    for (var i = 0; i < expected.length; i++) {
+      if (buffer.glyphs[i] != expected[i]) {
+        throw StateError('Glyph $i differs');
+      }
+    }
+
+    final callbackTime = _best(callbacks);
+    final bufferTime = _best(buffered);
+    String perText(Duration elapsed) =>
+        '${(elapsed.inMicroseconds / _textCount).toStringAsFixed(2)} us/text';
+    print('$_textCount texts, ${expected.length} glyphs');
+    print('run handler:   ${perText(callbackTime)}');
+    print('shapeToBuffer: ${perText(bufferTime)}');
+  });
+}
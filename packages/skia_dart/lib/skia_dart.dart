@@ -1 +1 @@
-export 'src/skia_dart_library.dart' hide RunLoop;
\ No newline at end of file
+export 'src/skia_dart_library.dart' hide AsyncTask, RunLoop;
\ No newline at end of file
@@ -0,0 +1,148 @@
+part of 'skia_dart_library.dart';
+
+/// Counters for work running on the shared native worker pool.
+///
+/// Durations are summed over all tasks whose work has started since the
+/// counters were last reset with [SkAsync.resetStats].
+class SkAsyncStats {
+  const SkAsyncStats({
+    required this.submitted,
+    required this.completed,
+    required this.cancelled,
+    required this.queueDepth,
+    required this.running,
+    required this.totalQueueTime,
+    required this.maxQueueTime,
+    required this.totalRunTime,
+  });
+
+  final int submitted;
+  final int completed;
+  final int cancelled;
+
+  /// Number of tasks currently waiting for a worker thread.
+  final int queueDepth;
+
+  /// Number of tasks currently running.
+  final int running;
+
+  /// Time tasks spent waiting for a worker thread.
+  final Duration totalQueueTime;
+  final Duration maxQueueTime;
+
+  /// Time spent running the work of tasks.
+  final Duration totalRunTime;
+
+  Duration get averageQueueTime => completed == 0
+      ? Duration.zero
+      : Duration(microseconds: totalQueueTime.inMicroseconds ~/ completed);
+
+  Duration get averageRunTime => completed == 0
+      ? Duration.zero
+      : Duration(microseconds: totalRunTime.inMicroseconds ~/ completed);
+
+  @override
+  String toString() =>
+      'SkAsyncStats(submitted: $submitted, completed: $completed, '
+      'cancelled: $cancelled, queueDepth: $queueDepth, running: $running, '
+      'averageQueueTime: $averageQueueTime, maxQueueTime: $maxQueueTime, '
+      'averageRunTime: $averageRunTime)';
+}
+
+/// The shared native worker pool used by asynchronous operations such as
+/// decoding and encoding.
+abstract final class SkAsync {
+  static int get threadCount => sk_async_get_thread_count();
+
+  static SkAsyncStats get stats {
+    final ptr = _statsPtr;
+    sk_async_get_stats(ptr);
+    final stats = ptr.ref;
+    return SkAsyncStats(
+      submitted: stats.submitted,
+      completed: stats.completed,
+      cancelled: stats.cancelled,
+      queueDepth: stats.queue_depth,
+      running: stats.running,
+      totalQueueTime: _duration(stats.total_queue_ns),
+      maxQueueTime: _duration(stats.max_queue_ns),
+      totalRunTime: _duration(stats.total_run_ns),
+    );
+  }
+
+  /// Resets the cumulative counters. [SkAsyncStats.queueDepth] and
+  /// [SkAsyncStats.running] describe the current state and are kept.
+  static void resetStats() {
+    sk_async_reset_stats();
+  }
+
+  static Duration _duration(int nanoseconds) =>
+      Duration(microseconds: nanoseconds ~/ 1000);
+
+  static final _statsPtr = ffi.calloc<sk_async_stats_t>();
+}
+
+/// A native task running on the shared worker pool.
+///
+/// [submit] starts the native work and must pass the given completion through
+/// to `sk_async_submit`. The completion arrives through the [RunLoop] of this
+/// isolate, after which [done] completes with `true` if the work ran or
+/// `false` if it was cancelled before starting. If [submit] returns null
+/// instead of a task, [submitted] is false and [done] completes with `false`.
+class AsyncTask {
+  AsyncTask(
+    Pointer<sk_async_task_t> Function(
+      int isolateHandle,
+      sk_async_completion_proc completion,
+    )
+    submit,
+  ) {
+    _completion = NativeCallable<sk_async_completion_procFunction>.isolateLocal(
+      _onComplete,
+    );
+    _ptr = submit(RunLoop.instance.handle, _completion.nativeFunction);
+    submitted = _ptr != nullptr;
+    if (!submitted) {
+      // Nothing will ever call the completion.
+      _completion.close();
+      _completer.complete(false);
+    }
+  }
+
+  /// A task without work, which completes once a worker thread picks it up.
+  @visibleForTesting
+  AsyncTask.empty()
+    : this(
+        (handle, completion) =>
+            sk_async_submit(handle, nullptr, completion, nullptr),
+      );
+
+  late final NativeCallable<sk_async_completion_procFunction> _completion;
+  late Pointer<sk_async_task_t> _ptr;
+  final _completer = Completer<bool>();
+
+  /// Whether the native side accepted the task.
+  late final bool submitted;
+
+  Future<bool> get done => _completer.future;
+
+  /// Cancels the task if its work has not started yet. Running work may
+  /// still notice the request and stop early.
+  ///
+  /// Returns `true` if the work will not run.
+  bool cancel() {
+    if (_ptr == nullptr) {
+      return false;
+    }
+    return sk_async_cancel(_ptr);
+  }
+
+  void _onComplete(Pointer<sk_async_task_t> task, Pointer<Void> context) {
+    final status = sk_async_get_status(task);
+    sk_async_task_unref(_ptr);
+    _ptr = nullptr;
+    // The callable is still on the stack here.
+    scheduleMicrotask(_completion.close);
+    _completer.complete(status == sk_async_status_t.COMPLETED_SK_ASYNC_STATUS);
+  }
+}
@@ -1458,6 +1458,29 @@ class SkCanvas with _NativeMixin<sk_canvas_t> {
     return SkSurface._(ptr);
   }
 
+  /// Executes all commands recorded in [commands] with a single native call.
+  ///
+  /// This is equivalent to calling the corresponding [SkCanvas] methods one by
+  /// one, but avoids crossing the FFI boundary for every command.
+  ///
+  /// Throws [StateError] if the native side rejects the command stream. Any
+  /// commands preceding the rejected one have already been executed.
+  void executeCommands(SkCanvasCommandBuffer commands) {
+    if (commands._length == SkCanvasCommandBuffer._headerLength) {
+      return;
+    }
+    final ok = sk_canvas_execute_commands(
+      _ptr,
+      commands._bytes.address,
+      commands._length,
+      commands._objectTable,
+      commands._objects.length,
+    );
+    if (!ok) {
+      throw StateError('Malformed canvas command stream.');
+    }
+  }
+
   static final _finalizer = _createFinalizer();
 
   static NativeFinalizer _createFinalizer() {
@@ -1466,3 +1489,751 @@ class SkCanvas with _NativeMixin<sk_canvas_t> {
     return NativeFinalizer(ptr.cast());
   }
 }
+
+/// Records canvas commands into a compact binary stream that can be executed
+/// by [SkCanvas.executeCommands] in a single native call.
+///
+/// Each [SkCanvas] method crosses the FFI boundary once. When a frame consists
+/// of thousands of small draws the per-call overhead can dominate; recording
+/// them into an [SkCanvasCommandBuffer] amortizes it over the whole batch.
+///
+/// Objects such as [SkPaint], [SkPath] or [SkImage] are referenced, not copied.
+/// They must not be modified or disposed until the buffer has been executed.
+/// Each distinct object is stored in the buffer's object table once, no matter
+/// how many commands refer to it.
+///
+/// Every [SkCanvas] method that draws or changes the matrix, clip or save
+/// stack has a counterpart here with the same arguments. Queries such as
+/// [SkCanvas.quickReject] do not, since their results would only be known
+/// once the buffer is executed.
+///
+/// A buffer can be executed any number of times. Call [reset] to reuse it for
+/// a new batch of commands.
+class SkCanvasCommandBuffer implements Finalizable {
+  SkCanvasCommandBuffer({int initialCapacity = 4096}) {
+    _bytes = Uint8List(math.max(initialCapacity, 64));
+    _data = ByteData.sublistView(_bytes);
+    _writeHeader();
+  }
+
+  /// Number of bytes currently recorded, including the stream header.
+  int get lengthInBytes => _length;
+
+  /// Number of distinct objects referenced by the recorded commands.
+  int get objectCount => _objects.length;
+
+  /// Whether no commands have been recorded since creation or the last
+  /// [reset].
+  bool get isEmpty => _length == _headerLength;
+
+  /// Removes all recorded commands and releases references to objects.
+  void reset() {
+    _length = 0;
+    _objects.clear();
+    _objectIndices.clear();
+    _writeHeader();
+  }
+
+  void save() {
+    _op(sk_canvas_command_t.SAVE_SK_CANVAS_COMMAND, 0);
+  }
+
+  void saveLayer({SkRect? bounds, SkPaint? paint}) {
+    _op(sk_canvas_command_t.SAVE_LAYER_SK_CANVAS_COMMAND, 6);
+    _u32((bounds != null ? 1 : 0) | (paint != null ? 2 : 0));
+    if (bounds != null) {
+      _rect(bounds);
+    }
+    if (paint != null) {
+      _object(paint);
+    }
+  }
+
+  void saveLayerRec(SkCanvasSaveLayerRec rec) {
+    final bounds = rec.bounds;
+    final paint = rec.paint;
+    final backdrop = rec.backdrop;
+    _op(sk_canvas_command_t.SAVE_LAYER_REC_SK_CANVAS_COMMAND, 8);
+    _u32(
+      (bounds != null ? 1 : 0) |
+          (paint != null ? 2 : 0) |
+          (backdrop != null ? 4 : 0),
+    );
+    if (bounds != null) {
+      _rect(bounds);
+    }
+    if (paint != null) {
+      _object(paint);
+    }
+    if (backdrop != null) {
+      _object(backdrop);
+    }
+    _u32(rec.flags);
+  }
+
+  void restore() {
+    _op(sk_canvas_command_t.RESTORE_SK_CANVAS_COMMAND, 0);
+  }
+
+  void restoreToCount(int saveCount) {
+    _op(sk_canvas_command_t.RESTORE_TO_COUNT_SK_CANVAS_COMMAND, 1);
+    _i32(saveCount);
+  }
+
+  void translate(double dx, double dy) {
+    _op(sk_canvas_command_t.TRANSLATE_SK_CANVAS_COMMAND, 2);
+    _f32(dx);
+    _f32(dy);
+  }
+
+  void scale(double sx, double sy) {
+    _op(sk_canvas_command_t.SCALE_SK_CANVAS_COMMAND, 2);
+    _f32(sx);
+    _f32(sy);
+  }
+
+  void rotate(double degrees) {
+    _op(sk_canvas_command_t.ROTATE_SK_CANVAS_COMMAND, 1);
+    _f32(degrees);
+  }
+
+  void rotateRadians(double radians) {
+    rotate(radians * 180.0 / math.pi);
+  }
+
+  void skew(double sx, double sy) {
+    _op(sk_canvas_command_t.SKEW_SK_CANVAS_COMMAND, 2);
+    _f32(sx);
+    _f32(sy);
+  }
+
+  void concat(Matrix4 matrix) {
+    _op(sk_canvas_command_t.CONCAT_SK_CANVAS_COMMAND, 16);
+    _matrix(matrix);
+  }
+
+  void setMatrix(Matrix4 matrix) {
+    _op(sk_canvas_command_t.SET_MATRIX_SK_CANVAS_COMMAND, 16);
+    _matrix(matrix);
+  }
+
+  void resetMatrix() {
+    _op(sk_canvas_command_t.RESET_MATRIX_SK_CANVAS_COMMAND, 0);
+  }
+
+  void clipRect(
+    SkRect rect, {
+    SkClipOp op = SkClipOp.intersect,
+    bool doAntiAlias = false,
+  }) {
+    _op(sk_canvas_command_t.CLIP_RECT_SK_CANVAS_COMMAND, 6);
+    _rect(rect);
+    _u32(op._value.value);
+    _u32(doAntiAlias ? 1 : 0);
+  }
+
+  void clipRRect(
+    SkRRect rect, {
+    SkClipOp op = SkClipOp.intersect,
+    bool doAntiAlias = false,
+  }) {
+    _op(sk_canvas_command_t.CLIP_RRECT_SK_CANVAS_COMMAND, 3);
+    _object(rect);
+    _u32(op._value.value);
+    _u32(doAntiAlias ? 1 : 0);
+  }
+
+  void clipPath(
+    SkPath path, {
+    SkClipOp op = SkClipOp.intersect,
+    bool doAntiAlias = false,
+  }) {
+    _op(sk_canvas_command_t.CLIP_PATH_SK_CANVAS_COMMAND, 3);
+    _object(path);
+    _u32(op._value.value);
+    _u32(doAntiAlias ? 1 : 0);
+  }
+
+  void clipRegion(SkRegion region, {SkClipOp op = SkClipOp.intersect}) {
+    _op(sk_canvas_command_t.CLIP_REGION_SK_CANVAS_COMMAND, 2);
+    _object(region);
+    _u32(op._value.value);
+  }
+
+  void discard() {
+    _op(sk_canvas_command_t.DISCARD_SK_CANVAS_COMMAND, 0);
+  }
+
+  void clear(SkColor color) {
+    _op(sk_canvas_command_t.CLEAR_SK_CANVAS_COMMAND, 1);
+    _u32(color.value);
+  }
+
+  void clearColor4f(SkColor4f color) {
+    _op(sk_canvas_command_t.CLEAR_COLOR4F_SK_CANVAS_COMMAND, 4);
+    _color4f(color);
+  }
+
+  void drawColor(SkColor color, SkBlendMode mode) {
+    _op(sk_canvas_command_t.DRAW_COLOR_SK_CANVAS_COMMAND, 2);
+    _u32(color.value);
+    _u32(mode._value.value);
+  }
+
+  void drawColor4f(SkColor4f color, SkBlendMode mode) {
+    _op(sk_canvas_command_t.DRAW_COLOR4F_SK_CANVAS_COMMAND, 5);
+    _color4f(color);
+    _u32(mode._value.value);
+  }
+
+  void drawPaint(SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_PAINT_SK_CANVAS_COMMAND, 1);
+    _object(paint);
+  }
+
+  void drawPoint(double x, double y, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_POINT_SK_CANVAS_COMMAND, 3);
+    _f32(x);
+    _f32(y);
+    _object(paint);
+  }
+
+  void drawPoints(SkPointMode mode, List<SkPoint> points, SkPaint paint) {
+    if (points.isEmpty) {
+      return;
+    }
+    _op(
+      sk_canvas_command_t.DRAW_POINTS_SK_CANVAS_COMMAND,
+      3 + points.length * 2,
+    );
+    _u32(mode._value.value);
+    _u32(points.length);
+    for (final point in points) {
+      _f32(point.x);
+      _f32(point.y);
+    }
+    _object(paint);
+  }
+
+  void drawLine(double x0, double y0, double x1, double y1, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_LINE_SK_CANVAS_COMMAND, 5);
+    _f32(x0);
+    _f32(y0);
+    _f32(x1);
+    _f32(y1);
+    _object(paint);
+  }
+
+  void drawRect(SkRect rect, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_RECT_SK_CANVAS_COMMAND, 5);
+    _rect(rect);
+    _object(paint);
+  }
+
+  void drawOval(SkRect rect, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_OVAL_SK_CANVAS_COMMAND, 5);
+    _rect(rect);
+    _object(paint);
+  }
+
+  void drawRoundRect(SkRect rect, double rx, double ry, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_ROUND_RECT_SK_CANVAS_COMMAND, 7);
+    _rect(rect);
+    _f32(rx);
+    _f32(ry);
+    _object(paint);
+  }
+
+  void drawRRect(SkRRect rect, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_RRECT_SK_CANVAS_COMMAND, 2);
+    _object(rect);
+    _object(paint);
+  }
+
+  void drawDRRect(SkRRect outer, SkRRect inner, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_DRRECT_SK_CANVAS_COMMAND, 3);
+    _object(outer);
+    _object(inner);
+    _object(paint);
+  }
+
+  void drawCircle(double cx, double cy, double rad, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_CIRCLE_SK_CANVAS_COMMAND, 4);
+    _f32(cx);
+    _f32(cy);
+    _f32(rad);
+    _object(paint);
+  }
+
+  void drawArc(
+    SkRect oval,
+    double startAngle,
+    double sweepAngle,
+    bool useCenter,
+    SkPaint paint,
+  ) {
+    _op(sk_canvas_command_t.DRAW_ARC_SK_CANVAS_COMMAND, 8);
+    _rect(oval);
+    _f32(startAngle);
+    _f32(sweepAngle);
+    _u32(useCenter ? 1 : 0);
+    _object(paint);
+  }
+
+  void drawPath(SkPath path, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_PATH_SK_CANVAS_COMMAND, 2);
+    _object(path);
+    _object(paint);
+  }
+
+  void drawRegion(SkRegion region, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_REGION_SK_CANVAS_COMMAND, 2);
+    _object(region);
+    _object(paint);
+  }
+
+  void drawImage(
+    SkImage image,
+    double x,
+    double y, {
+    SkSamplingOptions sampling = const SkSamplingOptions(),
+    SkPaint? paint,
+  }) {
+    _op(sk_canvas_command_t.DRAW_IMAGE_SK_CANVAS_COMMAND, 10);
+    _object(image);
+    _f32(x);
+    _f32(y);
+    _sampling(sampling);
+    _optionalObject(paint);
+  }
+
+  void drawImageRect(
+    SkImage image,
+    SkRect dst, {
+    SkRect? src,
+    required SkSamplingOptions sampling,
+    SkPaint? paint,
+  }) {
+    _op(sk_canvas_command_t.DRAW_IMAGE_RECT_SK_CANVAS_COMMAND, 17);
+    _object(image);
+    _u32(src != null ? 1 : 0);
+    _rect(src ?? dst);
+    _rect(dst);
+    _sampling(sampling);
+    _optionalObject(paint);
+  }
+
+  void drawString(String text, double x, double y, SkFont font, SkPaint paint) {
+    final bytes = utf8.encode(text);
+    _simpleText(
+      bytes,
+      sk_text_encoding_t.UTF8_SK_TEXT_ENCODING,
+      x,
+      y,
+      font,
+      paint,
+    );
+  }
+
+  void drawSimpleText(
+    SkEncodedText text,
+    double x,
+    double y,
+    SkFont font,
+    SkPaint paint,
+  ) {
+    final glyphIds = text._glyphIds;
+    final bytes = glyphIds != null
+        ? glyphIds.buffer.asUint8List(
+            glyphIds.offsetInBytes,
+            glyphIds.lengthInBytes,
+          )
+        : utf8.encode(text._string!);
+    _simpleText(bytes, text._encoding, x, y, font, paint);
+  }
+
+  void drawTextBlob(SkTextBlob text, double x, double y, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_TEXT_BLOB_SK_CANVAS_COMMAND, 4);
+    _object(text);
+    _f32(x);
+    _f32(y);
+    _object(paint);
+  }
+
+  void drawPicture(SkPicture picture, {Matrix3? matrix, SkPaint? paint}) {
+    if (matrix == null) {
+      _op(sk_canvas_command_t.DRAW_PICTURE_SK_CANVAS_COMMAND, 2);
+      _object(picture);
+    } else {
+      _op(sk_canvas_command_t.DRAW_PICTURE_MATRIX_SK_CANVAS_COMMAND, 11);
+      _object(picture);
+      _matrix3(matrix);
+    }
+    _optionalObject(paint);
+  }
+
+  void drawDrawable(SkDrawable drawable, {Matrix3? matrix}) {
+    _op(sk_canvas_command_t.DRAW_DRAWABLE_SK_CANVAS_COMMAND, 11);
+    _object(drawable);
+    _u32(matrix != null ? 1 : 0);
+    if (matrix != null) {
+      _matrix3(matrix);
+    }
+  }
+
+  void drawAnnotation(SkRect rect, String key, SkData value) {
+    final bytes = utf8.encode(key);
+    _op(
+      sk_canvas_command_t.DRAW_ANNOTATION_SK_CANVAS_COMMAND,
+      6 + _paddedLength(bytes.length) ~/ 4,
+    );
+    _rect(rect);
+    _byteArray(bytes);
+    _object(value);
+  }
+
+  // The keys of Skia's SkAnnotationKeys, which SkCanvas's annotation helpers
+  // use.
+  void drawUrlAnnotation(SkRect rect, SkData value) {
+    drawAnnotation(rect, 'SkAnnotationKey_URL', value);
+  }
+
+  void drawNamedDestinationAnnotation(SkPoint point, SkData value) {
+    drawAnnotation(
+      SkRect.fromLTRB(point.x, point.y, point.x, point.y),
+      'SkAnnotationKey_Define_Named_Dest',
+      value,
+    );
+  }
+
+  void drawLinkDestinationAnnotation(SkRect rect, SkData value) {
+    drawAnnotation(rect, 'SkAnnotationKey_Link_Named_Dest', value);
+  }
+
+  void drawImageNine(
+    SkImage image,
+    SkIRect center,
+    SkRect dst, {
+    SkFilterMode mode = SkFilterMode.nearest,
+    SkPaint? paint,
+  }) {
+    _op(sk_canvas_command_t.DRAW_IMAGE_NINE_SK_CANVAS_COMMAND, 11);
+    _object(image);
+    _irect(center);
+    _rect(dst);
+    _u32(mode._value.value);
+    _optionalObject(paint);
+  }
+
+  /// Records [SkCanvas.drawImageLattice]. Throws [ArgumentError] if
+  /// [lattice] has [SkLatticeRectType.fixedColor] cells but no colors, which
+  /// the command stream rejects.
+  void drawImageLattice(
+    SkImage image,
+    SkLattice lattice,
+    SkRect dst, {
+    SkFilterMode mode = SkFilterMode.nearest,
+    SkPaint? paint,
+  }) {
+    final rectTypes = lattice.rectTypes;
+    final colors = lattice.colors;
+    final bounds = lattice.bounds;
+    if (colors == null &&
+        rectTypes != null &&
+        rectTypes.contains(SkLatticeRectType.fixedColor)) {
+      throw ArgumentError('fixedColor cells require lattice colors.');
+    }
+    final cells = (lattice.xDivs.length + 1) * (lattice.yDivs.length + 1);
+    _op(
+      sk_canvas_command_t.DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND,
+      14 + lattice.xDivs.length + lattice.yDivs.length + 2 * cells,
+    );
+    _object(image);
+    _u32(lattice.xDivs.length);
+    lattice.xDivs.forEach(_i32);
+    _u32(lattice.yDivs.length);
+    lattice.yDivs.forEach(_i32);
+    _u32(
+      (rectTypes != null ? 1 : 0) |
+          (colors != null ? 2 : 0) |
+          (bounds != null ? 4 : 0),
+    );
+    if (rectTypes != null) {
+      for (final type in rectTypes) {
+        _u32(type._value.value);
+      }
+    }
+    if (colors != null) {
+      for (final color in colors) {
+        _u32(color.value);
+      }
+    }
+    if (bounds != null) {
+      _irect(bounds);
+    }
+    _rect(dst);
+    _u32(mode._value.value);
+    _optionalObject(paint);
+  }
+
+  void drawAtlas(
+    SkImage atlas,
+    List<SkRSXForm> transforms,
+    List<SkRect> tex, {
+    List<SkColor>? colors,
+    required SkBlendMode mode,
+    SkSamplingOptions sampling = const SkSamplingOptions(),
+    SkRect? cullRect,
+    SkPaint? paint,
+  }) {
+    if (transforms.length != tex.length) {
+      throw ArgumentError('transforms length must match tex length.');
+    }
+    if (colors != null && colors.length != transforms.length) {
+      throw ArgumentError('colors length must match transforms length.');
+    }
+    if (transforms.isEmpty) {
+      return;
+    }
+    final count = transforms.length;
+    _op(sk_canvas_command_t.DRAW_ATLAS_SK_CANVAS_COMMAND, 15 + 9 * count);
+    _object(atlas);
+    _u32(count);
+    for (final transform in transforms) {
+      _f32(transform.scos);
+      _f32(transform.ssin);
+      _f32(transform.tx);
+      _f32(transform.ty);
+    }
+    tex.forEach(_rect);
+    _u32((colors != null ? 1 : 0) | (cullRect != null ? 2 : 0));
+    if (colors != null) {
+      for (final color in colors) {
+        _u32(color.value);
+      }
+    }
+    _u32(mode._value.value);
+    _sampling(sampling);
+    if (cullRect != null) {
+      _rect(cullRect);
+    }
+    _optionalObject(paint);
+  }
+
+  void drawPatch(
+    List<SkPoint> cubics, {
+    List<SkColor>? colors,
+    List<SkPoint>? texCoords,
+    required SkBlendMode mode,
+    required SkPaint paint,
+  }) {
+    if (cubics.length != 12) {
+      throw ArgumentError.value(
+        cubics.length,
+        'cubics',
+        'Must contain 12 control points.',
+      );
+    }
+    if (colors != null && colors.length != 4) {
+      throw ArgumentError.value(
+        colors.length,
+        'colors',
+        'Must contain 4 entries.',
+      );
+    }
+    if (texCoords != null && texCoords.length != 4) {
+      throw ArgumentError.value(
+        texCoords.length,
+        'texCoords',
+        'Must contain 4 entries.',
+      );
+    }
+    _op(sk_canvas_command_t.DRAW_PATCH_SK_CANVAS_COMMAND, 39);
+    cubics.forEach(_point);
+    _u32((colors != null ? 1 : 0) | (texCoords != null ? 2 : 0));
+    if (colors != null) {
+      for (final color in colors) {
+        _u32(color.value);
+      }
+    }
+    texCoords?.forEach(_point);
+    _u32(mode._value.value);
+    _object(paint);
+  }
+
+  void drawVertices(SkVertices vertices, SkBlendMode mode, SkPaint paint) {
+    _op(sk_canvas_command_t.DRAW_VERTICES_SK_CANVAS_COMMAND, 3);
+    _object(vertices);
+    _u32(mode._value.value);
+    _object(paint);
+  }
+
+  void _simpleText(
+    List<int> bytes,
+    sk_text_encoding_t encoding,
+    double x,
+    double y,
+    SkFont font,
+    SkPaint paint,
+  ) {
+    _op(
+      sk_canvas_command_t.DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND,
+      6 + _paddedLength(bytes.length) ~/ 4,
+    );
+    _byteArray(bytes);
+    _u32(encoding.value);
+    _f32(x);
+    _f32(y);
+    _object(font);
+    _object(paint);
+  }
+
+  static const int _version = 1;
+  static const int _headerLength = 4;
+  static const int _noObject = 0xFFFFFFFF;
+
+  void _writeHeader() {
+    _data.setUint32(0, _version, Endian.host);
+    _length = _headerLength;
+  }
+
+  /// Writes [opcode] and makes sure there is room for [words] argument words.
+  void _op(sk_canvas_command_t opcode, int words) {
+    _ensureCapacity(4 + words * 4);
+    _u32(opcode.value);
+  }
+
+  void _ensureCapacity(int additional) {
+    final required = _length + additional;
+    if (required <= _bytes.length) {
+      return;
+    }
+    final bytes = Uint8List(math.max(required, _bytes.length * 2));
+    bytes.setRange(0, _length, _bytes);
+    _bytes = bytes;
+    _data = ByteData.sublistView(_bytes);
+  }
+
+  void _u32(int value) {
+    _data.setUint32(_length, value, Endian.host);
+    _length += 4;
+  }
+
+  void _i32(int value) {
+    _data.setInt32(_length, value, Endian.host);
+    _length += 4;
+  }
+
+  void _f32(double value) {
+    _data.setFloat32(_length, value, Endian.host);
+    _length += 4;
+  }
+
+  void _rect(SkRect rect) {
+    _f32(rect.left);
+    _f32(rect.top);
+    _f32(rect.right);
+    _f32(rect.bottom);
+  }
+
+  void _irect(SkIRect rect) {
+    _i32(rect.left);
+    _i32(rect.top);
+    _i32(rect.right);
+    _i32(rect.bottom);
+  }
+
+  void _point(SkPoint point) {
+    _f32(point.x);
+    _f32(point.y);
+  }
+
+  void _color4f(SkColor4f color) {
+    _f32(color.r);
+    _f32(color.g);
+    _f32(color.b);
+    _f32(color.a);
+  }
+
+  void _matrix3(Matrix3 matrix) {
+    final storage = matrix.storage;
+    for (var i = 0; i < 9; i++) {
+      _f32(storage[i]);
+    }
+  }
+
+  static int _paddedLength(int length) => (length + 3) & ~3;
+
+  /// Writes the length of [bytes] and the bytes, zero-padded to a word.
+  void _byteArray(List<int> bytes) {
+    final paddedLength = _paddedLength(bytes.length);
+    _u32(bytes.length);
+    _bytes.setRange(_length, _length + bytes.length, bytes);
+    _bytes.fillRange(_length + bytes.length, _length + paddedLength, 0);
+    _length += paddedLength;
+  }
+
+  void _matrix(Matrix4 matrix) {
+    final storage = matrix.storage;
+    for (var i = 0; i < 16; i++) {
+      _f32(storage[i]);
+    }
+  }
+
+  void _sampling(SkSamplingOptions sampling) {
+    _i32(sampling.maxAniso);
+    _u32(sampling.useCubic ? 1 : 0);
+    _f32(sampling.cubic.b);
+    _f32(sampling.cubic.c);
+    _u32(sampling.filter._value.value);
+    _u32(sampling.mipmap._value.value);
+  }
+
+  void _optionalObject(_NativeMixin? object) {
+    if (object == null) {
+      _u32(_noObject);
+    } else {
+      _object(object);
+    }
+  }
+
+  void _object(_NativeMixin object) {
+    var index = _objectIndices[object];
+    if (index == null) {
+      index = _objects.length;
+      _objects.add(object);
+      _objectIndices[object] = index;
+      if (index >= _objectTableCapacity) {
+        _growObjectTable();
+      }
+      _objectTable[index] = object._ptr.cast();
+    }
+    _u32(index);
+  }
+
+  void _growObjectTable() {
+    final capacity = math.max(_objectTableCapacity * 2, 16);
+    final table = ffi.malloc<Pointer<Void>>(capacity);
+    for (var i = 0; i < _objectTableCapacity; i++) {
+      table[i] = _objectTable[i];
+    }
+    if (_objectTable != nullptr) {
+      _tableFinalizer.detach(this);
+      ffi.malloc.free(_objectTable);
+    }
+    _objectTable = table;
+    _objectTableCapacity = capacity;
+    _tableFinalizer.attach(this, table.cast(), detach: this);
+  }
+
+  late Uint8List _bytes;
+  late ByteData _data;
+  int _length = 0;
+
+  final _objects = <_NativeMixin>[];
+  final _objectIndices = Map<_NativeMixin, int>.identity();
+  Pointer<Pointer<Void>> _objectTable = nullptr;
+  int _objectTableCapacity = 0;
+
+  static final _tableFinalizer = NativeFinalizer(ffi.malloc.nativeFree);
+}
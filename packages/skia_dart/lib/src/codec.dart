@@ -285,6 +285,60 @@ class SkCodecFrameInfo {
   }
 }
 
+/// An encoded image to decode with [SkCodec.decodeBatch].
+class SkCodecDecodeRequest {
+  const SkCodecDecodeRequest(
+    this.data, {
+    this.width = 0,
+    this.height = 0,
+    this.colorType,
+  });
+
+  /// The encoded image.
+  final SkData data;
+
+  /// The size of the decoded bitmap.
+  ///
+  /// If only one of [width] and [height] is non-zero, the other follows the
+  /// aspect ratio of the encoded image. If both are zero, the encoded size is
+  /// kept.
+  final int width;
+  final int height;
+
+  /// Color type of the decoded bitmap, or null to use the one suggested by
+  /// the codec.
+  final SkColorType? colorType;
+}
+
+/// The outcome of decoding one [SkCodecDecodeRequest].
+class SkCodecDecodeResult {
+  const SkCodecDecodeResult({
+    required this.result,
+    required this.bitmap,
+    required this.decodedSize,
+    required this.decodeTime,
+    required this.resizeTime,
+  });
+
+  final SkCodecResult result;
+
+  /// The decoded image at the requested size, or null if decoding failed.
+  ///
+  /// The bitmap is premultiplied and immutable. It may hold a partial image
+  /// if [result] is [SkCodecResult.incompleteInput].
+  final SkBitmap? bitmap;
+
+  /// The size the codec decoded at before the bitmap was resized to the
+  /// requested size.
+  final SkISize decodedSize;
+
+  /// Time spent creating the codec and decoding.
+  final Duration decodeTime;
+
+  /// Time spent resizing the decoded image to the requested size.
+  final Duration resizeTime;
+}
+
 /// Abstraction layer directly on top of an image codec.
 class SkCodec with _NativeMixin<sk_codec_t> {
   SkCodec._(Pointer<sk_codec_t> ptr) {
@@ -336,6 +390,59 @@ class SkCodec with _NativeMixin<sk_codec_t> {
     return SkCodec._(ptr);
   }
 
+  /// Decodes many encoded images concurrently on native worker threads.
+  ///
+  /// Uses at most [maxThreads] threads including the calling one; zero means
+  /// all available threads. The calling isolate is blocked until every image
+  /// has been decoded.
+  ///
+  /// When a request is smaller than its encoded image, the codec decodes at
+  /// the smallest size it supports natively (such as a JPEG DCT scale) that
+  /// still covers the request, and the result is resized from there.
+  ///
+  /// The results are in the same order as [requests].
+  static List<SkCodecDecodeResult> decodeBatch(
+    List<SkCodecDecodeRequest> requests, {
+    int maxThreads = 0,
+  }) {
+    for (final request in requests) {
+      RangeError.checkNotNegative(request.width, 'width');
+      RangeError.checkNotNegative(request.height, 'height');
+    }
+    if (requests.isEmpty) {
+      return const [];
+    }
+    final count = requests.length;
+    final requestsPtr = ffi.calloc<sk_codec_decode_request_t>(count);
+    final resultsPtr = ffi.calloc<sk_codec_decode_result_t>(count);
+    try {
+      for (var i = 0; i < count; ++i) {
+        final request = requests[i];
+        final ref = (requestsPtr + i).ref;
+        ref.fData = request.data._ptr;
+        ref.fWidth = request.width;
+        ref.fHeight = request.height;
+        ref.fColorTypeAsInt =
+            request.colorType?._value.value ??
+            sk_colortype_t.UNKNOWN_SK_COLORTYPE.value;
+      }
+      sk_codec_decode_batch(requestsPtr, resultsPtr, count, maxThreads);
+      return List.generate(count, (i) {
+        final ref = (resultsPtr + i).ref;
+        return SkCodecDecodeResult(
+          result: SkCodecResult._fromNative(ref.fResult),
+          bitmap: ref.fBitmap == nullptr ? null : SkBitmap._(ref.fBitmap),
+          decodedSize: SkISize(ref.fDecodedSize.w, ref.fDecodedSize.h),
+          decodeTime: Duration(microseconds: ref.fDecodeNanos ~/ 1000),
+          resizeTime: Duration(microseconds: ref.fResizeNanos ~/ 1000),
+        );
+      });
+    } finally {
+      ffi.calloc.free(requestsPtr);
+      ffi.calloc.free(resultsPtr);
+    }
+  }
+
   /// Convenience method to decode directly to a [SkBitmap].
   ///
   /// Returns null if pixel allocation fails or decoding fails.
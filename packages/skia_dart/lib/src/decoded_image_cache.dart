@@ -0,0 +1,130 @@
+part of 'skia_dart_library.dart';
+
+/// Counters of an [SkDecodedImageCache].
+class SkDecodedImageCacheStats {
+  const SkDecodedImageCacheStats({
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+    required this.bytes,
+    required this.entryCount,
+  });
+
+  final int hits;
+  final int misses;
+  final int evictions;
+
+  /// Bytes of pixels currently held by the cache.
+  final int bytes;
+  final int entryCount;
+
+  @override
+  String toString() =>
+      'SkDecodedImageCacheStats(hits: $hits, misses: $misses, '
+      'evictions: $evictions, bytes: $bytes, entryCount: $entryCount)';
+}
+
+/// A cache of decoded raster images with a byte budget.
+///
+/// Entries are keyed by a hash of the encoded bytes together with the
+/// requested size, color type and color space, so the same asset shown at
+/// several sizes is decoded once per size. Each size is decoded directly,
+/// using the codec's native downscaling where available (see
+/// [SkCodec.decodeBatch]), instead of decoding at full size first.
+///
+/// Least recently used entries are evicted once the budget is exceeded.
+/// Images returned by [get] stay valid after they are evicted.
+///
+/// Unlike [SkImage.fromEncoded], which decodes lazily into Skia's global
+/// resource cache, [get] decodes immediately.
+class SkDecodedImageCache with _NativeMixin<sk_decoded_image_cache_t> {
+  SkDecodedImageCache({required int byteBudget})
+    : this._(
+        sk_decoded_image_cache_new(
+          RangeError.checkNotNegative(byteBudget, 'byteBudget'),
+        ),
+      );
+
+  SkDecodedImageCache._(Pointer<sk_decoded_image_cache_t> ptr) {
+    _attach(ptr, _finalizer);
+  }
+
+  /// Returns [data] decoded at [width] x [height], from the cache if
+  /// possible.
+  ///
+  /// If only one of [width] and [height] is non-zero, the other follows the
+  /// aspect ratio of the encoded image. If both are zero, the encoded size is
+  /// kept. A null [colorType] or [colorSpace] keeps what the codec suggests.
+  ///
+  /// Returns null if the data cannot be decoded.
+  SkImage? get(
+    SkData data, {
+    int width = 0,
+    int height = 0,
+    SkColorType? colorType,
+    SkColorSpace? colorSpace,
+  }) {
+    RangeError.checkNotNegative(width, 'width');
+    RangeError.checkNotNegative(height, 'height');
+    final ptr = sk_decoded_image_cache_get(
+      _ptr,
+      data._ptr,
+      width,
+      height,
+      colorType?._value ?? sk_colortype_t.UNKNOWN_SK_COLORTYPE,
+      colorSpace?._ptr ?? nullptr,
+    );
+    if (ptr == nullptr) return null;
+    return SkImage._(ptr);
+  }
+
+  /// The maximum number of bytes of pixels held by the cache.
+  ///
+  /// Lowering the budget evicts entries right away.
+  int get byteBudget => sk_decoded_image_cache_get_budget(_ptr);
+
+  set byteBudget(int value) {
+    RangeError.checkNotNegative(value, 'byteBudget');
+    sk_decoded_image_cache_set_budget(_ptr, value);
+  }
+
+  /// Evicts all entries.
+  void purge() {
+    sk_decoded_image_cache_purge(_ptr);
+  }
+
+  SkDecodedImageCacheStats get stats {
+    final ptr = _statsPtr;
+    sk_decoded_image_cache_get_stats(_ptr, ptr);
+    final stats = ptr.ref;
+    return SkDecodedImageCacheStats(
+      hits: stats.fHits,
+      misses: stats.fMisses,
+      evictions: stats.fEvictions,
+      bytes: stats.fBytes,
+      entryCount: stats.fEntryCount,
+    );
+  }
+
+  /// Resets the hit, miss and eviction counters.
+  void resetStats() {
+    sk_decoded_image_cache_reset_stats(_ptr);
+  }
+
+  @override
+  void dispose() {
+    _dispose(sk_decoded_image_cache_delete, _finalizer);
+  }
+
+  static final _statsPtr = ffi.calloc<sk_decoded_image_cache_stats_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<
+      NativeFunction<Void Function(Pointer<sk_decoded_image_cache_t>)>
+    >
+    ptr = Native.addressOf(sk_decoded_image_cache_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
@@ -0,0 +1,299 @@
+part of 'skia_dart_library.dart';
+
+/// The outcome of an encode run by an [SkEncodeQueue].
+class SkEncodeResult {
+  const SkEncodeResult({
+    required this.data,
+    required this.queueTime,
+    required this.encodeTime,
+  });
+
+  /// The encoded image, or null if encoding failed or was cancelled.
+  final SkData? data;
+
+  /// Time between submitting the encode and a worker thread starting it.
+  final Duration queueTime;
+  final Duration encodeTime;
+
+  @override
+  String toString() =>
+      'SkEncodeResult(bytes: ${data?.size}, queueTime: $queueTime, '
+      'encodeTime: $encodeTime)';
+}
+
+/// Counters of an [SkEncodeQueue].
+class SkEncodeQueueStats {
+  const SkEncodeQueueStats({
+    required this.submitted,
+    required this.rejected,
+    required this.encoded,
+    required this.failed,
+    required this.cancelled,
+    required this.inFlight,
+    required this.encodedBytes,
+    required this.totalQueueTime,
+    required this.maxQueueTime,
+    required this.totalEncodeTime,
+    required this.maxEncodeTime,
+  });
+
+  final int submitted;
+
+  /// Submissions refused because the queue was full. [SkEncodeQueue] waits
+  /// and submits these again.
+  final int rejected;
+  final int encoded;
+  final int failed;
+  final int cancelled;
+
+  /// Number of encodes waiting for or running on a worker thread.
+  final int inFlight;
+  final int encodedBytes;
+
+  /// Time encodes spent waiting for a worker thread.
+  final Duration totalQueueTime;
+  final Duration maxQueueTime;
+  final Duration totalEncodeTime;
+  final Duration maxEncodeTime;
+
+  Duration get averageEncodeTime {
+    final finished = encoded + failed;
+    return finished == 0
+        ? Duration.zero
+        : Duration(microseconds: totalEncodeTime.inMicroseconds ~/ finished);
+  }
+
+  @override
+  String toString() =>
+      'SkEncodeQueueStats(submitted: $submitted, rejected: $rejected, '
+      'encoded: $encoded, failed: $failed, cancelled: $cancelled, '
+      'inFlight: $inFlight, encodedBytes: $encodedBytes, '
+      'averageEncodeTime: $averageEncodeTime, '
+      'maxEncodeTime: $maxEncodeTime, maxQueueTime: $maxQueueTime)';
+}
+
+/// Encodes images on the shared native worker pool without blocking this
+/// isolate.
+///
+/// At most [capacity] encodes are in flight at a time. Further encodes wait
+/// on this isolate, before their source is handed to native code, until an
+/// earlier one has finished, so a producer that outpaces the encoders is
+/// slowed down instead of piling up source images.
+class SkEncodeQueue with _NativeMixin<sk_encode_queue_t> {
+  SkEncodeQueue({int capacity = 4})
+    : this._(
+        sk_encode_queue_new(
+          RangeError.checkValueInInterval(capacity, 1, 1 << 20, 'capacity'),
+        ),
+      );
+
+  SkEncodeQueue._(Pointer<sk_encode_queue_t> ptr) {
+    _attach(ptr, _finalizer);
+  }
+
+  final _waiting = <Completer<void>>[];
+
+  int get capacity => sk_encode_queue_get_capacity(_ptr);
+
+  /// Number of encodes waiting for or running on a worker thread, not
+  /// counting the ones waiting on this isolate for a free slot.
+  int get inFlight => sk_encode_queue_get_in_flight(_ptr);
+
+  /// Encodes [image] as [format], which must be PNG, JPEG or WebP, using the
+  /// options for that format.
+  ///
+  /// The image is referenced until the encode has finished. Lazy images are
+  /// decoded on the worker thread. The result has no data if encoding failed,
+  /// which includes texture backed images.
+  Future<SkEncodeResult> encodeImage(
+    SkImage image, {
+    SkEncodedImageFormat format = SkEncodedImageFormat.png,
+    SkPngEncoderOptions? pngOptions,
+    SkJpegEncoderOptions? jpegOptions,
+    SkWebpEncoderOptions? webpOptions,
+  }) {
+    return _encode(
+      format,
+      pngOptions,
+      jpegOptions,
+      webpOptions,
+      (handle, options, result, completion) =>
+          sk_encode_queue_encode_image_async(
+            handle,
+            _ptr,
+            image._ptr,
+            options,
+            result,
+            completion,
+            nullptr,
+          ),
+    );
+  }
+
+  /// Like [encodeImage], but encodes a copy of the pixels of [pixmap], made
+  /// once a slot is free. The pixels may change as soon as the returned
+  /// future completes.
+  Future<SkEncodeResult> encodePixmap(
+    SkPixmap pixmap, {
+    SkEncodedImageFormat format = SkEncodedImageFormat.png,
+    SkPngEncoderOptions? pngOptions,
+    SkJpegEncoderOptions? jpegOptions,
+    SkWebpEncoderOptions? webpOptions,
+  }) {
+    return _encode(
+      format,
+      pngOptions,
+      jpegOptions,
+      webpOptions,
+      (handle, options, result, completion) =>
+          sk_encode_queue_encode_pixmap_async(
+            handle,
+            _ptr,
+            pixmap._ptr,
+            options,
+            result,
+            completion,
+            nullptr,
+          ),
+    );
+  }
+
+  Future<SkEncodeResult> _encode(
+    SkEncodedImageFormat format,
+    SkPngEncoderOptions? pngOptions,
+    SkJpegEncoderOptions? jpegOptions,
+    SkWebpEncoderOptions? webpOptions,
+    Pointer<sk_async_task_t> Function(
+      int isolateHandle,
+      Pointer<sk_encode_options_t> options,
+      Pointer<sk_encode_result_t> result,
+      sk_async_completion_proc completion,
+    )
+    submit,
+  ) async {
+    final resultPtr = ffi.calloc<sk_encode_result_t>();
+    try {
+      while (true) {
+        final task = _submit(
+          format,
+          pngOptions,
+          jpegOptions,
+          webpOptions,
+          (handle, options, completion) =>
+              submit(handle, options, resultPtr, completion),
+        );
+        if (task.submitted) {
+          await task.done;
+          _wakeOne();
+          break;
+        }
+        // The queue is full. Every encode in flight wakes one waiting encode
+        // when it completes.
+        final slot = Completer<void>();
+        _waiting.add(slot);
+        await slot.future;
+      }
+      final result = resultPtr.ref;
+      return SkEncodeResult(
+        data: result.fData == nullptr ? null : SkData._(result.fData),
+        queueTime: Duration(microseconds: result.fQueueNanos ~/ 1000),
+        encodeTime: Duration(microseconds: result.fEncodeNanos ~/ 1000),
+      );
+    } finally {
+      ffi.calloc.free(resultPtr);
+    }
+  }
+
+  AsyncTask _submit(
+    SkEncodedImageFormat format,
+    SkPngEncoderOptions? pngOptions,
+    SkJpegEncoderOptions? jpegOptions,
+    SkWebpEncoderOptions? webpOptions,
+    Pointer<sk_async_task_t> Function(
+      int isolateHandle,
+      Pointer<sk_encode_options_t> options,
+      sk_async_completion_proc completion,
+    )
+    submit,
+  ) {
+    final options = ffi.calloc<sk_encode_options_t>();
+    final png = (pngOptions ?? SkPngEncoderOptions.defaultOptions).toNative();
+    final jpeg = (jpegOptions ?? SkJpegEncoderOptions.defaultOptions)
+        .toNative();
+    final webp = (webpOptions ?? SkWebpEncoderOptions.defaultOptions)
+        .toNative(0);
+    try {
+      options.ref
+        ..fFormatAsInt = format._value.value
+        ..fPng = png.ref
+        ..fJpeg = jpeg.ref
+        ..fWebp = webp.ref;
+      return AsyncTask(
+        (isolateHandle, completion) =>
+            submit(isolateHandle, options, completion),
+      );
+    } finally {
+      ffi.calloc.free(options);
+      ffi.calloc.free(png);
+      ffi.calloc.free(jpeg);
+      ffi.calloc.free(webp);
+    }
+  }
+
+  // A slot frees up when an encode finishes on its worker thread, which is
+  // before its completion reaches this isolate.
+  void _wakeOne() {
+    if (_waiting.isNotEmpty) {
+      _waiting.removeAt(0).complete();
+    }
+  }
+
+  SkEncodeQueueStats get stats {
+    final ptr = _statsPtr;
+    sk_encode_queue_get_stats(_ptr, ptr);
+    final stats = ptr.ref;
+    Duration duration(int nanoseconds) =>
+        Duration(microseconds: nanoseconds ~/ 1000);
+    return SkEncodeQueueStats(
+      submitted: stats.fSubmitted,
+      rejected: stats.fRejected,
+      encoded: stats.fEncoded,
+      failed: stats.fFailed,
+      cancelled: stats.fCancelled,
+      inFlight: stats.fInFlight,
+      encodedBytes: stats.fEncodedBytes,
+      totalQueueTime: duration(stats.fTotalQueueNanos),
+      maxQueueTime: duration(stats.fMaxQueueNanos),
+      totalEncodeTime: duration(stats.fTotalEncodeNanos),
+      maxEncodeTime: duration(stats.fMaxEncodeNanos),
+    );
+  }
+
+  /// Resets the cumulative counters. [SkEncodeQueueStats.inFlight] describes
+  /// the current state and is kept.
+  void resetStats() {
+    sk_encode_queue_reset_stats(_ptr);
+  }
+
+  /// Encodes in flight still complete. Encodes waiting for a slot fail with
+  /// a [StateError].
+  @override
+  void dispose() {
+    while (_waiting.isNotEmpty) {
+      _waiting.removeAt(0).completeError(
+        StateError('SkEncodeQueue was disposed'),
+      );
+    }
+    _dispose(sk_encode_queue_delete, _finalizer);
+  }
+
+  static final _statsPtr = ffi.calloc<sk_encode_queue_stats_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<NativeFunction<Void Function(Pointer<sk_encode_queue_t>)>>
+    ptr = Native.addressOf(sk_encode_queue_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
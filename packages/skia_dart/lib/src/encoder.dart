@@ -245,6 +245,16 @@ class SkWebpEncoderOptions {
   );
 }
 
+/// A frame of an animated WebP, shown for [duration].
+class SkWebpEncoderFrame {
+  const SkWebpEncoderFrame(this.pixmap, this.duration);
+
+  final SkPixmap pixmap;
+
+  /// How long the frame is shown, with millisecond precision.
+  final Duration duration;
+}
+
 /// Encoder for WebP images.
 class SkWebPEncoder {
   /// Encodes the [src] pixels to the [dst] stream as WebP.
@@ -270,6 +280,112 @@ class SkWebPEncoder {
       ffi.calloc.free(optionsPtr);
     }
   }
+
+  /// Encodes [frames] to the [dst] stream as an animated WebP that loops
+  /// forever.
+  ///
+  /// All frames must have the size of the first one. Returns false if
+  /// [frames] is empty or any frame is invalid or unsupported.
+  ///
+  /// Every frame is held in memory until the animation is written; use
+  /// [SkWebpAnimEncoder] to add frames one at a time instead.
+  static bool encodeAnimated(
+    SkWStream dst,
+    List<SkWebpEncoderFrame> frames, {
+    SkWebpEncoderOptions? options,
+  }) {
+    if (frames.isEmpty) return false;
+    final framesPtr = ffi.calloc<sk_webpencoder_frame_t>(frames.length);
+    final optionsPtr = (options ?? SkWebpEncoderOptions.defaultOptions)
+        .toNative(0);
+    try {
+      for (var i = 0; i < frames.length; i++) {
+        framesPtr[i]
+          ..fPixmap = frames[i].pixmap._ptr
+          ..fDuration = frames[i].duration.inMilliseconds;
+      }
+      return sk_webpencoder_encode_animated(
+        dst._ptr,
+        framesPtr,
+        frames.length,
+        optionsPtr,
+      );
+    } finally {
+      ffi.calloc.free(framesPtr);
+      ffi.calloc.free(optionsPtr);
+    }
+  }
+}
+
+/// Encodes an animated WebP one frame at a time.
+///
+/// Each frame is compressed as it is added, so only one frame is held
+/// uncompressed. The compressed frames are kept until [finish] writes the
+/// animation, since the container needs all of them.
+class SkWebpAnimEncoder with _NativeMixin<sk_webp_anim_encoder_t> {
+  SkWebpAnimEncoder._(
+    Pointer<sk_webp_anim_encoder_t> ptr,
+    this.width,
+    this.height,
+  ) {
+    _attach(ptr, _finalizer);
+  }
+
+  /// Starts a [width] x [height] animation that plays [loopCount] times, or
+  /// forever if it is 0.
+  ///
+  /// Returns null if the size is empty or the options are rejected.
+  static SkWebpAnimEncoder? create({
+    required int width,
+    required int height,
+    SkWebpEncoderOptions? options,
+    int loopCount = 0,
+  }) {
+    final optionsPtr = (options ?? SkWebpEncoderOptions.defaultOptions)
+        .toNative(0);
+    try {
+      final ptr = sk_webp_anim_encoder_new(
+        width,
+        height,
+        optionsPtr,
+        loopCount,
+      );
+      if (ptr == nullptr) return null;
+      return SkWebpAnimEncoder._(ptr, width, height);
+    } finally {
+      ffi.calloc.free(optionsPtr);
+    }
+  }
+
+  final int width;
+  final int height;
+
+  int get frameCount => sk_webp_anim_encoder_get_frame_count(_ptr);
+
+  /// Adds [frame], shown for [duration] with millisecond precision.
+  ///
+  /// Returns false if [frame] is not [width] x [height], [duration] is
+  /// negative, or [finish] has been called.
+  bool addFrame(SkPixmap frame, Duration duration) =>
+      sk_webp_anim_encoder_add_frame(_ptr, frame._ptr, duration.inMilliseconds);
+
+  /// Writes the animation to [dst]. Returns false if no frame was added.
+  bool finish(SkWStream dst) => sk_webp_anim_encoder_finish(_ptr, dst._ptr);
+
+  @override
+  void dispose() {
+    _dispose(sk_webp_anim_encoder_delete, _finalizer);
+  }
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<
+      NativeFunction<Void Function(Pointer<sk_webp_anim_encoder_t>)>
+    >
+    ptr = Native.addressOf(sk_webp_anim_encoder_delete);
+    return NativeFinalizer(ptr.cast());
+  }
 }
 
 /// Encoder for JPEG images.
@@ -325,3 +441,145 @@ class SkPngEncoder {
     }
   }
 }
+
+/// Encodes an image to a stream a few rows at a time.
+///
+/// Only one row of converted pixels is kept, so images can be written while
+/// they are produced without ever holding them in memory as a whole, see
+/// [SkPicture.renderInStrips]. Rows are converted from the color and alpha
+/// type of the pixmaps they are written from.
+///
+/// WebP has no row encoder, since libwebp needs the whole picture. JPEG XMP
+/// metadata and origin are not written.
+class SkRowEncoder with _NativeMixin<sk_row_encoder_t> {
+  SkRowEncoder._(
+    Pointer<sk_row_encoder_t> ptr,
+    this._dst,
+    this.width,
+    this.height,
+  ) {
+    _attach(ptr, _finalizer);
+  }
+
+  /// Starts a [width] x [height] PNG image on [dst], which is written without
+  /// an alpha channel if [opaque] is true.
+  ///
+  /// Returns null if the image is empty.
+  static SkRowEncoder? png(
+    SkWStream dst, {
+    required int width,
+    required int height,
+    bool opaque = false,
+    SkPngEncoderOptions? options,
+  }) {
+    final optionsPtr = (options ?? SkPngEncoderOptions.defaultOptions)
+        .toNative();
+    try {
+      final ptr = sk_row_encoder_new_png(
+        dst._ptr,
+        width,
+        height,
+        opaque,
+        optionsPtr,
+      );
+      if (ptr == nullptr) return null;
+      return SkRowEncoder._(ptr, dst, width, height);
+    } finally {
+      ffi.calloc.free(optionsPtr);
+    }
+  }
+
+  /// Starts a [width] x [height] JPEG image on [dst].
+  ///
+  /// Returns null if the image is empty or too large for JPEG.
+  static SkRowEncoder? jpeg(
+    SkWStream dst, {
+    required int width,
+    required int height,
+    SkJpegEncoderOptions? options,
+  }) {
+    final optionsPtr = (options ?? SkJpegEncoderOptions.defaultOptions)
+        .toNative();
+    try {
+      final ptr = sk_row_encoder_new_jpeg(
+        dst._ptr,
+        width,
+        height,
+        optionsPtr,
+      );
+      if (ptr == nullptr) return null;
+      return SkRowEncoder._(ptr, dst, width, height);
+    } finally {
+      ffi.calloc.free(optionsPtr);
+    }
+  }
+
+  /// The stream written to, kept alive as long as the encoder.
+  // ignore: unused_field
+  final SkWStream _dst;
+
+  final int width;
+  final int height;
+
+  int get rowsWritten => sk_row_encoder_get_rows_written(_ptr);
+
+  /// Encodes the next rows of the image from [rows], which must be [width]
+  /// pixels wide.
+  ///
+  /// Returns false if [rows] has more rows than remain, or if an earlier
+  /// call failed.
+  bool writeRows(SkPixmap rows) => sk_row_encoder_write_rows(_ptr, rows._ptr);
+
+  /// Completes the image. Returns false unless every row has been written.
+  bool finish() => sk_row_encoder_finish(_ptr);
+
+  @override
+  void dispose() {
+    _dispose(sk_row_encoder_delete, _finalizer);
+  }
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<NativeFunction<Void Function(Pointer<sk_row_encoder_t>)>>
+    ptr = Native.addressOf(sk_row_encoder_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
+
+/// Timings of [SkPicture.renderInStrips].
+class SkStripRenderStats {
+  const SkStripRenderStats({
+    required this.bandCount,
+    required this.renderTime,
+    required this.encodeTime,
+    required this.totalTime,
+    required this.bandBytes,
+    required this.megapixelsPerSecond,
+  });
+
+  final int bandCount;
+
+  /// Time spent drawing and encoding the bands. Bands are drawn while the
+  /// previous one is encoded, so the two may add up to more than [totalTime].
+  final Duration renderTime;
+  final Duration encodeTime;
+  final Duration totalTime;
+
+  /// The memory held by the band surfaces.
+  final int bandBytes;
+
+  /// The number of pixels encoded per second of [totalTime], in millions.
+  final double megapixelsPerSecond;
+
+  static SkStripRenderStats _fromNative(sk_strip_render_stats_t stats) {
+    return SkStripRenderStats(
+      bandCount: stats.fBandCount,
+      renderTime: Duration(microseconds: stats.fRenderNanos ~/ 1000),
+      encodeTime: Duration(microseconds: stats.fEncodeNanos ~/ 1000),
+      totalTime: Duration(microseconds: stats.fTotalNanos ~/ 1000),
+      bandBytes: stats.fBandBytes,
+      megapixelsPerSecond: stats.fMegapixelsPerSecond,
+    );
+  }
+}
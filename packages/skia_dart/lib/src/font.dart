@@ -197,6 +197,61 @@ class SkFontMetrics {
   }
 }
 
+/// Glyphs of one font to prewarm with [SkFont.prewarmGlyphsBatch] or
+/// [SkFont.prewarmGlyphsAsync].
+class SkFontPrewarmRequest {
+  const SkFontPrewarmRequest(
+    this.font,
+    this.glyphs, {
+    this.matrix,
+    this.paint,
+  });
+
+  final SkFont font;
+  final List<int> glyphs;
+
+  /// The matrix the glyphs will be drawn with, or null for the identity.
+  final Matrix3? matrix;
+
+  /// The paint the glyphs will be drawn with, or null for a default paint.
+  final SkPaint? paint;
+}
+
+/// The outcome of prewarming glyphs with [SkFont.prewarmGlyphs].
+class SkFontPrewarmResult {
+  const SkFontPrewarmResult({
+    required this.imageCount,
+    required this.pathCount,
+    required this.elapsed,
+  });
+
+  /// Number of glyph images in the glyph cache. A subpixel positioned font
+  /// has an image for each of the subpixel offsets glyphs may be drawn at.
+  final int imageCount;
+
+  /// Number of glyphs whose path is in the glyph cache. Glyphs too large to
+  /// cache as images are drawn from their paths.
+  final int pathCount;
+
+  final Duration elapsed;
+
+  /// Number of glyph images and paths in the glyph cache.
+  int get glyphCount => imageCount + pathCount;
+
+  static SkFontPrewarmResult _fromNative(sk_font_prewarm_result_t result) {
+    return SkFontPrewarmResult(
+      imageCount: result.fImageCount,
+      pathCount: result.fPathCount,
+      elapsed: Duration(microseconds: result.fNanos ~/ 1000),
+    );
+  }
+
+  @override
+  String toString() =>
+      'SkFontPrewarmResult(imageCount: $imageCount, pathCount: $pathCount, '
+      'elapsed: $elapsed)';
+}
+
 /// Callback for receiving glyph paths from [SkFont.getPaths].
 ///
 /// [path] is the glyph's outline path, or null if the glyph cannot be
@@ -842,6 +897,104 @@ class SkFont with _NativeMixin<sk_font_t> {
     }
   }
 
+  /// Rasterizes [glyphs] into the glyph cache as they would be drawn with
+  /// this font, [matrix] and [paint], so that the first frame drawing them
+  /// does not have to.
+  SkFontPrewarmResult prewarmGlyphs(
+    List<int> glyphs, {
+    Matrix3? matrix,
+    SkPaint? paint,
+  }) {
+    final glyphsPtr = _toGlyphPointer(glyphs);
+    try {
+      sk_font_prewarm_glyphs(
+        _ptr,
+        glyphsPtr,
+        glyphs.length,
+        matrix?.toNativePooled(0) ?? nullptr,
+        paint?._ptr ?? nullptr,
+        _prewarmResultPtr,
+      );
+      return SkFontPrewarmResult._fromNative(_prewarmResultPtr.ref);
+    } finally {
+      ffi.calloc.free(glyphsPtr);
+    }
+  }
+
+  /// Prewarms the glyphs of many fonts and sizes concurrently on the native
+  /// worker pool, using at most [maxThreads] threads including the calling
+  /// one (0 means no limit).
+  static List<SkFontPrewarmResult> prewarmGlyphsBatch(
+    List<SkFontPrewarmRequest> requests, {
+    int maxThreads = 0,
+  }) {
+    if (requests.isEmpty) {
+      return const [];
+    }
+    final native = _NativePrewarmRequests(requests);
+    final resultsPtr = ffi.calloc<sk_font_prewarm_result_t>(requests.length);
+    try {
+      sk_font_prewarm_glyphs_batch(
+        native.ptr,
+        resultsPtr,
+        requests.length,
+        maxThreads,
+      );
+      return _prewarmResults(resultsPtr, requests.length);
+    } finally {
+      native.free();
+      ffi.calloc.free(resultsPtr);
+    }
+  }
+
+  /// Like [prewarmGlyphsBatch], but runs on a native worker thread without
+  /// blocking this isolate.
+  ///
+  /// The requests are copied, so the fonts and paints may be changed or
+  /// disposed as soon as this returns.
+  static Future<List<SkFontPrewarmResult>> prewarmGlyphsAsync(
+    List<SkFontPrewarmRequest> requests,
+  ) async {
+    if (requests.isEmpty) {
+      return const [];
+    }
+    final native = _NativePrewarmRequests(requests);
+    final resultsPtr = ffi.calloc<sk_font_prewarm_result_t>(requests.length);
+    final AsyncTask task;
+    try {
+      task = AsyncTask(
+        (isolateHandle, completion) => sk_font_prewarm_glyphs_async(
+          isolateHandle,
+          native.ptr,
+          requests.length,
+          resultsPtr,
+          completion,
+          nullptr,
+        ),
+      );
+    } finally {
+      native.free();
+    }
+    try {
+      await task.done;
+      return _prewarmResults(resultsPtr, requests.length);
+    } finally {
+      ffi.calloc.free(resultsPtr);
+    }
+  }
+
+  static List<SkFontPrewarmResult> _prewarmResults(
+    Pointer<sk_font_prewarm_result_t> ptr,
+    int count,
+  ) {
+    return List.generate(
+      count,
+      (i) => SkFontPrewarmResult._fromNative((ptr + i).ref),
+    );
+  }
+
+  static final _prewarmResultPtr = ffi.calloc<sk_font_prewarm_result_t>();
+
   @override
   void dispose() {
     _dispose(sk_font_delete, _finalizer);
@@ -861,3 +1014,45 @@ class SkFont with _NativeMixin<sk_font_t> {
     return ptr;
   }
 }
+
+/// Native copies of [SkFontPrewarmRequest]s, valid until [free] is called.
+class _NativePrewarmRequests {
+  _NativePrewarmRequests(List<SkFontPrewarmRequest> requests) {
+    var glyphCount = 0;
+    for (final request in requests) {
+      glyphCount += request.glyphs.length;
+    }
+    // All allocations are at least one element so that none is zero sized.
+    ptr = ffi.calloc<sk_font_prewarm_request_t>(requests.length + 1);
+    _glyphs = ffi.calloc<Uint16>(glyphCount + 1);
+    _matrices = ffi.calloc<sk_matrix_t>(requests.length + 1);
+    final glyphList = _glyphs.asTypedList(glyphCount + 1);
+    var glyphOffset = 0;
+    for (var i = 0; i < requests.length; ++i) {
+      final request = requests[i];
+      final glyphs = request.glyphs;
+      glyphList.setAll(glyphOffset, glyphs);
+      final matrix = request.matrix;
+      if (matrix != null) {
+        (_matrices + i).ref.values.elements.setAll(0, matrix.storage);
+      }
+      final ref = (ptr + i).ref;
+      ref.fFont = request.font._ptr;
+      ref.fGlyphs = _glyphs + glyphOffset;
+      ref.fGlyphCount = glyphs.length;
+      ref.fMatrix = matrix == null ? nullptr : _matrices + i;
+      ref.fPaint = request.paint?._ptr ?? nullptr;
+      glyphOffset += glyphs.length;
+    }
+  }
+
+  late final Pointer<sk_font_prewarm_request_t> ptr;
+  late final Pointer<Uint16> _glyphs;
+  late final Pointer<sk_matrix_t> _matrices;
+
+  void free() {
+    ffi.calloc.free(ptr);
+    ffi.calloc.free(_glyphs);
+    ffi.calloc.free(_matrices);
+  }
+}
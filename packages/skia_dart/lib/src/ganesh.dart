@@ -199,6 +199,7 @@ class GrDirectContext extends GrRecordingContext {
   }
 
   void flush() {
+    RunLoop.instance.flush();
     gr_direct_context_flush(_directContextPtr);
   }
 
@@ -210,6 +211,7 @@ class GrDirectContext extends GrRecordingContext {
   }
 
   void flushAndSubmit({bool syncCpu = false}) {
+    RunLoop.instance.flush();
     gr_direct_context_flush_and_submit(_directContextPtr, syncCpu);
   }
 
@@ -334,6 +334,7 @@ class GraphiteContext with _NativeMixin<skgpu_graphite_context_t> {
   }
 
   bool submit([GraphiteSubmitInfo info = const GraphiteSubmitInfo()]) {
+    RunLoop.instance.flush();
     return skgpu_graphite_context_submit(_ptr, info.toNativePooled(0));
   }
 
@@ -174,6 +174,8 @@ class SkFontCollection with _NativeMixin<sk_font_collection_t> {
   bool get fontFallbackEnabled =>
       sk_font_collection_font_fallback_enabled(_ptr);
 
+  /// Clears the shaping caches of this collection and evicts the paragraphs
+  /// shaped with it from every [SkParagraphLayoutCache].
   void clearCaches() {
     sk_font_collection_clear_caches(_ptr);
   }
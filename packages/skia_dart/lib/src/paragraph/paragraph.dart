@@ -463,6 +463,55 @@ final class SkLineMetrics with _NativeMixin<sk_line_metrics_t> {
   }
 }
 
+/// Metrics of every line of a laid out paragraph, stored column-wise.
+///
+/// Entry `i` of each list describes line `i`. When style runs were requested,
+/// the runs of line `i` are entries `styleRunOffsets[i]` up to
+/// `styleRunOffsets[i + 1]` of [styleRunTextStarts] and
+/// [styleRunFontMetrics].
+final class SkParagraphLineMetricsTable {
+  SkParagraphLineMetricsTable._({
+    required this.startIndex,
+    required this.endIndex,
+    required this.endExcludingWhitespaces,
+    required this.endIncludingNewline,
+    required this.isHardBreak,
+    required this.ascent,
+    required this.descent,
+    required this.unscaledAscent,
+    required this.height,
+    required this.width,
+    required this.left,
+    required this.baseline,
+    required this.lineNumber,
+    required this.styleRunOffsets,
+    required this.styleRunTextStarts,
+    required this.styleRunFontMetrics,
+  });
+
+  final Uint64List startIndex;
+  final Uint64List endIndex;
+  final Uint64List endExcludingWhitespaces;
+  final Uint64List endIncludingNewline;
+  final List<bool> isHardBreak;
+  final Float64List ascent;
+  final Float64List descent;
+  final Float64List unscaledAscent;
+  final Float64List height;
+  final Float64List width;
+  final Float64List left;
+  final Float64List baseline;
+  final Uint64List lineNumber;
+
+  /// Null unless style runs were requested.
+  final Uint64List? styleRunOffsets;
+  final Uint64List? styleRunTextStarts;
+  final List<SkFontMetrics>? styleRunFontMetrics;
+
+  int get length => startIndex.length;
+}
+
+final class SkParagraphPainter {
 final class SkParagraphPainter {
   const SkParagraphPainter._(this._ptr);
 
@@ -499,6 +548,52 @@ final class SkParagraph with _NativeMixin<sk_paragraph_t> {
     sk_paragraph_layout(_ptr, width);
   }
 
+  /// Lays out `paragraphs[i]` at `widths[i]` for every `i`, concurrently on
+  /// native worker threads.
+  ///
+  /// Uses at most [maxThreads] threads including the calling one; zero means
+  /// all available threads. The calling isolate is blocked until every
+  /// paragraph has been laid out. The result is the same as calling [layout]
+  /// on each paragraph in turn.
+  ///
+  /// The paragraphs may share font collections but must be distinct.
+  static void layoutBatch(
+    List<SkParagraph> paragraphs,
+    List<double> widths, {
+    int maxThreads = 0,
+  }) {
+    if (paragraphs.length != widths.length) {
+      throw ArgumentError.value(
+        widths,
+        'widths',
+        'must have the same length as paragraphs',
+      );
+    }
+    if (paragraphs.toSet().length != paragraphs.length) {
+      throw ArgumentError.value(
+        paragraphs,
+        'paragraphs',
+        'must not contain duplicates',
+      );
+    }
+    if (paragraphs.isEmpty) {
+      return;
+    }
+    final count = paragraphs.length;
+    final paragraphsPtr = ffi.calloc<Pointer<sk_paragraph_t>>(count);
+    final widthsPtr = ffi.calloc<Float>(count);
+    try {
+      for (var i = 0; i < count; ++i) {
+        paragraphsPtr[i] = paragraphs[i]._ptr;
+        widthsPtr[i] = widths[i];
+      }
+      sk_paragraph_layout_batch(paragraphsPtr, widthsPtr, count, maxThreads);
+    } finally {
+      ffi.calloc.free(paragraphsPtr);
+      ffi.calloc.free(widthsPtr);
+    }
+  }
+
   void paint(SkCanvas canvas, double x, double y) {
     sk_paragraph_paint(_ptr, canvas._ptr, x, y);
   }
@@ -576,6 +671,56 @@ final class SkParagraph with _NativeMixin<sk_paragraph_t> {
     );
   }
 
+  /// Resolves each of [points] as [getGlyphPositionAtCoordinate] would, in a
+  /// single native call.
+  List<SkParagraphPositionWithAffinity> getGlyphPositionsAtCoordinates(
+    List<SkPoint> points,
+  ) {
+    if (points.isEmpty) {
+      return const [];
+    }
+    final pointsPtr = ffi.calloc<sk_point_t>(points.length);
+    final positionsPtr = ffi.calloc<sk_paragraph_position_with_affinity_t>(
+      points.length,
+    );
+    try {
+      for (var i = 0; i < points.length; i++) {
+        pointsPtr[i].x = points[i].x;
+        pointsPtr[i].y = points[i].y;
+      }
+      sk_paragraph_get_glyph_positions_at_coordinates(
+        _ptr,
+        pointsPtr,
+        points.length,
+        positionsPtr,
+      );
+      return List.generate(
+        points.length,
+        (index) =>
+            SkParagraphPositionWithAffinity._fromNative(positionsPtr[index]),
+        growable: false,
+      );
+    } finally {
+      ffi.calloc.free(pointsPtr);
+      ffi.calloc.free(positionsPtr);
+    }
+  }
+
+  /// Whether coordinate queries use a hit-test index.
+  ///
+  /// When enabled, [getGlyphPositionAtCoordinate],
+  /// [getGlyphPositionsAtCoordinates] and [getClosestGlyphClusterAt] binary
+  /// search an index of the drawn glyph clusters, built on the first query
+  /// after each layout, instead of walking every line. This makes queries on
+  /// paragraphs with many lines much cheaper. Trailing whitespace at soft line
+  /// breaks and placeholders are not hit targets in the index, and the cluster
+  /// bounds it reports span the height of the line. Disabled by default.
+  bool get hitTestIndexEnabled => sk_paragraph_is_hit_test_index_enabled(_ptr);
+
+  set hitTestIndexEnabled(bool value) {
+    sk_paragraph_set_hit_test_index_enabled(_ptr, value);
+  }
+
   /// Finds the first and last glyphs that define a word containing
   /// the glyph at index [offset].
   SkParagraphTextRange getWordBoundary(int offset) {
@@ -596,6 +741,93 @@ final class SkParagraph with _NativeMixin<sk_paragraph_t> {
     return result;
   }
 
+  /// Returns the metrics of every line in a single native call.
+  ///
+  /// Prefer this over [lineMetrics] when reading many lines; set
+  /// [includeStyleRuns] to also fetch the text start and font metrics of each
+  /// style run.
+  SkParagraphLineMetricsTable getLineMetricsTable({
+    bool includeStyleRuns = false,
+  }) {
+    final lines = sk_paragraph_get_line_metrics_count(_ptr);
+    final runs = includeStyleRuns
+        ? sk_paragraph_get_style_metrics_count(_ptr)
+        : 0;
+    // Every allocation is padded by one entry so that none of them is empty.
+    final buffer = ffi.calloc<sk_paragraph_line_metrics_buffer_t>();
+    final ints = ffi.calloc<Uint64>(lines * 7 + runs + 1);
+    final doubles = ffi.calloc<Double>(lines * 7 + 1);
+    final hardBreak = ffi.calloc<Uint8>(lines + 1);
+    final fontMetrics = ffi.calloc<sk_fontmetrics_t>(runs + 1);
+    try {
+      buffer.ref
+        ..start_index = ints
+        ..end_index = ints + lines
+        ..end_excluding_whitespaces = ints + lines * 2
+        ..end_including_newline = ints + lines * 3
+        ..line_number = ints + lines * 4
+        ..hard_break = hardBreak
+        ..ascent = doubles
+        ..descent = doubles + lines
+        ..unscaled_ascent = doubles + lines * 2
+        ..height = doubles + lines * 3
+        ..width = doubles + lines * 4
+        ..left = doubles + lines * 5
+        ..baseline = doubles + lines * 6;
+      if (includeStyleRuns) {
+        buffer.ref
+          ..style_run_offsets = ints + lines * 5
+          ..style_run_text_starts = ints + lines * 6 + 1
+          ..style_run_font_metrics = fontMetrics;
+      }
+      sk_paragraph_get_all_line_metrics(_ptr, buffer);
+
+      Uint64List intColumn(int index, int length) =>
+          Uint64List.fromList((ints + lines * index).asTypedList(length));
+      Float64List doubleColumn(int index) =>
+          Float64List.fromList((doubles + lines * index).asTypedList(lines));
+
+      return SkParagraphLineMetricsTable._(
+        startIndex: intColumn(0, lines),
+        endIndex: intColumn(1, lines),
+        endExcludingWhitespaces: intColumn(2, lines),
+        endIncludingNewline: intColumn(3, lines),
+        lineNumber: intColumn(4, lines),
+        isHardBreak: List.generate(
+          lines,
+          (i) => hardBreak[i] != 0,
+          growable: false,
+        ),
+        ascent: doubleColumn(0),
+        descent: doubleColumn(1),
+        unscaledAscent: doubleColumn(2),
+        height: doubleColumn(3),
+        width: doubleColumn(4),
+        left: doubleColumn(5),
+        baseline: doubleColumn(6),
+        styleRunOffsets: includeStyleRuns ? intColumn(5, lines + 1) : null,
+        styleRunTextStarts: includeStyleRuns
+            ? Uint64List.fromList(
+                (ints + lines * 6 + 1).asTypedList(runs),
+              )
+            : null,
+        styleRunFontMetrics: includeStyleRuns
+            ? List.generate(
+                runs,
+                (i) => SkFontMetrics._fromNative(fontMetrics + i),
+                growable: false,
+              )
+            : null,
+      );
+    } finally {
+      ffi.calloc.free(fontMetrics);
+      ffi.calloc.free(hardBreak);
+      ffi.calloc.free(doubles);
+      ffi.calloc.free(ints);
+      ffi.calloc.free(buffer);
+    }
+  }
+
   SkLineMetrics? getLineMetricsByIndex(int index) {
     final metrics = SkLineMetrics();
     final ok = sk_paragraph_get_line_metrics_by_index(
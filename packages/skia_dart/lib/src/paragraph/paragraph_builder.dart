@@ -111,17 +111,48 @@ final class SkPlaceholderStyle {
   );
 }
 
+/// A span of text or a placeholder, added with [SkParagraphBuilder.addRuns].
+final class SkParagraphRun {
+  /// A run of [text]. A null [style] keeps the style at the top of the
+  /// builder's style stack.
+  const SkParagraphRun.text(String this.text, {this.style})
+    : placeholder = null;
+
+  /// A placeholder, see [SkParagraphBuilder.addPlaceholder].
+  const SkParagraphRun.placeholder(
+    SkPlaceholderStyle this.placeholder, {
+    this.style,
+  }) : text = null;
+
+  final String? text;
+  final SkPlaceholderStyle? placeholder;
+  final SkTextStyle? style;
+}
+
 final class SkParagraphBuilder with _NativeMixin<sk_paragraph_builder_t> {
+  /// Creates a builder.
+  ///
+  /// Only a builder with [recordInputs] set can be passed to
+  /// [SkParagraphLayoutCache.build] and [SkParagraphEditor.new]: it keeps a
+  /// copy of its text, styles and placeholders for them, which other builders
+  /// skip.
   SkParagraphBuilder({
     required SkParagraphStyle style,
     required SkFontCollection fontCollection,
     required SkUnicode unicode,
+    bool recordInputs = false,
   }) : this._(
-         sk_paragraph_builder_make(
-           style._ptr,
-           fontCollection._ptr,
-           unicode._ptr,
-         ),
+         recordInputs
+             ? sk_paragraph_builder_make_recording(
+                 style._ptr,
+                 fontCollection._ptr,
+                 unicode._ptr,
+               )
+             : sk_paragraph_builder_make(
+                 style._ptr,
+                 fontCollection._ptr,
+                 unicode._ptr,
+               ),
        );
 
   SkParagraphBuilder._(Pointer<sk_paragraph_builder_t> ptr) {
@@ -187,6 +218,100 @@ final class SkParagraphBuilder with _NativeMixin<sk_paragraph_builder_t> {
     }
   }
 
+  /// Adds [runs] in a single native call.
+  ///
+  /// This is equivalent to pushing each run's style, adding its text or
+  /// placeholder and popping the style again, but crosses into native code
+  /// once rather than several times per run. Styles are passed by reference
+  /// and copied only where consecutive runs differ in style, so reuse the same
+  /// [SkTextStyle] instance for runs that share a style.
+  void addRuns(List<SkParagraphRun> runs) {
+    if (runs.isEmpty) {
+      return;
+    }
+    final styles = Map<SkTextStyle, int>.identity();
+    final placeholders = <SkPlaceholderStyle, int>{};
+    final text = BytesBuilder(copy: false);
+    final runsPtr = ffi.calloc<sk_paragraph_text_run_t>(runs.length);
+    try {
+      for (var i = 0; i < runs.length; i++) {
+        final run = runs[i];
+        final native = (runsPtr + i).ref;
+        final style = run.style;
+        native.style_index = style == null
+            ? -1
+            : styles.putIfAbsent(style, () => styles.length);
+        final placeholder = run.placeholder;
+        if (placeholder != null) {
+          native.placeholder_index = placeholders.putIfAbsent(
+            placeholder,
+            () => placeholders.length,
+          );
+        } else {
+          native.placeholder_index = -1;
+          final units = utf8.encode(run.text!);
+          native.text_length = units.length;
+          text.add(units);
+        }
+      }
+      _addRuns(
+        styles.keys.toList(),
+        placeholders.keys.toList(),
+        runsPtr,
+        runs.length,
+        text.takeBytes(),
+      );
+    } finally {
+      ffi.calloc.free(runsPtr);
+    }
+  }
+
+  void _addRuns(
+    List<SkTextStyle> styles,
+    List<SkPlaceholderStyle> placeholders,
+    Pointer<sk_paragraph_text_run_t> runsPtr,
+    int runCount,
+    Uint8List text,
+  ) {
+    // Every allocation is at least one element so that none is zero sized.
+    final stylesPtr = ffi.calloc<Pointer<sk_text_style_t>>(styles.length + 1);
+    final placeholdersPtr = ffi.calloc<sk_paragraph_placeholder_style_t>(
+      placeholders.length + 1,
+    );
+    final textPtr = ffi.malloc<Uint8>(text.length + 1);
+    try {
+      for (var i = 0; i < styles.length; i++) {
+        stylesPtr[i] = styles[i]._ptr;
+      }
+      for (var i = 0; i < placeholders.length; i++) {
+        final placeholder = placeholders[i];
+        final native = (placeholdersPtr + i).ref;
+        native.width = placeholder.width;
+        native.height = placeholder.height;
+        native.alignmentAsInt = placeholder.alignment._value.value;
+        native.baselineAsInt = placeholder.baseline._value.value;
+        native.baseline_offset = placeholder.baselineOffset;
+      }
+      textPtr.asTypedList(text.length).setAll(0, text);
+      final added = sk_paragraph_builder_add_runs(
+        _ptr,
+        stylesPtr,
+        styles.length,
+        placeholdersPtr,
+        placeholders.length,
+        runsPtr,
+        runCount,
+        textPtr.cast(),
+        text.length,
+      );
+      assert(added);
+    } finally {
+      ffi.calloc.free(stylesPtr);
+      ffi.calloc.free(placeholdersPtr);
+      ffi.malloc.free(textPtr);
+    }
+  }
+
   /// Constructs a [SkParagraph] object that can be used to layout and paint
   /// the text to a [SkCanvas].
   SkParagraph build() {
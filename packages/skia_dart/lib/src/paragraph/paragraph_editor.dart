@@ -0,0 +1,143 @@
+part of '../skia_dart_library.dart';
+
+/// Styled text that is edited in place and laid out incrementally.
+///
+/// The text is split at hard line breaks into blocks that are shaped and laid
+/// out as separate paragraphs. [replace] only reshapes the blocks the edit
+/// touches, and [layout] only lays out those blocks again, so the cost of an
+/// edit depends on the size of the edited lines rather than of the whole text.
+/// The paragraph style's max lines, ellipsis and text height behavior apply to
+/// each block.
+///
+/// All text offsets are in UTF-8 code units; a placeholder occupies the three
+/// code units of U+FFFC.
+class SkParagraphEditor with _NativeMixin<sk_paragraph_editor_t> {
+  /// Starts from the contents of [builder], which is left unchanged.
+  ///
+  /// Throws an [ArgumentError] unless [builder] was created with
+  /// `recordInputs: true`.
+  factory SkParagraphEditor(SkParagraphBuilder builder) {
+    final ptr = sk_paragraph_editor_new(builder._ptr);
+    if (ptr == nullptr) {
+      throw ArgumentError.value(builder, 'builder', 'must record its inputs');
+    }
+    return SkParagraphEditor._(ptr);
+  }
+
+  SkParagraphEditor._(Pointer<sk_paragraph_editor_t> ptr) {
+    _attach(ptr, _finalizer);
+  }
+
+  String get text {
+    final lengthPtr = _Size.pool[0];
+    final textPtr = _Size.pool[1];
+    sk_paragraph_editor_get_text(_ptr, textPtr.cast(), lengthPtr);
+    final textUtf8Ptr = Pointer<ffi.Utf8>.fromAddress(textPtr.value);
+    if (textUtf8Ptr == nullptr) {
+      return '';
+    }
+    return textUtf8Ptr.toDartString(length: lengthPtr.value);
+  }
+
+  /// Replaces the UTF-8 range [start]..[end] with [text], which takes the
+  /// style of the text before [start].
+  ///
+  /// Throws an [ArgumentError] if the range is out of bounds or splits a code
+  /// point or placeholder.
+  void replace(int start, int end, String text) {
+    final (textPtr, length) = text._toNativeUtf8WithLength();
+    try {
+      if (!sk_paragraph_editor_replace(
+        _ptr,
+        start,
+        end,
+        textPtr.cast(),
+        length,
+      )) {
+        throw ArgumentError('Invalid range $start..$end');
+      }
+    } finally {
+      ffi.malloc.free(textPtr);
+    }
+  }
+
+  /// Lays out the blocks edited since the last layout, or all blocks if
+  /// [width] changed, and returns how many were laid out.
+  int layout(double width) => sk_paragraph_editor_layout(_ptr, width);
+
+  double get height => sk_paragraph_editor_get_height(_ptr);
+
+  double get longestLine => sk_paragraph_editor_get_longest_line(_ptr);
+
+  int get lineCount => sk_paragraph_editor_get_line_count(_ptr);
+
+  void paint(SkCanvas canvas, double x, double y) {
+    sk_paragraph_editor_paint(_ptr, canvas._ptr, x, y);
+  }
+
+  /// Returns the UTF-8 position closest to the provided coordinate, with the
+  /// top left corner as the origin, and +y direction as down.
+  SkParagraphPositionWithAffinity getGlyphPositionAtCoordinate(
+    double dx,
+    double dy,
+  ) {
+    return SkParagraphPositionWithAffinity._fromNative(
+      sk_paragraph_editor_get_glyph_position_at_coordinate(_ptr, dx, dy),
+    );
+  }
+
+  /// Returns a list of bounding boxes that enclose all text between the UTF-8
+  /// offsets [start] and [end].
+  List<SkParagraphTextBox> getRectsForRange(
+    int start,
+    int end, {
+    SkParagraphRectHeightStyle rectHeightStyle =
+        SkParagraphRectHeightStyle.tight,
+    SkParagraphRectWidthStyle rectWidthStyle = SkParagraphRectWidthStyle.tight,
+  }) {
+    final count = sk_paragraph_editor_get_rects_for_range(
+      _ptr,
+      start,
+      end,
+      rectHeightStyle._value,
+      rectWidthStyle._value,
+      nullptr,
+    );
+    if (count == 0) {
+      return const [];
+    }
+    final boxesPtr = ffi.calloc<sk_paragraph_text_box_t>(count);
+    try {
+      sk_paragraph_editor_get_rects_for_range(
+        _ptr,
+        start,
+        end,
+        rectHeightStyle._value,
+        rectWidthStyle._value,
+        boxesPtr,
+      );
+      return List.generate(
+        count,
+        (index) => SkParagraphTextBox._fromNative((boxesPtr + index).ref),
+        growable: false,
+      );
+    } finally {
+      ffi.calloc.free(boxesPtr);
+    }
+  }
+
+  @override
+  void dispose() {
+    _dispose(sk_paragraph_editor_delete, _finalizer);
+  }
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<
+      NativeFunction<Void Function(Pointer<sk_paragraph_editor_t>)>
+    >
+    ptr = Native.addressOf(sk_paragraph_editor_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
@@ -0,0 +1,122 @@
+part of '../skia_dart_library.dart';
+
+/// Counters of an [SkParagraphLayoutCache].
+class SkParagraphLayoutCacheStats {
+  const SkParagraphLayoutCacheStats({
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+    required this.bytes,
+    required this.entryCount,
+  });
+
+  final int hits;
+  final int misses;
+  final int evictions;
+
+  /// Estimated bytes held by the cached layouts.
+  final int bytes;
+  final int entryCount;
+
+  /// The fraction of lookups that were hits, or 0 before the first lookup.
+  double get hitRate {
+    final lookups = hits + misses;
+    return lookups == 0 ? 0 : hits / lookups;
+  }
+
+  @override
+  String toString() =>
+      'SkParagraphLayoutCacheStats(hits: $hits, misses: $misses, '
+      'evictions: $evictions, bytes: $bytes, entryCount: $entryCount)';
+}
+
+/// A cache of laid out paragraphs with a byte budget.
+///
+/// Entries are keyed by everything given to an [SkParagraphBuilder] (the
+/// text, the sequence of pushed styles and placeholders, the paragraph style,
+/// the font collection and the unicode instance) together with the layout
+/// width. A hit skips shaping and line breaking: the returned paragraph shares
+/// the cached layout until it is laid out at another width or marked dirty.
+///
+/// Least recently used entries are evicted once the estimated size of the
+/// cached layouts exceeds the budget. [SkFontCollection.clearCaches] evicts
+/// the entries shaped with that collection from every cache.
+///
+/// Paragraphs returned by one cache may share native state and must stay on
+/// the isolate that created the cache.
+class SkParagraphLayoutCache with _NativeMixin<sk_paragraph_layout_cache_t> {
+  SkParagraphLayoutCache({required int byteBudget})
+    : this._(
+        sk_paragraph_layout_cache_new(
+          RangeError.checkNotNegative(byteBudget, 'byteBudget'),
+        ),
+      );
+
+  SkParagraphLayoutCache._(Pointer<sk_paragraph_layout_cache_t> ptr) {
+    _attach(ptr, _finalizer);
+  }
+
+  /// Returns the paragraph [builder] would build, laid out at [width].
+  ///
+  /// Unlike [SkParagraphBuilder.build], the builder is left unchanged.
+  ///
+  /// Throws an [ArgumentError] unless [builder] was created with
+  /// `recordInputs: true`.
+  SkParagraph build(SkParagraphBuilder builder, double width) {
+    final ptr = sk_paragraph_layout_cache_build(_ptr, builder._ptr, width);
+    if (ptr == nullptr) {
+      throw ArgumentError.value(builder, 'builder', 'must record its inputs');
+    }
+    return SkParagraph._(ptr);
+  }
+
+  /// The maximum estimated number of bytes held by the cache.
+  ///
+  /// Lowering the budget evicts entries right away.
+  int get byteBudget => sk_paragraph_layout_cache_get_budget(_ptr);
+
+  set byteBudget(int value) {
+    RangeError.checkNotNegative(value, 'byteBudget');
+    sk_paragraph_layout_cache_set_budget(_ptr, value);
+  }
+
+  /// Evicts all entries.
+  void purge() {
+    sk_paragraph_layout_cache_purge(_ptr);
+  }
+
+  SkParagraphLayoutCacheStats get stats {
+    final ptr = _statsPtr;
+    sk_paragraph_layout_cache_get_stats(_ptr, ptr);
+    final stats = ptr.ref;
+    return SkParagraphLayoutCacheStats(
+      hits: stats.hits,
+      misses: stats.misses,
+      evictions: stats.evictions,
+      bytes: stats.bytes,
+      entryCount: stats.entry_count,
+    );
+  }
+
+  /// Resets the hit, miss and eviction counters.
+  void resetStats() {
+    sk_paragraph_layout_cache_reset_stats(_ptr);
+  }
+
+  @override
+  void dispose() {
+    _dispose(sk_paragraph_layout_cache_delete, _finalizer);
+  }
+
+  static final _statsPtr = ffi.calloc<sk_paragraph_layout_cache_stats_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<
+      NativeFunction<Void Function(Pointer<sk_paragraph_layout_cache_t>)>
+    >
+    ptr = Native.addressOf(sk_paragraph_layout_cache_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
@@ -35,14 +35,30 @@ class SkPictureRecorder with _NativeMixin<sk_picture_recorder_t> {
   /// hint for the bounds of the picture; recorded commands outside this
   /// rectangle may be discarded.
   ///
+  /// If [useRTree] is true, the recorded picture carries an R-tree of its
+  /// draw bounds, so that playback into a clipped canvas (for example
+  /// [SkPicture.playbackTiled]) skips commands outside the clip.
+  ///
   /// Any canvas returned by a previous call to [beginRecording] becomes
   /// invalid.
-  SkCanvas beginRecording(SkRect cullRect) {
+  SkCanvas beginRecording(SkRect cullRect, {bool useRTree = false}) {
     _canvas?.__ptr = nullptr;
-    final ptr = sk_picture_recorder_begin_recording(
-      _ptr,
-      cullRect.toNativePooled(0),
-    );
+    final Pointer<sk_canvas_t> ptr;
+    if (useRTree) {
+      // The factory is only used to create the R-tree when recording begins.
+      final factory = sk_rtree_factory_new();
+      ptr = sk_picture_recorder_begin_recording_with_bbh_factory(
+        _ptr,
+        cullRect.toNativePooled(0),
+        factory.cast(),
+      );
+      sk_rtree_factory_delete(factory);
+    } else {
+      ptr = sk_picture_recorder_begin_recording(
+        _ptr,
+        cullRect.toNativePooled(0),
+      );
+    }
     final canvas = SkCanvas._(ptr, this);
     _canvas = canvas;
     return canvas;
@@ -260,6 +276,108 @@ class SkPicture with _NativeMixin<sk_picture_t> {
   /// [SkCanvas.drawPicture] instead.
   void playback(SkCanvas canvas) => sk_picture_playback(_ptr, canvas._ptr);
 
+  /// Replays the drawing commands into [pixmap] using multiple threads.
+  ///
+  /// The pixmap is divided into [tileWidth] x [tileHeight] tiles which are
+  /// rasterized concurrently on up to [maxThreads] threads, including the
+  /// calling one. If [maxThreads] is 0, all available worker threads are used.
+  /// Each tile is drawn in the coordinate space of the whole pixmap and only
+  /// limited by its clip, so the output is identical to calling [playback] on
+  /// a raster canvas wrapping [pixmap].
+  ///
+  /// Pictures recorded with `useRTree: true` only replay the commands that
+  /// intersect each tile, which makes tiling considerably cheaper for large
+  /// pictures.
+  ///
+  /// If [matrix] is provided, the picture is transformed by it before drawing.
+  ///
+  /// Returns false if [pixmap] has no pixels or a color type that can not be
+  /// drawn into.
+  bool playbackTiled(
+    SkPixmap pixmap, {
+    Matrix3? matrix,
+    int tileWidth = 256,
+    int tileHeight = 256,
+    int maxThreads = 0,
+  }) {
+    RangeError.checkValueInInterval(tileWidth, 1, 1 << 30, 'tileWidth');
+    RangeError.checkValueInInterval(tileHeight, 1, 1 << 30, 'tileHeight');
+    return sk_picture_playback_tiled(
+      _ptr,
+      pixmap._ptr,
+      matrix?.toNativePooled(0) ?? nullptr,
+      tileWidth,
+      tileHeight,
+      maxThreads,
+    );
+  }
+
+  /// Plays the picture back into bands of [bandHeight] rows, cleared to
+  /// [background], and writes each band to [encoder] before finishing it.
+  ///
+  /// The image has the encoder's size. Only two bands are held in memory at
+  /// a time, since the next band is drawn on a worker thread while the
+  /// previous one is encoded, so images far larger than could be rasterized
+  /// at once can be written. Pictures recorded with `useRTree: true` only
+  /// replay the commands that intersect each band.
+  ///
+  /// Returns null if [encoder] has already been written to, or drawing or
+  /// encoding fails.
+  SkStripRenderStats? renderInStrips(
+    SkRowEncoder encoder, {
+    int bandHeight = 256,
+    SkColor background = SkColors.transparent,
+  }) {
+    RangeError.checkValueInInterval(bandHeight, 1, 1 << 30, 'bandHeight');
+    final stats = _statsPtr;
+    if (!sk_picture_render_in_strips(
+      _ptr,
+      bandHeight,
+      background.value,
+      encoder._ptr,
+      stats,
+    )) {
+      return null;
+    }
+    return SkStripRenderStats._fromNative(stats.ref);
+  }
+
+  /// Computes the area of a [deviceBounds] sized surface that has to be
+  /// redrawn when this picture replaces [previous].
+  ///
+  /// Both pictures are compared op by op, using each op's device bounds,
+  /// paint, matrix and clip along with the ids of the images, text blobs,
+  /// paths and vertices it draws. Playing this picture back clipped to the
+  /// returned region over the pixels produced by [previous] yields the same
+  /// result as a full repaint.
+  ///
+  /// The result is conservative: content that is equivalent but uses
+  /// different objects (for example, a shader that is recreated every frame)
+  /// is reported as damaged. If [previous] is null, the whole [deviceBounds]
+  /// is damaged.
+  ///
+  /// The equivalence to a full repaint only holds if this picture paints an
+  /// opaque background over the damaged area, for example by starting with
+  /// [SkCanvas.clear]. Pixels it draws translucently, or leaves unpainted,
+  /// keep stale content from [previous] when repainting only the damage.
+  ///
+  /// If [matrix] is provided, it is applied to both pictures.
+  SkRegion computeDamage(
+    SkPicture? previous, {
+    required SkIRect deviceBounds,
+    Matrix3? matrix,
+  }) {
+    final damage = SkRegion();
+    sk_picture_compute_damage(
+      previous?._ptr ?? nullptr,
+      _ptr,
+      matrix?.toNativePooled(0) ?? nullptr,
+      deviceBounds.toNativePooled(0),
+      damage._ptr,
+    );
+    return damage;
+  }
+
   /// Creates a shader that draws with this picture.
   ///
   /// - [tmx]: The tiling mode in the x-direction.
@@ -295,6 +413,8 @@ class SkPicture with _NativeMixin<sk_picture_t> {
     _dispose(sk_picture_unref, _finalizer);
   }
 
+  static final _statsPtr = ffi.calloc<sk_strip_render_stats_t>();
+
   static final _finalizer = _createFinalizer();
 
   static NativeFinalizer _createFinalizer() {
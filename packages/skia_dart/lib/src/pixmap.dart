@@ -353,6 +353,55 @@ class SkPixmap with _NativeMixin<sk_pixmap_t> {
     );
   }
 
+  /// Compares the pixels with [other] channel by channel, in native code.
+  ///
+  /// Both pixmaps must have the same size and the same 32-bit color type with
+  /// 8-bit channels, such as [SkColorType.rgba8888]. A pixel differs if any
+  /// channel differs by more than [tolerance]. Alpha is not compared if
+  /// [ignoreAlpha] is true.
+  ///
+  /// If [diffMask] is given it must be an [SkColorType.alpha8] or
+  /// [SkColorType.gray8] pixmap of the same size, which receives a
+  /// visualization of the differences chosen by [diffMode].
+  ///
+  /// Returns null if the pixmaps cannot be compared.
+  SkPixmapCompareResult? compare(
+    SkPixmap other, {
+    int tolerance = 0,
+    bool ignoreAlpha = false,
+    SkPixmap? diffMask,
+    SkPixmapDiffMode diffMode = SkPixmapDiffMode.mask,
+  }) {
+    _compareOptionsPtr.ref
+      ..fIgnoreAlpha = ignoreAlpha
+      ..fDiffModeAsInt = diffMode._value.value;
+    if (!sk_pixmap_compare(
+      _ptr,
+      other._ptr,
+      tolerance,
+      _compareOptionsPtr,
+      _compareStatsPtr,
+      diffMask?._ptr ?? nullptr,
+    )) {
+      return null;
+    }
+    final stats = _compareStatsPtr.ref;
+    final bounds = stats.fBounds;
+    return SkPixmapCompareResult._(
+      maxDelta: stats.fMaxDelta,
+      differentPixels: stats.fDifferentPixels,
+      bounds: SkIRect.fromLTRB(
+        bounds.left,
+        bounds.top,
+        bounds.right,
+        bounds.bottom,
+      ),
+    );
+  }
+
+  static final _compareOptionsPtr = ffi.calloc<sk_pixmap_compare_options_t>();
+  static final _compareStatsPtr = ffi.calloc<sk_pixmap_compare_stats_t>();
+
   static final _finalizer = _createFinalizer();
 
   static NativeFinalizer _createFinalizer() {
@@ -361,3 +410,41 @@ class SkPixmap with _NativeMixin<sk_pixmap_t> {
     return NativeFinalizer(ptr.cast());
   }
 }
+
+/// What [SkPixmap.compare] writes to its diff mask.
+enum SkPixmapDiffMode {
+  /// 255 where a pixel differs by more than the tolerance, 0 elsewhere.
+  mask(sk_pixmap_diff_mode_t.MASK_SK_PIXMAP_DIFF_MODE),
+
+  /// The largest channel delta of each pixel.
+  delta(sk_pixmap_diff_mode_t.DELTA_SK_PIXMAP_DIFF_MODE);
+
+  const SkPixmapDiffMode(this._value);
+  final sk_pixmap_diff_mode_t _value;
+}
+
+/// The outcome of [SkPixmap.compare].
+class SkPixmapCompareResult {
+  const SkPixmapCompareResult._({
+    required this.maxDelta,
+    required this.differentPixels,
+    required this.bounds,
+  });
+
+  /// The largest difference of any compared channel, even if within the
+  /// tolerance.
+  final int maxDelta;
+
+  /// Number of pixels with a channel differing by more than the tolerance.
+  final int differentPixels;
+
+  /// The smallest rectangle holding every differing pixel, empty if none.
+  final SkIRect bounds;
+
+  bool get matches => differentPixels == 0;
+
+  @override
+  String toString() =>
+      'SkPixmapCompareResult(maxDelta: $maxDelta, '
+      'differentPixels: $differentPixels, bounds: $bounds)';
+}
@@ -1,11 +1,20 @@
 part of 'skia_dart_library.dart';
 
-class RunLoop {
+class RunLoop implements Finalizable {
   RunLoop._() {
     sk_run_loop_initialize(NativeApi.initializeApiDLData);
     _port = RawReceivePort(_onMessage);
+    // Native finalizers run when the isolate shuts down, which drops objects
+    // queued for a message that will never be handled.
+    _shutdownFinalizer.attach(this, Pointer.fromAddress(handle));
   }
 
+  static final _shutdownFinalizer = NativeFinalizer(
+    Native.addressOf<NativeFunction<Void Function(Pointer<Void>)>>(
+      sk_run_loop_shutdown,
+    ).cast(),
+  );
+
   static final instance = RunLoop._();
 
   int get handle => _port.sendPort.nativePort;
@@ -22,12 +31,28 @@ class RunLoop {
             callbackAddress,
           );
       final data = Pointer<Void>.fromAddress(dataAddress);
-      callback.asFunction<void Function(Pointer<Void>)>(isLeaf: true)(data);
+      // Not a leaf call: completions of async tasks call back into Dart.
+      callback.asFunction<void Function(Pointer<Void>)>()(data);
     } else {
       throw StateError('Unexpected message type: ${message.runtimeType}');
     }
   }
 
+  /// Destroys objects owned by this isolate whose destruction is still
+  /// queued.
+  ///
+  /// Objects that must be destroyed on this isolate (such as GPU-backed
+  /// images and surfaces) but are released elsewhere are queued and destroyed
+  /// together when the isolate handles the next run loop message. Flushing
+  /// releases them right away, for example before submitting GPU work.
+  void flush() {
+    sk_run_loop_flush(handle);
+  }
+
+  /// The number of objects owned by this isolate whose destruction is queued.
+  @visibleForTesting
+  int get pendingDestroyCount => sk_run_loop_get_pending_destroy_count(handle);
+
   @visibleForTesting
   // ignore: library_private_types_in_public_api
   int? getObjectHandle(_NativeMixin object) {
@@ -669,6 +669,33 @@ class SkShaper with _NativeMixin<sk_shaper_t> {
     return SkShaper._(ptr);
   }
 
+  /// Creates a HarfBuzz shaper that shapes then wraps, reusing shaped words
+  /// from [cache].
+  ///
+  /// Text is split into words at spaces and at font, script, language and
+  /// bidi run boundaries, and each word is shaped on its own, so kerning and
+  /// ligatures across word boundaries are lost. Lines only break at spaces.
+  /// Text with right-to-left runs, hard line breaks or [shape] features is
+  /// shaped like [harfbuzzShapeThenWrap] and does not use the cache.
+  ///
+  /// The shaper keeps [cache] alive, even if it is disposed; several shapers
+  /// may share one cache.
+  ///
+  /// Returns null if HarfBuzz support is not available.
+  static SkShaper? harfbuzzCachedShapeThenWrap(
+    SkUnicode unicode,
+    SkShapingCache cache, {
+    SkFontMgr? fallback,
+  }) {
+    final ptr = sk_shaper_new_hb_cached_shape_then_wrap(
+      unicode._ptr,
+      fallback?._ptr ?? nullptr,
+      cache._ptr,
+    );
+    if (ptr == nullptr) return null;
+    return SkShaper._(ptr);
+  }
+
   /// Creates a HarfBuzz shaper that doesn't wrap or reorder.
   ///
   /// Returns null if HarfBuzz support is not available.
@@ -739,6 +766,45 @@ class SkShaper with _NativeMixin<sk_shaper_t> {
     }
   }
 
+  /// Shapes [texts] into [buffer] in a single native call, replacing its
+  /// previous contents.
+  ///
+  /// Unlike [shape], no run handler is called back per line or run, which
+  /// makes shaping many short strings much cheaper. Each text is shaped with
+  /// its own font, direction and width, with font fallback, bidi, script and
+  /// language runs chosen by the shaper.
+  void shapeToBuffer(List<SkShaperText> texts, SkShaperBuffer buffer) {
+    final bytes = BytesBuilder(copy: false);
+    final lengths = List<int>.filled(texts.length, 0);
+    for (var i = 0; i < texts.length; i++) {
+      final units = utf8.encode(texts[i].text);
+      lengths[i] = units.length;
+      bytes.add(units);
+    }
+    // Both allocations are at least one element so that none is zero sized.
+    final textsPtr = ffi.calloc<sk_shaper_buffer_text_t>(texts.length + 1);
+    final utf8Ptr = ffi.malloc<Uint8>(bytes.length + 1);
+    try {
+      utf8Ptr.asTypedList(bytes.length).setAll(0, bytes.takeBytes());
+      var offset = 0;
+      for (var i = 0; i < texts.length; i++) {
+        final text = texts[i];
+        final native = (textsPtr + i).ref;
+        native.fUtf8 = (utf8Ptr + offset).cast();
+        native.fUtf8Bytes = lengths[i];
+        native.fFont = text.font._ptr;
+        native.fLeftToRight = text.leftToRight;
+        native.fWidth = text.width;
+        offset += lengths[i];
+      }
+      sk_shaper_shape_to_buffer(_ptr, textsPtr, texts.length, buffer._ptr);
+    } finally {
+      ffi.calloc.free(textsPtr);
+      ffi.malloc.free(utf8Ptr);
+    }
+    buffer._update();
+  }
+
   @override
   void dispose() {
     _dispose(sk_shaper_delete, _finalizer);
@@ -746,7 +812,8 @@ class SkShaper with _NativeMixin<sk_shaper_t> {
 
   /// Purges HarfBuzz caches.
   ///
-  /// Call this to free memory used by HarfBuzz shape caches.
+  /// Call this to free memory used by HarfBuzz shape caches. Every
+  /// [SkShapingCache] is purged as well.
   static void harfBuzzPurgeCaches() {
     sk_shaper_hb_purge_caches();
   }
@@ -0,0 +1,187 @@
+part of 'skia_dart_library.dart';
+
+/// A text to shape with [SkShaper.shapeToBuffer].
+class SkShaperText {
+  const SkShaperText(
+    this.text, {
+    required this.font,
+    this.width = double.infinity,
+    this.leftToRight = true,
+  });
+
+  final String text;
+  final SkFont font;
+
+  /// The line width to wrap at.
+  final double width;
+  final bool leftToRight;
+}
+
+/// A run of glyphs in an [SkShaperBuffer] with one font and bidi level.
+class SkShaperBufferRun {
+  const SkShaperBufferRun({
+    required this.glyphOffset,
+    required this.glyphCount,
+    required this.utf8Begin,
+    required this.utf8End,
+    required this.fontIndex,
+    required this.advanceX,
+    required this.bidiLevel,
+  });
+
+  /// The index of the run's first glyph in [SkShaperBuffer.glyphs].
+  final int glyphOffset;
+  final int glyphCount;
+
+  /// The UTF-8 range of the run in its text.
+  final int utf8Begin;
+  final int utf8End;
+
+  /// The index of the run's font, see [SkShaperBuffer.font].
+  final int fontIndex;
+  final double advanceX;
+  final int bidiLevel;
+}
+
+/// A line of runs in an [SkShaperBuffer].
+///
+/// The lines of each text are stacked from y = 0.
+class SkShaperBufferLine {
+  const SkShaperBufferLine({
+    required this.text,
+    required this.runOffset,
+    required this.runCount,
+    required this.top,
+    required this.baseline,
+    required this.bottom,
+    required this.width,
+  });
+
+  /// The index of the line's text in the shaped batch.
+  final int text;
+
+  /// The index of the line's first run, see [SkShaperBuffer.run].
+  final int runOffset;
+  final int runCount;
+  final double top;
+
+  /// The y of the glyph origins.
+  final double baseline;
+  final double bottom;
+  final double width;
+}
+
+/// The glyphs of a batch of texts shaped by [SkShaper.shapeToBuffer].
+///
+/// Glyph ids, positions and clusters of all texts are stored in flat native
+/// arrays that [glyphs], [positions] and [clusters] view without copying.
+/// The views and fonts are only valid until the buffer is shaped into again
+/// or disposed. Reusing one buffer for every batch reuses its storage.
+class SkShaperBuffer with _NativeMixin<sk_shaper_buffer_t> {
+  SkShaperBuffer() : this._(sk_shaper_buffer_new());
+
+  SkShaperBuffer._(Pointer<sk_shaper_buffer_t> ptr) {
+    _attach(ptr, _finalizer);
+    _update();
+  }
+
+  Uint16List _glyphs = Uint16List(0);
+  Float32List _positions = Float32List(0);
+  Uint32List _clusters = Uint32List(0);
+  Pointer<sk_shaper_buffer_run_t> _runs = nullptr;
+  Pointer<sk_shaper_buffer_line_t> _lines = nullptr;
+  int _runCount = 0;
+  int _lineCount = 0;
+  int _fontCount = 0;
+
+  /// The glyph ids of all texts.
+  Uint16List get glyphs => _glyphs;
+
+  /// The x and y of each glyph, interleaved, relative to its text's origin.
+  Float32List get positions => _positions;
+
+  /// The UTF-8 offset of each glyph's cluster in its text.
+  Uint32List get clusters => _clusters;
+
+  int get runCount => _runCount;
+
+  SkShaperBufferRun run(int index) {
+    RangeError.checkValidIndex(index, this, 'index', _runCount);
+    final run = (_runs + index).ref;
+    return SkShaperBufferRun(
+      glyphOffset: run.fGlyphOffset,
+      glyphCount: run.fGlyphCount,
+      utf8Begin: run.fUtf8Begin,
+      utf8End: run.fUtf8End,
+      fontIndex: run.fFontIndex,
+      advanceX: run.fAdvanceX,
+      bidiLevel: run.fBidiLevel,
+    );
+  }
+
+  int get lineCount => _lineCount;
+
+  SkShaperBufferLine line(int index) {
+    RangeError.checkValidIndex(index, this, 'index', _lineCount);
+    final line = (_lines + index).ref;
+    return SkShaperBufferLine(
+      text: line.fText,
+      runOffset: line.fRunOffset,
+      runCount: line.fRunCount,
+      top: line.fTop,
+      baseline: line.fBaseline,
+      bottom: line.fBottom,
+      width: line.fWidth,
+    );
+  }
+
+  int get fontCount => _fontCount;
+
+  /// Returns a copy of the font with index [index].
+  SkFont font(int index) {
+    RangeError.checkValidIndex(index, this, 'index', _fontCount);
+    return SkFont._(sk_font_clone(sk_shaper_buffer_get_font(_ptr, index)));
+  }
+
+  void _update() {
+    final ptr = _dataPtr;
+    sk_shaper_buffer_get_data(_ptr, ptr);
+    final data = ptr.ref;
+    final glyphCount = data.fGlyphCount;
+    if (glyphCount == 0) {
+      _glyphs = Uint16List(0);
+      _positions = Float32List(0);
+      _clusters = Uint32List(0);
+    } else {
+      _glyphs = data.fGlyphs.asTypedList(glyphCount);
+      _positions = data.fPositions.cast<Float>().asTypedList(glyphCount * 2);
+      _clusters = data.fClusters.asTypedList(glyphCount);
+    }
+    _runs = data.fRuns;
+    _runCount = data.fRunCount;
+    _lines = data.fLines;
+    _lineCount = data.fLineCount;
+    _fontCount = data.fFontCount;
+  }
+
+  @override
+  void dispose() {
+    _glyphs = Uint16List(0);
+    _positions = Float32List(0);
+    _clusters = Uint32List(0);
+    _runCount = 0;
+    _lineCount = 0;
+    _fontCount = 0;
+    _dispose(sk_shaper_buffer_delete, _finalizer);
+  }
+
+  static final _dataPtr = ffi.calloc<sk_shaper_buffer_data_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<NativeFunction<Void Function(Pointer<sk_shaper_buffer_t>)>>
+    ptr = Native.addressOf(sk_shaper_buffer_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
@@ -0,0 +1,99 @@
+part of 'skia_dart_library.dart';
+
+/// Counters of an [SkShapingCache].
+class SkShapingCacheStats {
+  const SkShapingCacheStats({
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+    required this.bytes,
+    required this.entryCount,
+  });
+
+  final int hits;
+  final int misses;
+  final int evictions;
+
+  /// Estimated bytes held by the cached words.
+  final int bytes;
+  final int entryCount;
+
+  /// The fraction of lookups that were hits, or 0 if there were none.
+  double get hitRate {
+    final lookups = hits + misses;
+    return lookups == 0 ? 0 : hits / lookups;
+  }
+
+  @override
+  String toString() =>
+      'SkShapingCacheStats(hits: $hits, misses: $misses, '
+      'evictions: $evictions, bytes: $bytes, entryCount: $entryCount)';
+}
+
+/// A cache of shaped words with a byte budget, used by
+/// [SkShaper.harfbuzzCachedShapeThenWrap].
+///
+/// Entries are keyed by the word's text, the font (typeface, size and flags),
+/// the script, the language and the bidi level. Least recently used entries
+/// are evicted once the budget is exceeded. [SkShaper.harfBuzzPurgeCaches]
+/// purges every cache.
+class SkShapingCache with _NativeMixin<sk_shaping_cache_t> {
+  SkShapingCache({required int byteBudget})
+    : this._(
+        sk_shaping_cache_new(
+          RangeError.checkNotNegative(byteBudget, 'byteBudget'),
+        ),
+      );
+
+  SkShapingCache._(Pointer<sk_shaping_cache_t> ptr) {
+    _attach(ptr, _finalizer);
+  }
+
+  /// The maximum number of bytes held by the cache.
+  ///
+  /// Lowering the budget evicts entries right away.
+  int get byteBudget => sk_shaping_cache_get_budget(_ptr);
+
+  set byteBudget(int value) {
+    RangeError.checkNotNegative(value, 'byteBudget');
+    sk_shaping_cache_set_budget(_ptr, value);
+  }
+
+  /// Evicts all entries.
+  void purge() {
+    sk_shaping_cache_purge(_ptr);
+  }
+
+  SkShapingCacheStats get stats {
+    final ptr = _statsPtr;
+    sk_shaping_cache_get_stats(_ptr, ptr);
+    final stats = ptr.ref;
+    return SkShapingCacheStats(
+      hits: stats.fHits,
+      misses: stats.fMisses,
+      evictions: stats.fEvictions,
+      bytes: stats.fBytes,
+      entryCount: stats.fEntryCount,
+    );
+  }
+
+  /// Resets the hit, miss and eviction counters.
+  void resetStats() {
+    sk_shaping_cache_reset_stats(_ptr);
+  }
+
+  @override
+  void dispose() {
+    _dispose(sk_shaping_cache_delete, _finalizer);
+  }
+
+  static final _statsPtr = ffi.calloc<sk_shaping_cache_stats_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<NativeFunction<Void Function(Pointer<sk_shaping_cache_t>)>>
+    ptr = Native.addressOf(sk_shaping_cache_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
@@ -1359,6 +1359,21 @@ external ffi.Pointer<sk_image_t> sk_codecs_deferred_image(
   ffi.Pointer<ffi.UnsignedInt> alphaType,
 );
 
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_codec_decode_request_t>,
+    ffi.Pointer<sk_codec_decode_result_t>,
+    ffi.Size,
+    ffi.Int,
+  )
+>(isLeaf: true)
+external void sk_codec_decode_batch(
+  ffi.Pointer<sk_codec_decode_request_t> requests,
+  ffi.Pointer<sk_codec_decode_result_t> results,
+  int count,
+  int max_threads,
+);
+
 @ffi.Native<ffi.Void Function()>(isLeaf: true)
 external void sk_graphics_init();
 
@@ -1653,6 +1668,28 @@ external ffi.Pointer<sk_data_t> sk_typeface_copy_table_data(
   int tag,
 );
 
+@ffi.Native<
+  ffi.Pointer<sk_data_t> Function(
+    ffi.Pointer<sk_typeface_t>,
+    sk_font_table_tag_t,
+    ffi.Pointer<ffi.Bool>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_data_t> sk_typeface_ref_table_data(
+  ffi.Pointer<sk_typeface_t> typeface,
+  int tag,
+  ffi.Pointer<ffi.Bool> borrowed,
+);
+
+@ffi.Native<ffi.Size Function()>(isLeaf: true)
+external int sk_typeface_get_table_cache_budget();
+
+@ffi.Native<ffi.Void Function(ffi.Size)>(isLeaf: true)
+external void sk_typeface_set_table_cache_budget(int bytes);
+
+@ffi.Native<ffi.Void Function()>(isLeaf: true)
+external void sk_typeface_purge_table_cache();
+
 @ffi.Native<ffi.Int Function(ffi.Pointer<sk_typeface_t>)>(isLeaf: true)
 external int sk_typeface_get_units_per_em(
   ffi.Pointer<sk_typeface_t> typeface,
@@ -1891,6 +1928,21 @@ external ffi.Pointer<sk_fontmgr_t> sk_fontmgr_create_fontconfig(
   ffi.Pointer<ffi.Void> config,
 );
 
+@ffi.Native<
+  ffi.Pointer<sk_fontmgr_t> Function(
+    ffi.Pointer<ffi.Pointer<ffi.Char>>,
+    ffi.Size,
+    ffi.Pointer<ffi.Char>,
+    ffi.Pointer<sk_fontmgr_index_info_t>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_fontmgr_t> sk_fontmgr_create_indexed(
+  ffi.Pointer<ffi.Pointer<ffi.Char>> directories,
+  int directoryCount,
+  ffi.Pointer<ffi.Char> index_path,
+  ffi.Pointer<sk_fontmgr_index_info_t> info,
+);
+
 @ffi.Native<
   ffi.Pointer<sk_fontstyle_t> Function(ffi.Int, ffi.Int, ffi.UnsignedInt)
 >(symbol: 'sk_fontstyle_new', isLeaf: true)
@@ -3086,6 +3138,99 @@ external bool sk_icu_set_data(
   ffi.Pointer<ffi.Void> data,
 );
 
+@ffi.Native<ffi.Pointer<sk_unicode_analysis_t> Function()>(isLeaf: true)
+external ffi.Pointer<sk_unicode_analysis_t> sk_unicode_analysis_new();
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_unicode_analysis_t>)>(
+  isLeaf: true,
+)
+external void sk_unicode_analysis_delete(
+  ffi.Pointer<sk_unicode_analysis_t> analysis,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_unicode_analysis_t>,
+    ffi.Pointer<sk_unicode_analysis_data_t>,
+  )
+>(isLeaf: true)
+external void sk_unicode_analysis_get_data(
+  ffi.Pointer<sk_unicode_analysis_t> analysis,
+  ffi.Pointer<sk_unicode_analysis_data_t> data,
+);
+
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_unicode_t>,
+    ffi.Pointer<sk_unicode_analysis_text_t>,
+    ffi.Size,
+    ffi.Pointer<sk_unicode_analysis_cache_t>,
+    ffi.Int,
+    ffi.Pointer<sk_unicode_analysis_t>,
+  )
+>(isLeaf: true)
+external bool sk_unicode_analyze(
+  ffi.Pointer<sk_unicode_t> unicode,
+  ffi.Pointer<sk_unicode_analysis_text_t> texts,
+  int count,
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+  int max_threads,
+  ffi.Pointer<sk_unicode_analysis_t> analysis,
+);
+
+@ffi.Native<ffi.Pointer<sk_unicode_analysis_cache_t> Function(ffi.Size)>(
+  isLeaf: true,
+)
+external ffi.Pointer<sk_unicode_analysis_cache_t>
+sk_unicode_analysis_cache_new(int byte_budget);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_unicode_analysis_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_unicode_analysis_cache_delete(
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+);
+
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_unicode_analysis_cache_t>)>(
+  isLeaf: true,
+)
+external int sk_unicode_analysis_cache_get_budget(
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Void Function(ffi.Pointer<sk_unicode_analysis_cache_t>, ffi.Size)
+>(isLeaf: true)
+external void sk_unicode_analysis_cache_set_budget(
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+  int byte_budget,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_unicode_analysis_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_unicode_analysis_cache_purge(
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_unicode_analysis_cache_t>,
+    ffi.Pointer<sk_unicode_analysis_cache_stats_t>,
+  )
+>(isLeaf: true)
+external void sk_unicode_analysis_cache_get_stats(
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+  ffi.Pointer<sk_unicode_analysis_cache_stats_t> stats,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_unicode_analysis_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_unicode_analysis_cache_reset_stats(
+  ffi.Pointer<sk_unicode_analysis_cache_t> cache,
+);
+
 @ffi.Native<ffi.Void Function(ffi.Pointer<sk_imagefilter_t>)>(isLeaf: true)
 external void sk_imagefilter_ref(
   ffi.Pointer<sk_imagefilter_t> cfilter,
@@ -5112,6 +5257,19 @@ external ffi.Pointer<sk_shaper_t> sk_shaper_new_hb_shape_then_wrap(
   ffi.Pointer<sk_fontmgr_t> fallback,
 );
 
+@ffi.Native<
+  ffi.Pointer<sk_shaper_t> Function(
+    ffi.Pointer<sk_unicode_t>,
+    ffi.Pointer<sk_fontmgr_t>,
+    ffi.Pointer<sk_shaping_cache_t>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_shaper_t> sk_shaper_new_hb_cached_shape_then_wrap(
+  ffi.Pointer<sk_unicode_t> unicode,
+  ffi.Pointer<sk_fontmgr_t> fallback,
+  ffi.Pointer<sk_shaping_cache_t> cache,
+);
+
 @ffi.Native<
   ffi.Pointer<sk_shaper_t> Function(
     ffi.Pointer<sk_unicode_t>,
@@ -5126,6 +5284,46 @@ external ffi.Pointer<sk_shaper_t> sk_shaper_new_hb_shape_dont_wrap_or_reorder(
 @ffi.Native<ffi.Void Function()>(isLeaf: true)
 external void sk_shaper_hb_purge_caches();
 
+@ffi.Native<ffi.Pointer<sk_shaping_cache_t> Function(ffi.Size)>(
+  isLeaf: true,
+)
+external ffi.Pointer<sk_shaping_cache_t> sk_shaping_cache_new(int byte_budget);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_shaping_cache_t>)>(isLeaf: true)
+external void sk_shaping_cache_delete(ffi.Pointer<sk_shaping_cache_t> cache);
+
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_shaping_cache_t>)>(isLeaf: true)
+external int sk_shaping_cache_get_budget(
+  ffi.Pointer<sk_shaping_cache_t> cache,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_shaping_cache_t>, ffi.Size)>(
+  isLeaf: true,
+)
+external void sk_shaping_cache_set_budget(
+  ffi.Pointer<sk_shaping_cache_t> cache,
+  int byte_budget,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_shaping_cache_t>)>(isLeaf: true)
+external void sk_shaping_cache_purge(ffi.Pointer<sk_shaping_cache_t> cache);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_shaping_cache_t>,
+    ffi.Pointer<sk_shaping_cache_stats_t>,
+  )
+>(isLeaf: true)
+external void sk_shaping_cache_get_stats(
+  ffi.Pointer<sk_shaping_cache_t> cache,
+  ffi.Pointer<sk_shaping_cache_stats_t> stats,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_shaping_cache_t>)>(isLeaf: true)
+external void sk_shaping_cache_reset_stats(
+  ffi.Pointer<sk_shaping_cache_t> cache,
+);
+
 @ffi.Native<ffi.Pointer<sk_shaper_t> Function()>(isLeaf: true)
 external ffi.Pointer<sk_shaper_t> sk_shaper_new_coretext();
 
@@ -5424,6 +5622,46 @@ external void sk_shaper_shape(
   ffi.Pointer<sk_shaper_run_handler_t> handler,
 );
 
+@ffi.Native<ffi.Pointer<sk_shaper_buffer_t> Function()>(isLeaf: true)
+external ffi.Pointer<sk_shaper_buffer_t> sk_shaper_buffer_new();
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_shaper_buffer_t>)>(isLeaf: true)
+external void sk_shaper_buffer_delete(ffi.Pointer<sk_shaper_buffer_t> buffer);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_shaper_t>,
+    ffi.Pointer<sk_shaper_buffer_text_t>,
+    ffi.Size,
+    ffi.Pointer<sk_shaper_buffer_t>,
+  )
+>(isLeaf: true)
+external void sk_shaper_shape_to_buffer(
+  ffi.Pointer<sk_shaper_t> shaper,
+  ffi.Pointer<sk_shaper_buffer_text_t> texts,
+  int count,
+  ffi.Pointer<sk_shaper_buffer_t> buffer,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_shaper_buffer_t>,
+    ffi.Pointer<sk_shaper_buffer_data_t>,
+  )
+>(isLeaf: true)
+external void sk_shaper_buffer_get_data(
+  ffi.Pointer<sk_shaper_buffer_t> buffer,
+  ffi.Pointer<sk_shaper_buffer_data_t> data,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_font_t> Function(ffi.Pointer<sk_shaper_buffer_t>, ffi.Size)
+>(isLeaf: true)
+external ffi.Pointer<sk_font_t> sk_shaper_buffer_get_font(
+  ffi.Pointer<sk_shaper_buffer_t> buffer,
+  int index,
+);
+
 @ffi.Native<ffi.Pointer<sk_data_t> Function()>(isLeaf: true)
 external ffi.Pointer<sk_data_t> sk_data_new_empty();
 
@@ -5525,6 +5763,163 @@ external ffi.Pointer<sk_data_t> sk_data_new_uninitialized(
   int size,
 );
 
+@ffi.Native<ffi.Pointer<sk_decoded_image_cache_t> Function(ffi.Size)>(
+  isLeaf: true,
+)
+external ffi.Pointer<sk_decoded_image_cache_t> sk_decoded_image_cache_new(
+  int byte_budget,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_decoded_image_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_decoded_image_cache_delete(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_image_t> Function(
+    ffi.Pointer<sk_decoded_image_cache_t>,
+    ffi.Pointer<sk_data_t>,
+    ffi.Int,
+    ffi.Int,
+    ffi.UnsignedInt,
+    ffi.Pointer<sk_colorspace_t>,
+  )
+>(symbol: 'sk_decoded_image_cache_get', isLeaf: true)
+external ffi.Pointer<sk_image_t> _sk_decoded_image_cache_get(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+  ffi.Pointer<sk_data_t> data,
+  int width,
+  int height,
+  int color_type,
+  ffi.Pointer<sk_colorspace_t> color_space,
+);
+
+ffi.Pointer<sk_image_t> sk_decoded_image_cache_get(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+  ffi.Pointer<sk_data_t> data,
+  int width,
+  int height,
+  sk_colortype_t color_type,
+  ffi.Pointer<sk_colorspace_t> color_space,
+) => _sk_decoded_image_cache_get(
+  cache,
+  data,
+  width,
+  height,
+  color_type.value,
+  color_space,
+);
+
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_decoded_image_cache_t>)>(
+  isLeaf: true,
+)
+external int sk_decoded_image_cache_get_budget(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Void Function(ffi.Pointer<sk_decoded_image_cache_t>, ffi.Size)
+>(isLeaf: true)
+external void sk_decoded_image_cache_set_budget(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+  int byte_budget,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_decoded_image_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_decoded_image_cache_purge(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_decoded_image_cache_t>,
+    ffi.Pointer<sk_decoded_image_cache_stats_t>,
+  )
+>(isLeaf: true)
+external void sk_decoded_image_cache_get_stats(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+  ffi.Pointer<sk_decoded_image_cache_stats_t> stats,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_decoded_image_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_decoded_image_cache_reset_stats(
+  ffi.Pointer<sk_decoded_image_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_row_encoder_t> Function(
+    ffi.Pointer<sk_wstream_t>,
+    ffi.Int,
+    ffi.Int,
+    ffi.Bool,
+    ffi.Pointer<sk_pngencoder_options_t>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_row_encoder_t> sk_row_encoder_new_png(
+  ffi.Pointer<sk_wstream_t> dst,
+  int width,
+  int height,
+  bool opaque,
+  ffi.Pointer<sk_pngencoder_options_t> options,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_row_encoder_t> Function(
+    ffi.Pointer<sk_wstream_t>,
+    ffi.Int,
+    ffi.Int,
+    ffi.Pointer<sk_jpegencoder_options_t>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_row_encoder_t> sk_row_encoder_new_jpeg(
+  ffi.Pointer<sk_wstream_t> dst,
+  int width,
+  int height,
+  ffi.Pointer<sk_jpegencoder_options_t> options,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_row_encoder_t>)>(isLeaf: true)
+external void sk_row_encoder_delete(ffi.Pointer<sk_row_encoder_t> encoder);
+
+@ffi.Native<ffi.Int Function(ffi.Pointer<sk_row_encoder_t>)>(isLeaf: true)
+external int sk_row_encoder_get_rows_written(
+  ffi.Pointer<sk_row_encoder_t> encoder,
+);
+
+@ffi.Native<
+  ffi.Bool Function(ffi.Pointer<sk_row_encoder_t>, ffi.Pointer<sk_pixmap_t>)
+>(isLeaf: true)
+external bool sk_row_encoder_write_rows(
+  ffi.Pointer<sk_row_encoder_t> encoder,
+  ffi.Pointer<sk_pixmap_t> rows,
+);
+
+@ffi.Native<ffi.Bool Function(ffi.Pointer<sk_row_encoder_t>)>(isLeaf: true)
+external bool sk_row_encoder_finish(ffi.Pointer<sk_row_encoder_t> encoder);
+
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_picture_t>,
+    ffi.Int,
+    sk_color_t,
+    ffi.Pointer<sk_row_encoder_t>,
+    ffi.Pointer<sk_strip_render_stats_t>,
+  )
+>(isLeaf: true)
+external bool sk_picture_render_in_strips(
+  ffi.Pointer<sk_picture_t> picture,
+  int band_height,
+  int background,
+  ffi.Pointer<sk_row_encoder_t> encoder,
+  ffi.Pointer<sk_strip_render_stats_t> stats,
+);
+
 @ffi.Native<ffi.Pointer<sk_rrect_t> Function()>(isLeaf: true)
 external ffi.Pointer<sk_rrect_t> sk_rrect_new();
 
@@ -9439,6 +9834,21 @@ external void sk_paragraph_layout(
   double width,
 );
 
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<ffi.Pointer<sk_paragraph_t>>,
+    ffi.Pointer<ffi.Float>,
+    ffi.Size,
+    ffi.Int,
+  )
+>(isLeaf: true)
+external void sk_paragraph_layout_batch(
+  ffi.Pointer<ffi.Pointer<sk_paragraph_t>> paragraphs,
+  ffi.Pointer<ffi.Float> widths,
+  int count,
+  int max_threads,
+);
+
 @ffi.Native<
   ffi.Void Function(
     ffi.Pointer<sk_paragraph_t>,
@@ -9530,14 +9940,42 @@ sk_paragraph_get_glyph_position_at_coordinate(
 );
 
 @ffi.Native<
-  sk_paragraph_text_range_t Function(
+  ffi.Void Function(
     ffi.Pointer<sk_paragraph_t>,
-    ffi.UnsignedInt,
+    ffi.Pointer<sk_point_t>,
+    ffi.Size,
+    ffi.Pointer<sk_paragraph_position_with_affinity_t>,
   )
 >(isLeaf: true)
-external sk_paragraph_text_range_t sk_paragraph_get_word_boundary(
+external void sk_paragraph_get_glyph_positions_at_coordinates(
   ffi.Pointer<sk_paragraph_t> paragraph,
-  int offset,
+  ffi.Pointer<sk_point_t> points,
+  int count,
+  ffi.Pointer<sk_paragraph_position_with_affinity_t> positions,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_paragraph_t>, ffi.Bool)>(
+  isLeaf: true,
+)
+external void sk_paragraph_set_hit_test_index_enabled(
+  ffi.Pointer<sk_paragraph_t> paragraph,
+  bool enabled,
+);
+
+@ffi.Native<ffi.Bool Function(ffi.Pointer<sk_paragraph_t>)>(isLeaf: true)
+external bool sk_paragraph_is_hit_test_index_enabled(
+  ffi.Pointer<sk_paragraph_t> paragraph,
+);
+
+@ffi.Native<
+  sk_paragraph_text_range_t Function(
+    ffi.Pointer<sk_paragraph_t>,
+    ffi.UnsignedInt,
+  )
+>(isLeaf: true)
+external sk_paragraph_text_range_t sk_paragraph_get_word_boundary(
+  ffi.Pointer<sk_paragraph_t> paragraph,
+  int offset,
 );
 
 @ffi.Native<ffi.Size Function(ffi.Pointer<sk_paragraph_t>)>(isLeaf: true)
@@ -9558,6 +9996,22 @@ external bool sk_paragraph_get_line_metrics_by_index(
   ffi.Pointer<sk_line_metrics_t> line_metrics,
 );
 
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_paragraph_t>)>(isLeaf: true)
+external int sk_paragraph_get_style_metrics_count(
+  ffi.Pointer<sk_paragraph_t> paragraph,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_paragraph_t>,
+    ffi.Pointer<sk_paragraph_line_metrics_buffer_t>,
+  )
+>(isLeaf: true)
+external void sk_paragraph_get_all_line_metrics(
+  ffi.Pointer<sk_paragraph_t> paragraph,
+  ffi.Pointer<sk_paragraph_line_metrics_buffer_t> buffer,
+);
+
 @ffi.Native<ffi.Size Function(ffi.Pointer<sk_paragraph_t>)>(isLeaf: true)
 external int sk_paragraph_get_line_number(
   ffi.Pointer<sk_paragraph_t> paragraph,
@@ -9951,6 +10405,19 @@ external ffi.Pointer<sk_paragraph_builder_t> sk_paragraph_builder_make(
   ffi.Pointer<sk_unicode_t> unicode,
 );
 
+@ffi.Native<
+  ffi.Pointer<sk_paragraph_builder_t> Function(
+    ffi.Pointer<sk_paragraph_style_t>,
+    ffi.Pointer<sk_font_collection_t>,
+    ffi.Pointer<sk_unicode_t>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_paragraph_builder_t> sk_paragraph_builder_make_recording(
+  ffi.Pointer<sk_paragraph_style_t> style,
+  ffi.Pointer<sk_font_collection_t> font_collection,
+  ffi.Pointer<sk_unicode_t> unicode,
+);
+
 @ffi.Native<ffi.Void Function(ffi.Pointer<sk_paragraph_builder_t>)>(
   isLeaf: true,
 )
@@ -10011,6 +10478,31 @@ external void sk_paragraph_builder_add_placeholder(
   ffi.Pointer<sk_paragraph_placeholder_style_t> placeholder_style,
 );
 
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_paragraph_builder_t>,
+    ffi.Pointer<ffi.Pointer<sk_text_style_t>>,
+    ffi.Size,
+    ffi.Pointer<sk_paragraph_placeholder_style_t>,
+    ffi.Size,
+    ffi.Pointer<sk_paragraph_text_run_t>,
+    ffi.Size,
+    ffi.Pointer<ffi.Char>,
+    ffi.Size,
+  )
+>(isLeaf: true)
+external bool sk_paragraph_builder_add_runs(
+  ffi.Pointer<sk_paragraph_builder_t> builder,
+  ffi.Pointer<ffi.Pointer<sk_text_style_t>> styles,
+  int style_count,
+  ffi.Pointer<sk_paragraph_placeholder_style_t> placeholders,
+  int placeholder_count,
+  ffi.Pointer<sk_paragraph_text_run_t> runs,
+  int run_count,
+  ffi.Pointer<ffi.Char> text,
+  int length,
+);
+
 @ffi.Native<
   ffi.Pointer<sk_paragraph_t> Function(ffi.Pointer<sk_paragraph_builder_t>)
 >(isLeaf: true)
@@ -10049,6 +10541,212 @@ external void sk_paragraph_builder_reset(
   ffi.Pointer<sk_paragraph_builder_t> builder,
 );
 
+@ffi.Native<ffi.Pointer<sk_paragraph_layout_cache_t> Function(ffi.Size)>(
+  isLeaf: true,
+)
+external ffi.Pointer<sk_paragraph_layout_cache_t> sk_paragraph_layout_cache_new(
+  int byte_budget,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_paragraph_layout_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_paragraph_layout_cache_delete(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_paragraph_t> Function(
+    ffi.Pointer<sk_paragraph_layout_cache_t>,
+    ffi.Pointer<sk_paragraph_builder_t>,
+    ffi.Float,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_paragraph_t> sk_paragraph_layout_cache_build(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+  ffi.Pointer<sk_paragraph_builder_t> builder,
+  double width,
+);
+
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_paragraph_layout_cache_t>)>(
+  isLeaf: true,
+)
+external int sk_paragraph_layout_cache_get_budget(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Void Function(ffi.Pointer<sk_paragraph_layout_cache_t>, ffi.Size)
+>(isLeaf: true)
+external void sk_paragraph_layout_cache_set_budget(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+  int byte_budget,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_paragraph_layout_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_paragraph_layout_cache_purge(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_paragraph_layout_cache_t>,
+    ffi.Pointer<sk_paragraph_layout_cache_stats_t>,
+  )
+>(isLeaf: true)
+external void sk_paragraph_layout_cache_get_stats(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+  ffi.Pointer<sk_paragraph_layout_cache_stats_t> stats,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_paragraph_layout_cache_t>)>(
+  isLeaf: true,
+)
+external void sk_paragraph_layout_cache_reset_stats(
+  ffi.Pointer<sk_paragraph_layout_cache_t> cache,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_paragraph_editor_t> Function(
+    ffi.Pointer<sk_paragraph_builder_t>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_paragraph_editor_t> sk_paragraph_editor_new(
+  ffi.Pointer<sk_paragraph_builder_t> builder,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_paragraph_editor_t>)>(
+  isLeaf: true,
+)
+external void sk_paragraph_editor_delete(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_paragraph_editor_t>,
+    ffi.Pointer<ffi.Pointer<ffi.Char>>,
+    ffi.Pointer<ffi.Size>,
+  )
+>(isLeaf: true)
+external void sk_paragraph_editor_get_text(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  ffi.Pointer<ffi.Pointer<ffi.Char>> text,
+  ffi.Pointer<ffi.Size> length,
+);
+
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_paragraph_editor_t>,
+    ffi.Size,
+    ffi.Size,
+    ffi.Pointer<ffi.Char>,
+    ffi.Size,
+  )
+>(isLeaf: true)
+external bool sk_paragraph_editor_replace(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  int start,
+  int end,
+  ffi.Pointer<ffi.Char> text,
+  int length,
+);
+
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_paragraph_editor_t>, ffi.Float)>(
+  isLeaf: true,
+)
+external int sk_paragraph_editor_layout(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  double width,
+);
+
+@ffi.Native<ffi.Float Function(ffi.Pointer<sk_paragraph_editor_t>)>(
+  isLeaf: true,
+)
+external double sk_paragraph_editor_get_height(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+);
+
+@ffi.Native<ffi.Float Function(ffi.Pointer<sk_paragraph_editor_t>)>(
+  isLeaf: true,
+)
+external double sk_paragraph_editor_get_longest_line(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+);
+
+@ffi.Native<ffi.Size Function(ffi.Pointer<sk_paragraph_editor_t>)>(
+  isLeaf: true,
+)
+external int sk_paragraph_editor_get_line_count(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_paragraph_editor_t>,
+    ffi.Pointer<sk_canvas_t>,
+    ffi.Float,
+    ffi.Float,
+  )
+>(isLeaf: true)
+external void sk_paragraph_editor_paint(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  ffi.Pointer<sk_canvas_t> canvas,
+  double x,
+  double y,
+);
+
+@ffi.Native<
+  sk_paragraph_position_with_affinity_t Function(
+    ffi.Pointer<sk_paragraph_editor_t>,
+    ffi.Float,
+    ffi.Float,
+  )
+>(isLeaf: true)
+external sk_paragraph_position_with_affinity_t
+sk_paragraph_editor_get_glyph_position_at_coordinate(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  double dx,
+  double dy,
+);
+
+@ffi.Native<
+  ffi.Size Function(
+    ffi.Pointer<sk_paragraph_editor_t>,
+    ffi.Size,
+    ffi.Size,
+    ffi.UnsignedInt,
+    ffi.UnsignedInt,
+    ffi.Pointer<sk_paragraph_text_box_t>,
+  )
+>(symbol: 'sk_paragraph_editor_get_rects_for_range', isLeaf: true)
+external int _sk_paragraph_editor_get_rects_for_range(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  int start,
+  int end,
+  int rect_height_style,
+  int rect_width_style,
+  ffi.Pointer<sk_paragraph_text_box_t> boxes,
+);
+
+int sk_paragraph_editor_get_rects_for_range(
+  ffi.Pointer<sk_paragraph_editor_t> editor,
+  int start,
+  int end,
+  sk_paragraph_rect_height_style_t rect_height_style,
+  sk_paragraph_rect_width_style_t rect_width_style,
+  ffi.Pointer<sk_paragraph_text_box_t> boxes,
+) => _sk_paragraph_editor_get_rects_for_range(
+  editor,
+  start,
+  end,
+  rect_height_style.value,
+  rect_width_style.value,
+  boxes,
+);
+
 @ffi.Native<ffi.Pointer<sk_picture_recorder_t> Function()>(isLeaf: true)
 external ffi.Pointer<sk_picture_recorder_t> sk_picture_recorder_new();
 
@@ -10236,6 +10934,42 @@ external int sk_picture_approximate_bytes_used(
   ffi.Pointer<sk_picture_t> picture,
 );
 
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_picture_t>,
+    ffi.Pointer<sk_pixmap_t>,
+    ffi.Pointer<sk_matrix_t>,
+    ffi.Int,
+    ffi.Int,
+    ffi.Int,
+  )
+>(isLeaf: true)
+external bool sk_picture_playback_tiled(
+  ffi.Pointer<sk_picture_t> picture,
+  ffi.Pointer<sk_pixmap_t> pixmap,
+  ffi.Pointer<sk_matrix_t> matrix,
+  int tile_width,
+  int tile_height,
+  int max_threads,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_picture_t>,
+    ffi.Pointer<sk_picture_t>,
+    ffi.Pointer<sk_matrix_t>,
+    ffi.Pointer<sk_irect_t>,
+    ffi.Pointer<sk_region_t>,
+  )
+>(isLeaf: true)
+external void sk_picture_compute_damage(
+  ffi.Pointer<sk_picture_t> previous,
+  ffi.Pointer<sk_picture_t> current,
+  ffi.Pointer<sk_matrix_t> matrix,
+  ffi.Pointer<sk_irect_t> device_bounds,
+  ffi.Pointer<sk_region_t> damage,
+);
+
 @ffi.Native<ffi.Pointer<sk_rtree_factory_t> Function()>(isLeaf: true)
 external ffi.Pointer<sk_rtree_factory_t> sk_rtree_factory_new();
 
@@ -11877,6 +12611,23 @@ external ffi.Pointer<sk_surface_t> sk_canvas_get_surface(
   ffi.Pointer<sk_canvas_t> canvas,
 );
 
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_canvas_t>,
+    ffi.Pointer<ffi.Uint8>,
+    ffi.Size,
+    ffi.Pointer<ffi.Pointer<ffi.Void>>,
+    ffi.Size,
+  )
+>(isLeaf: true)
+external bool sk_canvas_execute_commands(
+  ffi.Pointer<sk_canvas_t> ccanvas,
+  ffi.Pointer<ffi.Uint8> ops,
+  int length,
+  ffi.Pointer<ffi.Pointer<ffi.Void>> objects,
+  int object_count,
+);
+
 @ffi.Native<ffi.Void Function(ffi.Pointer<sk_blender_t>)>(isLeaf: true)
 external void sk_blender_ref(
   ffi.Pointer<sk_blender_t> blender,
@@ -12715,22 +13466,162 @@ external bool sk_run_loop_get_isolate_handle(
   ffi.Pointer<ffi.Int64> handle,
 );
 
-@ffi.Native<ffi.Void Function()>(isLeaf: true)
-external void sk_linker_keep_alive();
+@ffi.Native<ffi.Void Function(ffi.Int64)>(isLeaf: true)
+external void sk_run_loop_flush(int isolate_handle);
 
-@ffi.Native<ffi.Void Function(ffi.Pointer<sk_colorfilter_t>)>(isLeaf: true)
-external void sk_colorfilter_ref(
-  ffi.Pointer<sk_colorfilter_t> filter,
-);
+@ffi.Native<ffi.Size Function(ffi.Int64)>(isLeaf: true)
+external int sk_run_loop_get_pending_destroy_count(int isolate_handle);
 
-@ffi.Native<ffi.Void Function(ffi.Pointer<sk_colorfilter_t>)>(isLeaf: true)
-external void sk_colorfilter_unref(
-  ffi.Pointer<sk_colorfilter_t> filter,
-);
+@ffi.Native<ffi.Void Function(ffi.Pointer<ffi.Void>)>(isLeaf: true)
+external void sk_run_loop_shutdown(ffi.Pointer<ffi.Void> isolate_handle);
 
 @ffi.Native<
-  ffi.Pointer<sk_colorfilter_t> Function(sk_color_t, ffi.UnsignedInt)
->(symbol: 'sk_colorfilter_new_blend', isLeaf: true)
+  ffi.Pointer<sk_async_task_t> Function(
+    ffi.Int64,
+    sk_async_work_proc,
+    sk_async_completion_proc,
+    ffi.Pointer<ffi.Void>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_async_task_t> sk_async_submit(
+  int isolate_handle,
+  sk_async_work_proc work,
+  sk_async_completion_proc completion,
+  ffi.Pointer<ffi.Void> context,
+);
+
+@ffi.Native<ffi.Bool Function(ffi.Pointer<sk_async_task_t>)>(isLeaf: true)
+external bool sk_async_cancel(
+  ffi.Pointer<sk_async_task_t> task,
+);
+
+@ffi.Native<ffi.Bool Function(ffi.Pointer<sk_async_task_t>)>(isLeaf: true)
+external bool sk_async_is_cancel_requested(
+  ffi.Pointer<sk_async_task_t> task,
+);
+
+@ffi.Native<ffi.UnsignedInt Function(ffi.Pointer<sk_async_task_t>)>(
+  symbol: 'sk_async_get_status',
+  isLeaf: true,
+)
+external int _sk_async_get_status(
+  ffi.Pointer<sk_async_task_t> task,
+);
+
+sk_async_status_t sk_async_get_status(
+  ffi.Pointer<sk_async_task_t> task,
+) => sk_async_status_t.fromValue(
+  _sk_async_get_status(
+    task,
+  ),
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_async_task_t>)>(isLeaf: true)
+external void sk_async_task_unref(
+  ffi.Pointer<sk_async_task_t> task,
+);
+
+@ffi.Native<ffi.Int Function()>(isLeaf: true)
+external int sk_async_get_thread_count();
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_async_stats_t>)>(isLeaf: true)
+external void sk_async_get_stats(
+  ffi.Pointer<sk_async_stats_t> stats,
+);
+
+@ffi.Native<ffi.Void Function()>(isLeaf: true)
+external void sk_async_reset_stats();
+
+@ffi.Native<ffi.Pointer<sk_encode_queue_t> Function(ffi.Int)>(isLeaf: true)
+external ffi.Pointer<sk_encode_queue_t> sk_encode_queue_new(int capacity);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_encode_queue_t>)>(isLeaf: true)
+external void sk_encode_queue_delete(ffi.Pointer<sk_encode_queue_t> queue);
+
+@ffi.Native<ffi.Int Function(ffi.Pointer<sk_encode_queue_t>)>(isLeaf: true)
+external int sk_encode_queue_get_capacity(
+  ffi.Pointer<sk_encode_queue_t> queue,
+);
+
+@ffi.Native<ffi.Int Function(ffi.Pointer<sk_encode_queue_t>)>(isLeaf: true)
+external int sk_encode_queue_get_in_flight(
+  ffi.Pointer<sk_encode_queue_t> queue,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_async_task_t> Function(
+    ffi.Int64,
+    ffi.Pointer<sk_encode_queue_t>,
+    ffi.Pointer<sk_image_t>,
+    ffi.Pointer<sk_encode_options_t>,
+    ffi.Pointer<sk_encode_result_t>,
+    sk_async_completion_proc,
+    ffi.Pointer<ffi.Void>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_async_task_t> sk_encode_queue_encode_image_async(
+  int isolate_handle,
+  ffi.Pointer<sk_encode_queue_t> queue,
+  ffi.Pointer<sk_image_t> image,
+  ffi.Pointer<sk_encode_options_t> options,
+  ffi.Pointer<sk_encode_result_t> result,
+  sk_async_completion_proc completion,
+  ffi.Pointer<ffi.Void> context,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_async_task_t> Function(
+    ffi.Int64,
+    ffi.Pointer<sk_encode_queue_t>,
+    ffi.Pointer<sk_pixmap_t>,
+    ffi.Pointer<sk_encode_options_t>,
+    ffi.Pointer<sk_encode_result_t>,
+    sk_async_completion_proc,
+    ffi.Pointer<ffi.Void>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_async_task_t> sk_encode_queue_encode_pixmap_async(
+  int isolate_handle,
+  ffi.Pointer<sk_encode_queue_t> queue,
+  ffi.Pointer<sk_pixmap_t> pixmap,
+  ffi.Pointer<sk_encode_options_t> options,
+  ffi.Pointer<sk_encode_result_t> result,
+  sk_async_completion_proc completion,
+  ffi.Pointer<ffi.Void> context,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_encode_queue_t>,
+    ffi.Pointer<sk_encode_queue_stats_t>,
+  )
+>(isLeaf: true)
+external void sk_encode_queue_get_stats(
+  ffi.Pointer<sk_encode_queue_t> queue,
+  ffi.Pointer<sk_encode_queue_stats_t> stats,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_encode_queue_t>)>(isLeaf: true)
+external void sk_encode_queue_reset_stats(
+  ffi.Pointer<sk_encode_queue_t> queue,
+);
+
+@ffi.Native<ffi.Void Function()>(isLeaf: true)
+external void sk_linker_keep_alive();
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_colorfilter_t>)>(isLeaf: true)
+external void sk_colorfilter_ref(
+  ffi.Pointer<sk_colorfilter_t> filter,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_colorfilter_t>)>(isLeaf: true)
+external void sk_colorfilter_unref(
+  ffi.Pointer<sk_colorfilter_t> filter,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_colorfilter_t> Function(sk_color_t, ffi.UnsignedInt)
+>(symbol: 'sk_colorfilter_new_blend', isLeaf: true)
 external ffi.Pointer<sk_colorfilter_t> _sk_colorfilter_new_blend(
   int c,
   int mode,
@@ -13361,6 +14252,59 @@ external int sk_font_get_intercepts(
   ffi.Pointer<ffi.Float> intervals,
 );
 
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_font_t>,
+    ffi.Pointer<ffi.Uint16>,
+    ffi.Size,
+    ffi.Pointer<sk_matrix_t>,
+    ffi.Pointer<sk_paint_t>,
+    ffi.Pointer<sk_font_prewarm_result_t>,
+  )
+>(isLeaf: true)
+external void sk_font_prewarm_glyphs(
+  ffi.Pointer<sk_font_t> font,
+  ffi.Pointer<ffi.Uint16> glyphs,
+  int count,
+  ffi.Pointer<sk_matrix_t> matrix,
+  ffi.Pointer<sk_paint_t> paint,
+  ffi.Pointer<sk_font_prewarm_result_t> result,
+);
+
+@ffi.Native<
+  ffi.Void Function(
+    ffi.Pointer<sk_font_prewarm_request_t>,
+    ffi.Pointer<sk_font_prewarm_result_t>,
+    ffi.Size,
+    ffi.Int,
+  )
+>(isLeaf: true)
+external void sk_font_prewarm_glyphs_batch(
+  ffi.Pointer<sk_font_prewarm_request_t> requests,
+  ffi.Pointer<sk_font_prewarm_result_t> results,
+  int count,
+  int max_threads,
+);
+
+@ffi.Native<
+  ffi.Pointer<sk_async_task_t> Function(
+    ffi.Int64,
+    ffi.Pointer<sk_font_prewarm_request_t>,
+    ffi.Size,
+    ffi.Pointer<sk_font_prewarm_result_t>,
+    sk_async_completion_proc,
+    ffi.Pointer<ffi.Void>,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_async_task_t> sk_font_prewarm_glyphs_async(
+  int isolate_handle,
+  ffi.Pointer<sk_font_prewarm_request_t> requests,
+  int count,
+  ffi.Pointer<sk_font_prewarm_result_t> results,
+  sk_async_completion_proc completion,
+  ffi.Pointer<ffi.Void> context,
+);
+
 @ffi.Native<
   ffi.Void Function(
     ffi.Pointer<ffi.Void>,
@@ -14059,6 +15003,25 @@ external bool sk_pixmap_erase_color4f(
   ffi.Pointer<sk_irect_t> subset,
 );
 
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_pixmap_t>,
+    ffi.Pointer<sk_pixmap_t>,
+    ffi.Int,
+    ffi.Pointer<sk_pixmap_compare_options_t>,
+    ffi.Pointer<sk_pixmap_compare_stats_t>,
+    ffi.Pointer<sk_pixmap_t>,
+  )
+>(isLeaf: true)
+external bool sk_pixmap_compare(
+  ffi.Pointer<sk_pixmap_t> a,
+  ffi.Pointer<sk_pixmap_t> b,
+  int tolerance,
+  ffi.Pointer<sk_pixmap_compare_options_t> options,
+  ffi.Pointer<sk_pixmap_compare_stats_t> stats,
+  ffi.Pointer<sk_pixmap_t> diff_mask,
+);
+
 @ffi.Native<
   ffi.Bool Function(
     ffi.Pointer<sk_wstream_t>,
@@ -14072,6 +15035,21 @@ external bool sk_webpencoder_encode(
   ffi.Pointer<sk_webpencoder_options_t> options,
 );
 
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_wstream_t>,
+    ffi.Pointer<sk_webpencoder_frame_t>,
+    ffi.Size,
+    ffi.Pointer<sk_webpencoder_options_t>,
+  )
+>(isLeaf: true)
+external bool sk_webpencoder_encode_animated(
+  ffi.Pointer<sk_wstream_t> dst,
+  ffi.Pointer<sk_webpencoder_frame_t> frames,
+  int count,
+  ffi.Pointer<sk_webpencoder_options_t> options,
+);
+
 @ffi.Native<
   ffi.Bool Function(
     ffi.Pointer<sk_wstream_t>,
@@ -14098,6 +15076,59 @@ external bool sk_pngencoder_encode(
   ffi.Pointer<sk_pngencoder_options_t> options,
 );
 
+@ffi.Native<
+  ffi.Pointer<sk_webp_anim_encoder_t> Function(
+    ffi.Int,
+    ffi.Int,
+    ffi.Pointer<sk_webpencoder_options_t>,
+    ffi.Int,
+  )
+>(isLeaf: true)
+external ffi.Pointer<sk_webp_anim_encoder_t> sk_webp_anim_encoder_new(
+  int width,
+  int height,
+  ffi.Pointer<sk_webpencoder_options_t> options,
+  int loop_count,
+);
+
+@ffi.Native<ffi.Void Function(ffi.Pointer<sk_webp_anim_encoder_t>)>(
+  isLeaf: true,
+)
+external void sk_webp_anim_encoder_delete(
+  ffi.Pointer<sk_webp_anim_encoder_t> encoder,
+);
+
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_webp_anim_encoder_t>,
+    ffi.Pointer<sk_pixmap_t>,
+    ffi.Int,
+  )
+>(isLeaf: true)
+external bool sk_webp_anim_encoder_add_frame(
+  ffi.Pointer<sk_webp_anim_encoder_t> encoder,
+  ffi.Pointer<sk_pixmap_t> frame,
+  int duration,
+);
+
+@ffi.Native<ffi.Int Function(ffi.Pointer<sk_webp_anim_encoder_t>)>(
+  isLeaf: true,
+)
+external int sk_webp_anim_encoder_get_frame_count(
+  ffi.Pointer<sk_webp_anim_encoder_t> encoder,
+);
+
+@ffi.Native<
+  ffi.Bool Function(
+    ffi.Pointer<sk_webp_anim_encoder_t>,
+    ffi.Pointer<sk_wstream_t>,
+  )
+>(isLeaf: true)
+external bool sk_webp_anim_encoder_finish(
+  ffi.Pointer<sk_webp_anim_encoder_t> encoder,
+  ffi.Pointer<sk_wstream_t> dst,
+);
+
 @ffi.Native<
   ffi.Void Function(ffi.Pointer<ffi.Uint32>, ffi.Pointer<ffi.Uint32>, ffi.Int)
 >(isLeaf: true)
@@ -14605,6 +15636,23 @@ final class sk_fontstyle_t extends ffi.Opaque {}
 
 final class sk_fontstyleset_t extends ffi.Opaque {}
 
+final class sk_fontmgr_index_info_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fFileCount;
+
+  @ffi.Uint32()
+  external int fFaceCount;
+
+  @ffi.Uint32()
+  external int fFamilyCount;
+
+  @ffi.Bool()
+  external bool fRebuilt;
+
+  @ffi.Uint64()
+  external int fNanos;
+}
+
 final class sk_localized_string_t extends ffi.Opaque {}
 
 final class sk_localized_strings_t extends ffi.Opaque {}
@@ -15822,6 +16870,57 @@ final class sk_codec_frameinfo_t extends ffi.Struct {
   external sk_irect_t fFrameRect;
 }
 
+final class sk_codec_decode_request_t extends ffi.Struct {
+  external ffi.Pointer<sk_data_t> fData;
+
+  @ffi.Int()
+  external int fWidth;
+
+  @ffi.Int()
+  external int fHeight;
+
+  @ffi.UnsignedInt()
+  external int fColorTypeAsInt;
+
+  sk_colortype_t get fColorType => sk_colortype_t.fromValue(fColorTypeAsInt);
+}
+
+final class sk_codec_decode_result_t extends ffi.Struct {
+  @ffi.UnsignedInt()
+  external int fResultAsInt;
+
+  sk_codec_result_t get fResult => sk_codec_result_t.fromValue(fResultAsInt);
+
+  external ffi.Pointer<sk_bitmap_t> fBitmap;
+
+  external sk_isize_t fDecodedSize;
+
+  @ffi.Uint64()
+  external int fDecodeNanos;
+
+  @ffi.Uint64()
+  external int fResizeNanos;
+}
+
+final class sk_decoded_image_cache_t extends ffi.Opaque {}
+
+final class sk_decoded_image_cache_stats_t extends ffi.Struct {
+  @ffi.Uint64()
+  external int fHits;
+
+  @ffi.Uint64()
+  external int fMisses;
+
+  @ffi.Uint64()
+  external int fEvictions;
+
+  @ffi.Size()
+  external int fBytes;
+
+  @ffi.Size()
+  external int fEntryCount;
+}
+
 final class sk_svgcanvas_t extends ffi.Opaque {}
 
 enum sk_vertices_vertex_mode_t {
@@ -16079,6 +17178,72 @@ final class sk_webpencoder_options_t extends ffi.Struct {
   external double fQuality;
 }
 
+final class sk_webpencoder_frame_t extends ffi.Struct {
+  external ffi.Pointer<sk_pixmap_t> fPixmap;
+
+  @ffi.Int()
+  external int fDuration;
+}
+
+final class sk_webp_anim_encoder_t extends ffi.Opaque {}
+
+final class sk_row_encoder_t extends ffi.Opaque {}
+
+final class sk_strip_render_stats_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fBandCount;
+
+  @ffi.Uint64()
+  external int fRenderNanos;
+
+  @ffi.Uint64()
+  external int fEncodeNanos;
+
+  @ffi.Uint64()
+  external int fTotalNanos;
+
+  @ffi.Size()
+  external int fBandBytes;
+
+  @ffi.Double()
+  external double fMegapixelsPerSecond;
+}
+
+enum sk_pixmap_diff_mode_t {
+  MASK_SK_PIXMAP_DIFF_MODE(0),
+  DELTA_SK_PIXMAP_DIFF_MODE(1);
+
+  final int value;
+  const sk_pixmap_diff_mode_t(this.value);
+
+  static sk_pixmap_diff_mode_t fromValue(int value) => switch (value) {
+    0 => MASK_SK_PIXMAP_DIFF_MODE,
+    1 => DELTA_SK_PIXMAP_DIFF_MODE,
+    _ => throw ArgumentError('Unknown value for sk_pixmap_diff_mode_t: $value'),
+  };
+}
+
+final class sk_pixmap_compare_options_t extends ffi.Struct {
+  @ffi.Bool()
+  external bool fIgnoreAlpha;
+
+  @ffi.UnsignedInt()
+  external int fDiffModeAsInt;
+
+  sk_pixmap_diff_mode_t get fDiffMode =>
+      sk_pixmap_diff_mode_t.fromValue(fDiffModeAsInt);
+}
+
+final class sk_pixmap_compare_stats_t extends ffi.Struct {
+  @ffi.Int()
+  external int fMaxDelta;
+
+  @ffi.Int64()
+  external int fDifferentPixels;
+
+  external sk_irect_t fBounds;
+}
+
 final class sk_rrect_t extends ffi.Opaque {}
 
 enum sk_rrect_type_t {
@@ -16391,6 +17556,110 @@ final class sk_canvas_savelayerrec_t extends ffi.Struct {
       sk_canvas_savelayerrec_flags_t.fromValue(fFlagsAsInt);
 }
 
+enum sk_canvas_command_t {
+  SAVE_SK_CANVAS_COMMAND(0),
+  SAVE_LAYER_SK_CANVAS_COMMAND(1),
+  RESTORE_SK_CANVAS_COMMAND(2),
+  RESTORE_TO_COUNT_SK_CANVAS_COMMAND(3),
+  TRANSLATE_SK_CANVAS_COMMAND(4),
+  SCALE_SK_CANVAS_COMMAND(5),
+  ROTATE_SK_CANVAS_COMMAND(6),
+  SKEW_SK_CANVAS_COMMAND(7),
+  CONCAT_SK_CANVAS_COMMAND(8),
+  SET_MATRIX_SK_CANVAS_COMMAND(9),
+  RESET_MATRIX_SK_CANVAS_COMMAND(10),
+  CLIP_RECT_SK_CANVAS_COMMAND(11),
+  CLIP_RRECT_SK_CANVAS_COMMAND(12),
+  CLIP_PATH_SK_CANVAS_COMMAND(13),
+  CLIP_REGION_SK_CANVAS_COMMAND(14),
+  CLEAR_SK_CANVAS_COMMAND(15),
+  DRAW_COLOR_SK_CANVAS_COMMAND(16),
+  DRAW_PAINT_SK_CANVAS_COMMAND(17),
+  DRAW_POINT_SK_CANVAS_COMMAND(18),
+  DRAW_POINTS_SK_CANVAS_COMMAND(19),
+  DRAW_LINE_SK_CANVAS_COMMAND(20),
+  DRAW_RECT_SK_CANVAS_COMMAND(21),
+  DRAW_OVAL_SK_CANVAS_COMMAND(22),
+  DRAW_ROUND_RECT_SK_CANVAS_COMMAND(23),
+  DRAW_RRECT_SK_CANVAS_COMMAND(24),
+  DRAW_DRRECT_SK_CANVAS_COMMAND(25),
+  DRAW_CIRCLE_SK_CANVAS_COMMAND(26),
+  DRAW_ARC_SK_CANVAS_COMMAND(27),
+  DRAW_PATH_SK_CANVAS_COMMAND(28),
+  DRAW_REGION_SK_CANVAS_COMMAND(29),
+  DRAW_IMAGE_SK_CANVAS_COMMAND(30),
+  DRAW_IMAGE_RECT_SK_CANVAS_COMMAND(31),
+  DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND(32),
+  DRAW_TEXT_BLOB_SK_CANVAS_COMMAND(33),
+  DRAW_PICTURE_SK_CANVAS_COMMAND(34),
+  DRAW_VERTICES_SK_CANVAS_COMMAND(35),
+  CLEAR_COLOR4F_SK_CANVAS_COMMAND(36),
+  DRAW_COLOR4F_SK_CANVAS_COMMAND(37),
+  SAVE_LAYER_REC_SK_CANVAS_COMMAND(38),
+  DRAW_PICTURE_MATRIX_SK_CANVAS_COMMAND(39),
+  DRAW_DRAWABLE_SK_CANVAS_COMMAND(40),
+  DRAW_ANNOTATION_SK_CANVAS_COMMAND(41),
+  DRAW_IMAGE_NINE_SK_CANVAS_COMMAND(42),
+  DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND(43),
+  DRAW_ATLAS_SK_CANVAS_COMMAND(44),
+  DRAW_PATCH_SK_CANVAS_COMMAND(45),
+  DISCARD_SK_CANVAS_COMMAND(46);
+
+  final int value;
+  const sk_canvas_command_t(this.value);
+
+  static sk_canvas_command_t fromValue(int value) => switch (value) {
+    0 => SAVE_SK_CANVAS_COMMAND,
+    1 => SAVE_LAYER_SK_CANVAS_COMMAND,
+    2 => RESTORE_SK_CANVAS_COMMAND,
+    3 => RESTORE_TO_COUNT_SK_CANVAS_COMMAND,
+    4 => TRANSLATE_SK_CANVAS_COMMAND,
+    5 => SCALE_SK_CANVAS_COMMAND,
+    6 => ROTATE_SK_CANVAS_COMMAND,
+    7 => SKEW_SK_CANVAS_COMMAND,
+    8 => CONCAT_SK_CANVAS_COMMAND,
+    9 => SET_MATRIX_SK_CANVAS_COMMAND,
+    10 => RESET_MATRIX_SK_CANVAS_COMMAND,
+    11 => CLIP_RECT_SK_CANVAS_COMMAND,
+    12 => CLIP_RRECT_SK_CANVAS_COMMAND,
+    13 => CLIP_PATH_SK_CANVAS_COMMAND,
+    14 => CLIP_REGION_SK_CANVAS_COMMAND,
+    15 => CLEAR_SK_CANVAS_COMMAND,
+    16 => DRAW_COLOR_SK_CANVAS_COMMAND,
+    17 => DRAW_PAINT_SK_CANVAS_COMMAND,
+    18 => DRAW_POINT_SK_CANVAS_COMMAND,
+    19 => DRAW_POINTS_SK_CANVAS_COMMAND,
+    20 => DRAW_LINE_SK_CANVAS_COMMAND,
+    21 => DRAW_RECT_SK_CANVAS_COMMAND,
+    22 => DRAW_OVAL_SK_CANVAS_COMMAND,
+    23 => DRAW_ROUND_RECT_SK_CANVAS_COMMAND,
+    24 => DRAW_RRECT_SK_CANVAS_COMMAND,
+    25 => DRAW_DRRECT_SK_CANVAS_COMMAND,
+    26 => DRAW_CIRCLE_SK_CANVAS_COMMAND,
+    27 => DRAW_ARC_SK_CANVAS_COMMAND,
+    28 => DRAW_PATH_SK_CANVAS_COMMAND,
+    29 => DRAW_REGION_SK_CANVAS_COMMAND,
+    30 => DRAW_IMAGE_SK_CANVAS_COMMAND,
+    31 => DRAW_IMAGE_RECT_SK_CANVAS_COMMAND,
+    32 => DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND,
+    33 => DRAW_TEXT_BLOB_SK_CANVAS_COMMAND,
+    34 => DRAW_PICTURE_SK_CANVAS_COMMAND,
+    35 => DRAW_VERTICES_SK_CANVAS_COMMAND,
+    36 => CLEAR_COLOR4F_SK_CANVAS_COMMAND,
+    37 => DRAW_COLOR4F_SK_CANVAS_COMMAND,
+    38 => SAVE_LAYER_REC_SK_CANVAS_COMMAND,
+    39 => DRAW_PICTURE_MATRIX_SK_CANVAS_COMMAND,
+    40 => DRAW_DRAWABLE_SK_CANVAS_COMMAND,
+    41 => DRAW_ANNOTATION_SK_CANVAS_COMMAND,
+    42 => DRAW_IMAGE_NINE_SK_CANVAS_COMMAND,
+    43 => DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND,
+    44 => DRAW_ATLAS_SK_CANVAS_COMMAND,
+    45 => DRAW_PATCH_SK_CANVAS_COMMAND,
+    46 => DISCARD_SK_CANVAS_COMMAND,
+    _ => throw ArgumentError('Unknown value for sk_canvas_command_t: $value'),
+  };
+}
+
 final class skottie_animation_t extends ffi.Opaque {}
 
 final class skottie_animation_builder_t extends ffi.Opaque {}
@@ -16468,8 +17737,126 @@ final class skresources_resource_provider_t extends ffi.Opaque {}
 
 final class sk_unicode_t extends ffi.Opaque {}
 
+final class sk_unicode_analysis_t extends ffi.Opaque {}
+
+final class sk_unicode_analysis_cache_t extends ffi.Opaque {}
+
+final class sk_unicode_analysis_cache_stats_t extends ffi.Struct {
+  @ffi.Uint64()
+  external int fHits;
+
+  @ffi.Uint64()
+  external int fMisses;
+
+  @ffi.Uint64()
+  external int fEvictions;
+
+  @ffi.Size()
+  external int fBytes;
+
+  @ffi.Size()
+  external int fEntryCount;
+}
+
+enum sk_unicode_analysis_flags_t {
+  WHITESPACE_SK_UNICODE_ANALYSIS_FLAGS(1),
+  GRAPHEME_START_SK_UNICODE_ANALYSIS_FLAGS(2),
+  SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS(4),
+  HARD_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS(8),
+  WORD_BREAK_SK_UNICODE_ANALYSIS_FLAGS(16),
+  CONTROL_SK_UNICODE_ANALYSIS_FLAGS(32);
+
+  final int value;
+  const sk_unicode_analysis_flags_t(this.value);
+
+  static sk_unicode_analysis_flags_t fromValue(int value) => switch (value) {
+    1 => WHITESPACE_SK_UNICODE_ANALYSIS_FLAGS,
+    2 => GRAPHEME_START_SK_UNICODE_ANALYSIS_FLAGS,
+    4 => SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS,
+    8 => HARD_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS,
+    16 => WORD_BREAK_SK_UNICODE_ANALYSIS_FLAGS,
+    32 => CONTROL_SK_UNICODE_ANALYSIS_FLAGS,
+    _ => throw ArgumentError(
+      'Unknown value for sk_unicode_analysis_flags_t: $value',
+    ),
+  };
+}
+
+final class sk_unicode_analysis_text_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> fUtf8;
+
+  @ffi.Size()
+  external int fUtf8Bytes;
+
+  external ffi.Pointer<ffi.Char> fLocale;
+
+  @ffi.Bool()
+  external bool fLeftToRight;
+}
+
+final class sk_unicode_bidi_region_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fStart;
+
+  @ffi.Uint32()
+  external int fEnd;
+
+  @ffi.Uint8()
+  external int fLevel;
+}
+
+final class sk_unicode_analysis_text_result_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fFlagOffset;
+
+  @ffi.Uint32()
+  external int fBidiRegionOffset;
+
+  @ffi.Uint32()
+  external int fBidiRegionCount;
+
+  @ffi.Bool()
+  external bool fCached;
+}
+
+final class sk_unicode_analysis_data_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Uint8> fFlags;
+
+  @ffi.Size()
+  external int fFlagCount;
+
+  external ffi.Pointer<sk_unicode_bidi_region_t> fBidiRegions;
+
+  @ffi.Size()
+  external int fBidiRegionCount;
+
+  external ffi.Pointer<sk_unicode_analysis_text_result_t> fTexts;
+
+  @ffi.Size()
+  external int fTextCount;
+}
+
 final class sk_shaper_t extends ffi.Opaque {}
 
+final class sk_shaping_cache_t extends ffi.Opaque {}
+
+final class sk_shaping_cache_stats_t extends ffi.Struct {
+  @ffi.Uint64()
+  external int fHits;
+
+  @ffi.Uint64()
+  external int fMisses;
+
+  @ffi.Uint64()
+  external int fEvictions;
+
+  @ffi.Size()
+  external int fBytes;
+
+  @ffi.Size()
+  external int fEntryCount;
+}
+
 final class sk_shaper_factory_t extends ffi.Opaque {}
 
 final class sk_shaper_run_handler_t extends ffi.Opaque {}
@@ -16484,6 +17871,8 @@ final class sk_shaper_script_run_iterator_t extends ffi.Opaque {}
 
 final class sk_shaper_language_run_iterator_t extends ffi.Opaque {}
 
+final class sk_shaper_buffer_t extends ffi.Opaque {}
+
 final class sk_textblob_builder_run_handler_t extends ffi.Opaque {}
 
 final class sk_shaper_feature_t extends ffi.Struct {
@@ -16506,6 +17895,10 @@ final class sk_paragraph_t extends ffi.Opaque {}
 
 final class sk_paragraph_builder_t extends ffi.Opaque {}
 
+final class sk_paragraph_editor_t extends ffi.Opaque {}
+
+final class sk_paragraph_layout_cache_t extends ffi.Opaque {}
+
 final class sk_paragraph_painter_t extends ffi.Opaque {}
 
 final class sk_paragraph_style_t extends ffi.Opaque {}
@@ -16711,6 +18104,57 @@ final class sk_paragraph_text_box_t extends ffi.Struct {
       sk_paragraph_text_direction_t.fromValue(directionAsInt);
 }
 
+final class sk_paragraph_line_metrics_buffer_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Uint64> start_index;
+
+  external ffi.Pointer<ffi.Uint64> end_index;
+
+  external ffi.Pointer<ffi.Uint64> end_excluding_whitespaces;
+
+  external ffi.Pointer<ffi.Uint64> end_including_newline;
+
+  external ffi.Pointer<ffi.Uint8> hard_break;
+
+  external ffi.Pointer<ffi.Double> ascent;
+
+  external ffi.Pointer<ffi.Double> descent;
+
+  external ffi.Pointer<ffi.Double> unscaled_ascent;
+
+  external ffi.Pointer<ffi.Double> height;
+
+  external ffi.Pointer<ffi.Double> width;
+
+  external ffi.Pointer<ffi.Double> left;
+
+  external ffi.Pointer<ffi.Double> baseline;
+
+  external ffi.Pointer<ffi.Uint64> line_number;
+
+  external ffi.Pointer<ffi.Uint64> style_run_offsets;
+
+  external ffi.Pointer<ffi.Uint64> style_run_text_starts;
+
+  external ffi.Pointer<sk_fontmetrics_t> style_run_font_metrics;
+}
+
+final class sk_paragraph_layout_cache_stats_t extends ffi.Struct {
+  @ffi.Uint64()
+  external int hits;
+
+  @ffi.Uint64()
+  external int misses;
+
+  @ffi.Uint64()
+  external int evictions;
+
+  @ffi.Size()
+  external int bytes;
+
+  @ffi.Size()
+  external int entry_count;
+}
+
 final class sk_paragraph_glyph_cluster_info_t extends ffi.Struct {
   external sk_rect_t bounds;
 
@@ -16940,6 +18384,17 @@ final class sk_paragraph_placeholder_style_t extends ffi.Struct {
   external double baseline_offset;
 }
 
+final class sk_paragraph_text_run_t extends ffi.Struct {
+  @ffi.Int32()
+  external int style_index;
+
+  @ffi.Int32()
+  external int placeholder_index;
+
+  @ffi.Uint32()
+  external int text_length;
+}
+
 final class sk_text_shadow_t extends ffi.Struct {
   @sk_color_t()
   external int color;
@@ -17060,6 +18515,140 @@ enum sk_image_rescale_mode_t {
   };
 }
 
+final class sk_async_task_t extends ffi.Opaque {}
+
+enum sk_async_status_t {
+  PENDING_SK_ASYNC_STATUS(0),
+  RUNNING_SK_ASYNC_STATUS(1),
+  COMPLETED_SK_ASYNC_STATUS(2),
+  CANCELLED_SK_ASYNC_STATUS(3);
+
+  final int value;
+  const sk_async_status_t(this.value);
+
+  static sk_async_status_t fromValue(int value) => switch (value) {
+    0 => PENDING_SK_ASYNC_STATUS,
+    1 => RUNNING_SK_ASYNC_STATUS,
+    2 => COMPLETED_SK_ASYNC_STATUS,
+    3 => CANCELLED_SK_ASYNC_STATUS,
+    _ => throw ArgumentError(
+      'Unknown value for sk_async_status_t: $value',
+    ),
+  };
+}
+
+typedef sk_async_work_procFunction =
+    ffi.Void Function(
+      ffi.Pointer<sk_async_task_t> task,
+      ffi.Pointer<ffi.Void> context,
+    );
+typedef Dartsk_async_work_procFunction =
+    void Function(
+      ffi.Pointer<sk_async_task_t> task,
+      ffi.Pointer<ffi.Void> context,
+    );
+typedef sk_async_work_proc =
+    ffi.Pointer<ffi.NativeFunction<sk_async_work_procFunction>>;
+typedef sk_async_completion_procFunction =
+    ffi.Void Function(
+      ffi.Pointer<sk_async_task_t> task,
+      ffi.Pointer<ffi.Void> context,
+    );
+typedef Dartsk_async_completion_procFunction =
+    void Function(
+      ffi.Pointer<sk_async_task_t> task,
+      ffi.Pointer<ffi.Void> context,
+    );
+typedef sk_async_completion_proc =
+    ffi.Pointer<ffi.NativeFunction<sk_async_completion_procFunction>>;
+
+final class sk_async_stats_t extends ffi.Struct {
+  @ffi.Uint64()
+  external int submitted;
+
+  @ffi.Uint64()
+  external int completed;
+
+  @ffi.Uint64()
+  external int cancelled;
+
+  @ffi.Int64()
+  external int queue_depth;
+
+  @ffi.Int64()
+  external int running;
+
+  @ffi.Uint64()
+  external int total_queue_ns;
+
+  @ffi.Uint64()
+  external int max_queue_ns;
+
+  @ffi.Uint64()
+  external int total_run_ns;
+}
+
+final class sk_encode_queue_t extends ffi.Opaque {}
+
+final class sk_encode_options_t extends ffi.Struct {
+  @ffi.UnsignedInt()
+  external int fFormatAsInt;
+
+  sk_encoded_image_format_t get fFormat =>
+      sk_encoded_image_format_t.fromValue(fFormatAsInt);
+
+  external sk_pngencoder_options_t fPng;
+
+  external sk_jpegencoder_options_t fJpeg;
+
+  external sk_webpencoder_options_t fWebp;
+}
+
+final class sk_encode_result_t extends ffi.Struct {
+  external ffi.Pointer<sk_data_t> fData;
+
+  @ffi.Uint64()
+  external int fQueueNanos;
+
+  @ffi.Uint64()
+  external int fEncodeNanos;
+}
+
+final class sk_encode_queue_stats_t extends ffi.Struct {
+  @ffi.Uint64()
+  external int fSubmitted;
+
+  @ffi.Uint64()
+  external int fRejected;
+
+  @ffi.Uint64()
+  external int fEncoded;
+
+  @ffi.Uint64()
+  external int fFailed;
+
+  @ffi.Uint64()
+  external int fCancelled;
+
+  @ffi.Int()
+  external int fInFlight;
+
+  @ffi.Size()
+  external int fEncodedBytes;
+
+  @ffi.Uint64()
+  external int fTotalQueueNanos;
+
+  @ffi.Uint64()
+  external int fMaxQueueNanos;
+
+  @ffi.Uint64()
+  external int fTotalEncodeNanos;
+
+  @ffi.Uint64()
+  external int fMaxEncodeNanos;
+}
+
 typedef skgpu_graphite_async_rescale_and_read_pixels_callbackFunction =
     ffi.Void Function(
       ffi.Pointer<ffi.Void> context,
@@ -17182,3 +18771,112 @@ final class sk_shaper_run_handler_procs_t extends ffi.Struct {
 
   external sk_shaper_run_handler_commit_line_proc commitLine;
 }
+
+final class sk_shaper_buffer_text_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Char> fUtf8;
+
+  @ffi.Size()
+  external int fUtf8Bytes;
+
+  external ffi.Pointer<sk_font_t> fFont;
+
+  @ffi.Bool()
+  external bool fLeftToRight;
+
+  @ffi.Float()
+  external double fWidth;
+}
+
+final class sk_shaper_buffer_run_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fGlyphOffset;
+
+  @ffi.Uint32()
+  external int fGlyphCount;
+
+  @ffi.Uint32()
+  external int fUtf8Begin;
+
+  @ffi.Uint32()
+  external int fUtf8End;
+
+  @ffi.Uint32()
+  external int fFontIndex;
+
+  @ffi.Float()
+  external double fAdvanceX;
+
+  @ffi.Uint8()
+  external int fBidiLevel;
+}
+
+final class sk_shaper_buffer_line_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fText;
+
+  @ffi.Uint32()
+  external int fRunOffset;
+
+  @ffi.Uint32()
+  external int fRunCount;
+
+  @ffi.Float()
+  external double fTop;
+
+  @ffi.Float()
+  external double fBaseline;
+
+  @ffi.Float()
+  external double fBottom;
+
+  @ffi.Float()
+  external double fWidth;
+}
+
+final class sk_shaper_buffer_data_t extends ffi.Struct {
+  external ffi.Pointer<ffi.Uint16> fGlyphs;
+
+  external ffi.Pointer<sk_point_t> fPositions;
+
+  external ffi.Pointer<ffi.Uint32> fClusters;
+
+  @ffi.Size()
+  external int fGlyphCount;
+
+  external ffi.Pointer<sk_shaper_buffer_run_t> fRuns;
+
+  @ffi.Size()
+  external int fRunCount;
+
+  external ffi.Pointer<sk_shaper_buffer_line_t> fLines;
+
+  @ffi.Size()
+  external int fLineCount;
+
+  @ffi.Size()
+  external int fFontCount;
+}
+
+final class sk_font_prewarm_request_t extends ffi.Struct {
+  external ffi.Pointer<sk_font_t> fFont;
+
+  external ffi.Pointer<ffi.Uint16> fGlyphs;
+
+  @ffi.Size()
+  external int fGlyphCount;
+
+  external ffi.Pointer<sk_matrix_t> fMatrix;
+
+  external ffi.Pointer<sk_paint_t> fPaint;
+}
+
+final class sk_font_prewarm_result_t extends ffi.Struct {
+  @ffi.Uint32()
+  external int fImageCount;
+
+  @ffi.Uint32()
+  external int fPathCount;
+
+  @ffi.Uint64()
+  external int fNanos;
+}
@@ -4,6 +4,7 @@ import 'dart:isolate';
 
 import 'package:dawn_dart_api/dawn_dart_api.dart';
 
+import 'dart:async';
 import 'dart:convert';
 import 'dart:ffi';
 import 'dart:io';
@@ -14,6 +15,7 @@ import 'package:ffi/ffi.dart' as ffi;
 import 'package:vector_math/vector_math_64.dart';
 import 'skia.g.dart';
 
+part 'async.dart';
 part 'bitmap.dart';
 part 'blend_mode.dart';
 part 'blender.dart';
@@ -23,8 +25,10 @@ part 'color_filter.dart';
 part 'color.dart';
 part 'colorspace.dart';
 part 'data.dart';
+part 'decoded_image_cache.dart';
 part 'dispose_scope.dart';
 part 'drawable.dart';
+part 'encode_queue.dart';
 part 'encoder.dart';
 part 'font.dart';
 part 'ganesh.dart';
@@ -37,6 +41,8 @@ part 'metal.dart';
 part 'paint.dart';
 part 'paragraph/font_collection.dart';
 part 'paragraph/paragraph_builder.dart';
+part 'paragraph/paragraph_editor.dart';
+part 'paragraph/paragraph_layout_cache.dart';
 part 'paragraph/paragraph_style.dart';
 part 'paragraph/paragraph.dart';
 part 'paragraph/text_style.dart';
@@ -55,6 +61,8 @@ part 'run_loop.dart';
 part 'runtime_effect.dart';
 part 'shader.dart';
 part 'shaper.dart';
+part 'shaper_buffer.dart';
+part 'shaping_cache.dart';
 part 'stream.dart';
 part 'stroke_rec.dart';
 part 'surface.dart';
@@ -62,4 +70,5 @@ part 'text_blob.dart';
 part 'typeface.dart';
 part 'types_native.dart';
 part 'unicode.dart';
+part 'unicode_analysis.dart';
 part 'vertices.dart';
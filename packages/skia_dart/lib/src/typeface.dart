@@ -568,6 +568,60 @@ class SkTypeface with _NativeMixin<sk_typeface_t> {
     return SkData._(ptr);
   }
 
+  /// Returns the contents of the specified font table without copying them.
+  ///
+  /// When the typeface was created from data or from a file, the returned
+  /// list views the typeface's own memory. Otherwise it views a copy that is
+  /// made on first access. Tables are kept in a cache shared by all
+  /// typefaces, so repeated calls usually return views of the same memory;
+  /// see [tableCacheBudget]. Each view keeps its memory alive until it is
+  /// garbage collected.
+  ///
+  /// Returns null if the table is not found.
+  Uint8List? getTableView(SkFontTableTag tag) {
+    final ptr = sk_typeface_ref_table_data(_ptr, tag, nullptr);
+    if (ptr == nullptr) return null;
+    final size = sk_data_get_size(ptr);
+    if (size == 0) {
+      sk_data_unref(ptr);
+      return Uint8List(0).asUnmodifiableView();
+    }
+    return sk_data_get_bytes(ptr)
+        .asTypedList(size, finalizer: _dataUnref, token: ptr.cast())
+        .asUnmodifiableView();
+  }
+
+  /// Returns the cached table behind [getTableView] as [SkData], and whether
+  /// it points into the typeface's own memory rather than into a copy.
+  ///
+  /// Returns null if the table is not found.
+  ({SkData data, bool borrowed})? refTableData(SkFontTableTag tag) {
+    final borrowedPtr = ffi.calloc<Bool>();
+    try {
+      final ptr = sk_typeface_ref_table_data(_ptr, tag, borrowedPtr);
+      if (ptr == nullptr) return null;
+      return (data: SkData._(ptr), borrowed: borrowedPtr.value);
+    } finally {
+      ffi.calloc.free(borrowedPtr);
+    }
+  }
+
+  /// The total size of tables kept for [getTableView], in bytes. The tables
+  /// that view a typeface's font file count the size of the file once.
+  static int get tableCacheBudget => sk_typeface_get_table_cache_budget();
+  static set tableCacheBudget(int bytes) =>
+      sk_typeface_set_table_cache_budget(bytes);
+
+  /// Releases the tables kept for [getTableView]. Views that are still
+  /// reachable stay valid.
+  static void purgeTableCache() {
+    sk_typeface_purge_table_cache();
+  }
+
+  static final Pointer<NativeFinalizerFunction> _dataUnref = Native.addressOf<
+    NativeFunction<Void Function(Pointer<sk_data_t>)>
+  >(sk_data_unref).cast();
+
   /// Returns the horizontal kerning adjustments for a run of glyphs.
   ///
   /// Adjustments are in "design units" - integers relative to [unitsPerEm].
@@ -876,3 +930,89 @@ class SkFontMgr with _NativeMixin<sk_fontmgr_t> {
     return NativeFinalizer(ptr.cast());
   }
 }
+
+/// Describes the index behind an [SkIndexedFontMgr].
+class SkFontIndexInfo {
+  const SkFontIndexInfo({
+    required this.fileCount,
+    required this.faceCount,
+    required this.familyCount,
+    required this.rebuilt,
+    required this.elapsed,
+  });
+
+  final int fileCount;
+  final int faceCount;
+  final int familyCount;
+
+  /// Whether the stored index was missing or out of date and the font files
+  /// were scanned again.
+  final bool rebuilt;
+
+  /// Time taken to list the font files and load or rebuild the index.
+  final Duration elapsed;
+
+  @override
+  String toString() =>
+      'SkFontIndexInfo(fileCount: $fileCount, faceCount: $faceCount, '
+      'familyCount: $familyCount, rebuilt: $rebuilt, elapsed: $elapsed)';
+}
+
+/// A font manager over the font files below a set of directories.
+///
+/// Scanning thousands of font files at startup is slow, so the family, style
+/// and character coverage of every face is kept in an index file that later
+/// runs memory map instead. Each start still lists the font files, and the
+/// index is rebuilt when a file is added or removed or its size or
+/// modification time changes. Typefaces are only opened when first matched.
+///
+/// Only available where FreeType is, currently Linux.
+class SkIndexedFontMgr extends SkFontMgr {
+  SkIndexedFontMgr._(super.ptr, this.info) : super._();
+
+  /// Creates a font manager over the `.ttf`, `.otf`, `.ttc` and `.otc` files
+  /// below [directories], such as `/usr/share/fonts`.
+  ///
+  /// The index is stored at [indexPath]; without one, the files are scanned
+  /// every time. Returns null if the platform is not supported.
+  static SkIndexedFontMgr? create(
+    List<String> directories, {
+    String? indexPath,
+  }) {
+    final directoriesPtr = ffi.calloc<Pointer<Char>>(directories.length + 1);
+    final indexPathPtr = indexPath?.toNativeUtf8() ?? nullptr;
+    final infoPtr = ffi.calloc<sk_fontmgr_index_info_t>();
+    try {
+      for (var i = 0; i < directories.length; ++i) {
+        directoriesPtr[i] = directories[i].toNativeUtf8().cast();
+      }
+      final ptr = sk_fontmgr_create_indexed(
+        directoriesPtr,
+        directories.length,
+        indexPathPtr.cast(),
+        infoPtr,
+      );
+      if (ptr == nullptr) return null;
+      final info = infoPtr.ref;
+      return SkIndexedFontMgr._(
+        ptr,
+        SkFontIndexInfo(
+          fileCount: info.fFileCount,
+          faceCount: info.fFaceCount,
+          familyCount: info.fFamilyCount,
+          rebuilt: info.fRebuilt,
+          elapsed: Duration(microseconds: info.fNanos ~/ 1000),
+        ),
+      );
+    } finally {
+      for (var i = 0; i < directories.length; ++i) {
+        ffi.calloc.free(directoriesPtr[i]);
+      }
+      ffi.calloc.free(directoriesPtr);
+      if (indexPathPtr != nullptr) ffi.calloc.free(indexPathPtr);
+      ffi.calloc.free(infoPtr);
+    }
+  }
+
+  final SkFontIndexInfo info;
+}
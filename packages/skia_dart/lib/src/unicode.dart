@@ -23,6 +23,69 @@ class SkUnicode with _NativeMixin<sk_unicode_t> {
     return SkUnicode._(ptr);
   }
 
+  /// Computes grapheme, line and word breaks, whitespace, control characters
+  /// and bidi regions of [texts] into [analysis], replacing its previous
+  /// contents.
+  ///
+  /// Texts are analyzed concurrently on native worker threads, at most
+  /// [maxThreads] including the calling one (0 means no limit), and each
+  /// thread reuses its break iterators across texts and calls. Results are
+  /// looked up in and added to [cache] if given.
+  ///
+  /// Returns false if a text could not be analyzed; its flags are then all
+  /// zero and it has no bidi regions.
+  bool analyze(
+    List<SkUnicodeText> texts,
+    SkUnicodeAnalysis analysis, {
+    SkUnicodeAnalysisCache? cache,
+    int maxThreads = 0,
+  }) {
+    // Texts and NUL-terminated locales share one allocation.
+    final bytes = BytesBuilder(copy: false);
+    final textOffsets = List<int>.filled(texts.length, 0);
+    final textLengths = List<int>.filled(texts.length, 0);
+    final localeOffsets = List<int>.filled(texts.length, -1);
+    for (var i = 0; i < texts.length; i++) {
+      final units = utf8.encode(texts[i].text);
+      textOffsets[i] = bytes.length;
+      textLengths[i] = units.length;
+      bytes.add(units);
+      final locale = texts[i].locale;
+      if (locale != null) {
+        localeOffsets[i] = bytes.length;
+        bytes.add(utf8.encode(locale));
+        bytes.addByte(0);
+      }
+    }
+    // Both allocations are at least one element so that none is zero sized.
+    final textsPtr = ffi.calloc<sk_unicode_analysis_text_t>(texts.length + 1);
+    final bytesPtr = ffi.malloc<Uint8>(bytes.length + 1);
+    try {
+      bytesPtr.asTypedList(bytes.length).setAll(0, bytes.takeBytes());
+      for (var i = 0; i < texts.length; i++) {
+        final native = (textsPtr + i).ref;
+        native.fUtf8 = (bytesPtr + textOffsets[i]).cast();
+        native.fUtf8Bytes = textLengths[i];
+        native.fLocale = localeOffsets[i] < 0
+            ? nullptr
+            : (bytesPtr + localeOffsets[i]).cast();
+        native.fLeftToRight = texts[i].leftToRight;
+      }
+      return sk_unicode_analyze(
+        _ptr,
+        textsPtr,
+        texts.length,
+        cache?._ptr ?? nullptr,
+        maxThreads,
+        analysis._ptr,
+      );
+    } finally {
+      ffi.calloc.free(textsPtr);
+      ffi.malloc.free(bytesPtr);
+      analysis._update();
+    }
+  }
+
   @override
   void dispose() {
     _dispose(sk_unicode_unref, _finalizer);
@@ -0,0 +1,234 @@
+part of 'skia_dart_library.dart';
+
+/// Bits of the per code unit flags of an [SkUnicodeAnalysis].
+abstract final class SkUnicodeAnalysisFlags {
+  static final whitespace =
+      sk_unicode_analysis_flags_t.WHITESPACE_SK_UNICODE_ANALYSIS_FLAGS.value;
+  static final graphemeStart = sk_unicode_analysis_flags_t
+      .GRAPHEME_START_SK_UNICODE_ANALYSIS_FLAGS
+      .value;
+
+  /// A line may break before this code unit.
+  static final softLineBreakBefore = sk_unicode_analysis_flags_t
+      .SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS
+      .value;
+
+  /// A line must break before this code unit.
+  static final hardLineBreakBefore = sk_unicode_analysis_flags_t
+      .HARD_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS
+      .value;
+  static final wordBreak =
+      sk_unicode_analysis_flags_t.WORD_BREAK_SK_UNICODE_ANALYSIS_FLAGS.value;
+  static final control =
+      sk_unicode_analysis_flags_t.CONTROL_SK_UNICODE_ANALYSIS_FLAGS.value;
+}
+
+/// A text to analyze with [SkUnicode.analyze].
+class SkUnicodeText {
+  const SkUnicodeText(this.text, {this.locale, this.leftToRight = true});
+
+  final String text;
+
+  /// The locale for word breaks, or null for the default locale.
+  final String? locale;
+
+  /// The paragraph direction for bidi regions.
+  final bool leftToRight;
+}
+
+/// A range of UTF-8 code units with one bidi embedding level.
+class SkUnicodeBidiRegion {
+  const SkUnicodeBidiRegion(this.start, this.end, this.level);
+
+  final int start;
+  final int end;
+  final int level;
+
+  @override
+  bool operator ==(Object other) =>
+      other is SkUnicodeBidiRegion &&
+      other.start == start &&
+      other.end == end &&
+      other.level == level;
+
+  @override
+  int get hashCode => Object.hash(start, end, level);
+
+  @override
+  String toString() => 'SkUnicodeBidiRegion($start, $end, level: $level)';
+}
+
+/// The results of analyzing a batch of texts with [SkUnicode.analyze].
+///
+/// Every text has one flag byte per UTF-8 code unit plus one for the end of
+/// the text, made of [SkUnicodeAnalysisFlags] bits. The flags of all texts are
+/// stored in one native array that [flags] and [flagsOf] view without
+/// copying; the views are only valid until the analysis is reused or
+/// disposed. Reusing one analysis for every batch reuses its storage.
+class SkUnicodeAnalysis with _NativeMixin<sk_unicode_analysis_t> {
+  SkUnicodeAnalysis() : this._(sk_unicode_analysis_new());
+
+  SkUnicodeAnalysis._(Pointer<sk_unicode_analysis_t> ptr) {
+    _attach(ptr, _finalizer);
+    _update();
+  }
+
+  Uint8List _flags = Uint8List(0);
+  Pointer<sk_unicode_bidi_region_t> _bidiRegions = nullptr;
+  Pointer<sk_unicode_analysis_text_result_t> _texts = nullptr;
+  int _textCount = 0;
+
+  int get textCount => _textCount;
+
+  /// The flags of all texts.
+  Uint8List get flags => _flags;
+
+  /// The flags of text [index], indexed by UTF-8 offset.
+  Uint8List flagsOf(int index) {
+    RangeError.checkValidIndex(index, this, 'index', _textCount);
+    final start = (_texts + index).ref.fFlagOffset;
+    final end = index + 1 < _textCount
+        ? (_texts + index + 1).ref.fFlagOffset
+        : _flags.length;
+    return Uint8List.sublistView(_flags, start, end);
+  }
+
+  /// The bidi regions of text [index].
+  List<SkUnicodeBidiRegion> bidiRegionsOf(int index) {
+    RangeError.checkValidIndex(index, this, 'index', _textCount);
+    final text = (_texts + index).ref;
+    return List.generate(text.fBidiRegionCount, (i) {
+      final region = (_bidiRegions + text.fBidiRegionOffset + i).ref;
+      return SkUnicodeBidiRegion(region.fStart, region.fEnd, region.fLevel);
+    }, growable: false);
+  }
+
+  /// Whether the results of text [index] came from the cache.
+  bool isCached(int index) {
+    RangeError.checkValidIndex(index, this, 'index', _textCount);
+    return (_texts + index).ref.fCached;
+  }
+
+  void _update() {
+    final ptr = _dataPtr;
+    sk_unicode_analysis_get_data(_ptr, ptr);
+    final data = ptr.ref;
+    _flags = data.fFlagCount == 0
+        ? Uint8List(0)
+        : data.fFlags.asTypedList(data.fFlagCount);
+    _bidiRegions = data.fBidiRegions;
+    _texts = data.fTexts;
+    _textCount = data.fTextCount;
+  }
+
+  @override
+  void dispose() {
+    _flags = Uint8List(0);
+    _textCount = 0;
+    _dispose(sk_unicode_analysis_delete, _finalizer);
+  }
+
+  static final _dataPtr = ffi.calloc<sk_unicode_analysis_data_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<
+      NativeFunction<Void Function(Pointer<sk_unicode_analysis_t>)>
+    >
+    ptr = Native.addressOf(sk_unicode_analysis_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
+
+/// Counters of an [SkUnicodeAnalysisCache].
+class SkUnicodeAnalysisCacheStats {
+  const SkUnicodeAnalysisCacheStats({
+    required this.hits,
+    required this.misses,
+    required this.evictions,
+    required this.bytes,
+    required this.entryCount,
+  });
+
+  final int hits;
+  final int misses;
+  final int evictions;
+
+  /// Estimated bytes held by the cached results.
+  final int bytes;
+  final int entryCount;
+
+  @override
+  String toString() =>
+      'SkUnicodeAnalysisCacheStats(hits: $hits, misses: $misses, '
+      'evictions: $evictions, bytes: $bytes, entryCount: $entryCount)';
+}
+
+/// A cache of [SkUnicode.analyze] results with a byte budget.
+///
+/// Entries are keyed by the text, the locale and the direction, so a cache
+/// should only be used with one [SkUnicode] implementation. Least recently
+/// used entries are evicted once the budget is exceeded.
+class SkUnicodeAnalysisCache with _NativeMixin<sk_unicode_analysis_cache_t> {
+  SkUnicodeAnalysisCache({required int byteBudget})
+    : this._(
+        sk_unicode_analysis_cache_new(
+          RangeError.checkNotNegative(byteBudget, 'byteBudget'),
+        ),
+      );
+
+  SkUnicodeAnalysisCache._(Pointer<sk_unicode_analysis_cache_t> ptr) {
+    _attach(ptr, _finalizer);
+  }
+
+  /// The maximum number of bytes held by the cache.
+  ///
+  /// Lowering the budget evicts entries right away.
+  int get byteBudget => sk_unicode_analysis_cache_get_budget(_ptr);
+
+  set byteBudget(int value) {
+    RangeError.checkNotNegative(value, 'byteBudget');
+    sk_unicode_analysis_cache_set_budget(_ptr, value);
+  }
+
+  /// Evicts all entries.
+  void purge() {
+    sk_unicode_analysis_cache_purge(_ptr);
+  }
+
+  SkUnicodeAnalysisCacheStats get stats {
+    final ptr = _statsPtr;
+    sk_unicode_analysis_cache_get_stats(_ptr, ptr);
+    final stats = ptr.ref;
+    return SkUnicodeAnalysisCacheStats(
+      hits: stats.fHits,
+      misses: stats.fMisses,
+      evictions: stats.fEvictions,
+      bytes: stats.fBytes,
+      entryCount: stats.fEntryCount,
+    );
+  }
+
+  /// Resets the hit, miss and eviction counters.
+  void resetStats() {
+    sk_unicode_analysis_cache_reset_stats(_ptr);
+  }
+
+  @override
+  void dispose() {
+    _dispose(sk_unicode_analysis_cache_delete, _finalizer);
+  }
+
+  static final _statsPtr = ffi.calloc<sk_unicode_analysis_cache_stats_t>();
+
+  static final _finalizer = _createFinalizer();
+
+  static NativeFinalizer _createFinalizer() {
+    final Pointer<
+      NativeFunction<Void Function(Pointer<sk_unicode_analysis_cache_t>)>
+    >
+    ptr = Native.addressOf(sk_unicode_analysis_cache_delete);
+    return NativeFinalizer(ptr.cast());
+  }
+}
@@ -0,0 +1,47 @@
+import 'package:skia_dart/skia_dart.dart';
+import 'package:skia_dart/src/skia_dart_library.dart' show AsyncTask;
+import 'package:test/test.dart';
+
+void main() {
+  group('SkAsync', () {
+    test('has worker threads', () {
+      expect(SkAsync.threadCount, greaterThan(0));
+    });
+
+    test('delivers completions on the isolate', () async {
+      SkAsync.resetStats();
+      final tasks = List.generate(16, (_) => AsyncTask.empty());
+      final results = await Future.wait(tasks.map((task) => task.done));
+      expect(results, everyElement(isTrue));
+
+      final stats = SkAsync.stats;
+      // Other test isolates may share the pool.
+      expect(stats.submitted, greaterThanOrEqualTo(16));
+      expect(stats.completed, greaterThanOrEqualTo(16));
+      expect(stats.maxQueueTime, lessThanOrEqualTo(stats.totalQueueTime));
+    });
+
+    test('cancelled tasks still complete', () async {
+      SkAsync.resetStats();
+      final tasks = List.generate(64, (_) => AsyncTask.empty());
+      final cancelled = tasks.map((task) => task.cancel()).toList();
+      final results = await Future.wait(tasks.map((task) => task.done));
+      for (var i = 0; i < tasks.length; ++i) {
+        // A task reports cancellation exactly when cancel() won the race.
+        expect(results[i], !cancelled[i]);
+      }
+      final stats = SkAsync.stats;
+      expect(stats.completed + stats.cancelled, greaterThanOrEqualTo(64));
+      expect(
+        stats.cancelled,
+        greaterThanOrEqualTo(cancelled.where((c) => c).length),
+      );
+    });
+
+    test('cancel after completion does nothing', () async {
+      final task = AsyncTask.empty();
+      expect(await task.done, isTrue);
+      expect(task.cancel(), isFalse);
+    });
+  });
+}
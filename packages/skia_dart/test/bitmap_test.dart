@@ -1,6 +1,7 @@
 import 'dart:ffi';
 import 'dart:typed_data';
 
+import 'package:ffi/ffi.dart' as ffi;
 import 'package:skia_dart/skia_dart.dart';
 import 'package:test/test.dart';
 
@@ -262,6 +263,43 @@ void main() {
       });
     });
 
+    test('getPixelColors matches getPixelColor', () {
+      SkAutoDisposeScope.run(() {
+        // Large enough to be read in several chunks.
+        const width = 640;
+        const height = 480;
+        for (final colorType in [SkColorType.rgba8888, SkColorType.alpha8]) {
+          final bitmap = SkBitmap();
+          bitmap.tryAllocPixels(
+            SkImageInfo(
+              width: width,
+              height: height,
+              colorType: colorType,
+              alphaType: SkAlphaType.premul,
+            ),
+          );
+          bitmap.eraseColor(SkColor(0x80FF0000));
+          bitmap.eraseRect(
+            SkColor(0xFF0000FF),
+            const SkIRect.fromLTRB(600, 400, 640, 480),
+          );
+
+          final colors = ffi.calloc<Uint32>(width * height);
+          try {
+            bitmap.getPixelColors(colors);
+            for (final (x, y) in [(0, 0), (599, 399), (600, 400), (639, 479)]) {
+              expect(
+                SkColor(colors[y * width + x]),
+                bitmap.getPixelColor(x, y),
+              );
+            }
+          } finally {
+            ffi.calloc.free(colors);
+          }
+        }
+      });
+    });
+
     test('getAddr32 returns pixel address', () {
       SkAutoDisposeScope.run(() {
         final bitmap = SkBitmap();
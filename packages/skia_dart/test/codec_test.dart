@@ -164,6 +164,94 @@ void main() {
     });
   });
 
+  group('SkCodec.decodeBatch', () {
+    test('decodes every request in order', () {
+      SkAutoDisposeScope.run(() {
+        final png = loadTestPng(width: 100, height: 75);
+        final jpeg = loadTestJpeg();
+        final invalid = SkData.fromBytes(Uint8List.fromList([1, 2, 3, 4]));
+        final results = SkCodec.decodeBatch([
+          SkCodecDecodeRequest(png),
+          SkCodecDecodeRequest(jpeg, width: 20, height: 30),
+          SkCodecDecodeRequest(invalid),
+          SkCodecDecodeRequest(png, width: 40),
+        ]);
+        expect(results, hasLength(4));
+
+        expect(results[0].result, SkCodecResult.success);
+        expect(results[0].bitmap!.info.width, 100);
+        expect(results[0].bitmap!.info.height, 75);
+        expect(results[0].decodedSize, const SkISize(100, 75));
+
+        expect(results[1].result, SkCodecResult.success);
+        expect(results[1].bitmap!.info.width, 20);
+        expect(results[1].bitmap!.info.height, 30);
+
+        expect(results[2].result, SkCodecResult.invalidInput);
+        expect(results[2].bitmap, isNull);
+
+        // Height follows the aspect ratio.
+        expect(results[3].bitmap!.info.width, 40);
+        expect(results[3].bitmap!.info.height, 30);
+      });
+    });
+
+    test('uses native scaling for smaller JPEG requests', () {
+      SkAutoDisposeScope.run(() {
+        final jpeg = loadTestJpeg();
+        final result = SkCodec.decodeBatch([
+          SkCodecDecodeRequest(jpeg, width: 25, height: 25),
+        ]).single;
+        expect(result.result, SkCodecResult.success);
+        expect(result.decodedSize.width, lessThan(50));
+        expect(result.decodedSize.width, greaterThanOrEqualTo(25));
+        expect(result.bitmap!.info.width, 25);
+        expect(result.bitmap!.info.height, 25);
+      });
+    });
+
+    test('matches decoding with a single codec', () {
+      SkAutoDisposeScope.run(() {
+        final data = loadTestPng(width: 100, height: 100);
+        final results = SkCodec.decodeBatch(
+          List.generate(
+            8,
+            (_) => SkCodecDecodeRequest(
+              data,
+              colorType: SkColorType.rgba8888,
+            ),
+          ),
+        );
+        final codec = SkCodec.fromData(data)!;
+        final expected = codec.decodeToBitmap(
+          info: codec.getInfo().copyWith(
+            colorType: SkColorType.rgba8888,
+            alphaType: SkAlphaType.premul,
+          ),
+        )!;
+        for (final result in results) {
+          final bitmap = result.bitmap!;
+          expect(bitmap.info.colorType, SkColorType.rgba8888);
+          for (var y = 0; y < 100; y += 7) {
+            for (var x = 0; x < 100; x += 7) {
+              expect(bitmap.getPixelColor(x, y), expected.getPixelColor(x, y));
+            }
+          }
+        }
+      });
+    });
+
+    test('rejects negative sizes', () {
+      SkAutoDisposeScope.run(() {
+        final data = loadTestPng();
+        expect(
+          () => SkCodec.decodeBatch([SkCodecDecodeRequest(data, width: -1)]),
+          throwsRangeError,
+        );
+      });
+    });
+  });
+
   group('SkCodec animated GIF', () {
     test('GIF codec detected correctly', () {
       SkAutoDisposeScope.run(() {
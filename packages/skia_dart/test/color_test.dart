@@ -1,4 +1,8 @@
+import 'dart:ffi';
+
+import 'package:ffi/ffi.dart';
 import 'package:skia_dart/skia_dart.dart';
+import 'package:skia_dart/src/skia.g.dart';
 import 'package:test/test.dart';
 
 void main() {
@@ -649,4 +653,53 @@ void main() {
       expect(unpremul.a, closeTo(original.a, 0.0001));
     });
   });
+
+  group('premultiply arrays', () {
+    // Every alpha with every value of one channel, and the other channels
+    // derived from it.
+    final colors = [
+      for (var alpha = 0; alpha < 256; alpha++)
+        for (var value = 0; value < 256; value++)
+          SkColor.fromARGB(alpha, value, 255 - value, value * 97 & 0xff).value,
+    ];
+
+    Matcher withinOne(int expected) => predicate<int>((actual) {
+      for (var shift = 0; shift < 32; shift += 8) {
+        final delta = (actual >> shift & 0xff) - (expected >> shift & 0xff);
+        if (delta.abs() > 1) return false;
+      }
+      return true;
+    }, 'within one of 0x${expected.toRadixString(16)} in each channel');
+
+    test('premultiply matches the scalar conversion', () {
+      final src = calloc<Uint32>(colors.length);
+      final dst = calloc<Uint32>(colors.length);
+      try {
+        src.asTypedList(colors.length).setAll(0, colors);
+        sk_color_premultiply_array(src, colors.length, dst);
+        for (var i = 0; i < colors.length; i++) {
+          expect(dst[i], withinOne(sk_color_premultiply(colors[i])));
+        }
+      } finally {
+        calloc.free(src);
+        calloc.free(dst);
+      }
+    });
+
+    test('unpremultiply matches the scalar conversion', () {
+      final pmcolors = [for (final c in colors) sk_color_premultiply(c)];
+      final src = calloc<Uint32>(pmcolors.length);
+      final dst = calloc<Uint32>(pmcolors.length);
+      try {
+        src.asTypedList(pmcolors.length).setAll(0, pmcolors);
+        sk_color_unpremultiply_array(src, pmcolors.length, dst);
+        for (var i = 0; i < pmcolors.length; i++) {
+          expect(dst[i], withinOne(sk_color_unpremultiply(pmcolors[i])));
+        }
+      } finally {
+        calloc.free(src);
+        calloc.free(dst);
+      }
+    });
+  });
 }
@@ -0,0 +1,109 @@
+import 'dart:io';
+import 'dart:typed_data';
+
+import 'package:skia_dart/skia_dart.dart';
+import 'package:test/test.dart';
+
+final _goldensDir = '${Directory.current.path}/test/goldens';
+
+SkData _loadPng({int width = 100, int height = 100}) {
+  final bytes = File(
+    '$_goldensDir/codec_test_${width}x$height.png',
+  ).readAsBytesSync();
+  return SkData.fromBytes(bytes);
+}
+
+void main() {
+  group('SkDecodedImageCache', () {
+    test('decodes at the requested size', () {
+      SkAutoDisposeScope.run(() {
+        final cache = SkDecodedImageCache(byteBudget: 1 << 20);
+        final data = _loadPng(width: 100, height: 75);
+        final full = cache.get(data)!;
+        expect(full.width, 100);
+        expect(full.height, 75);
+        final thumbnail = cache.get(data, width: 40)!;
+        expect(thumbnail.width, 40);
+        expect(thumbnail.height, 30);
+        expect(thumbnail.isLazyGenerated, isFalse);
+      });
+    });
+
+    test('hits for the same content, size and color type', () {
+      SkAutoDisposeScope.run(() {
+        final cache = SkDecodedImageCache(byteBudget: 1 << 20);
+        const rgba = SkColorType.rgba8888;
+        // Separate SkData instances with equal bytes share entries.
+        final first = cache.get(_loadPng(), width: 64, colorType: rgba)!;
+        final second = cache.get(_loadPng(), width: 64, colorType: rgba)!;
+        expect(second.uniqueId, first.uniqueId);
+        cache.get(_loadPng(), width: 32, colorType: rgba);
+        cache.get(_loadPng(), width: 64, colorType: SkColorType.bgra8888);
+
+        final stats = cache.stats;
+        expect(stats.hits, 1);
+        expect(stats.misses, 3);
+        expect(stats.evictions, 0);
+        expect(stats.entryCount, 3);
+        expect(stats.bytes, 64 * 64 * 4 * 2 + 32 * 32 * 4);
+      });
+    });
+
+    test('evicts least recently used entries over budget', () {
+      SkAutoDisposeScope.run(() {
+        final entryBytes = 50 * 50 * 4;
+        final cache = SkDecodedImageCache(byteBudget: entryBytes * 2);
+        final data = _loadPng();
+        SkImage? get(int width, int height) => cache.get(
+          data,
+          width: width,
+          height: height,
+          colorType: SkColorType.rgba8888,
+        );
+        get(50, 50);
+        get(50, 49);
+        // Touch the first entry so the second one is the oldest.
+        get(50, 50);
+        get(49, 50);
+
+        var stats = cache.stats;
+        expect(stats.evictions, 1);
+        expect(stats.entryCount, 2);
+        expect(stats.bytes, lessThanOrEqualTo(entryBytes * 2));
+
+        cache.resetStats();
+        get(50, 50);
+        expect(cache.stats.hits, 1);
+        get(50, 49);
+        expect(cache.stats.misses, 1);
+
+        cache.byteBudget = 0;
+        stats = cache.stats;
+        expect(stats.entryCount, 0);
+        expect(stats.bytes, 0);
+      });
+    });
+
+    test('returned images outlive eviction', () {
+      SkAutoDisposeScope.run(() {
+        final cache = SkDecodedImageCache(byteBudget: 1 << 20);
+        final image = cache.get(_loadPng(), width: 20, height: 20)!;
+        cache.purge();
+        expect(cache.stats.entryCount, 0);
+        expect(image.width, 20);
+        final pixmap = SkPixmap();
+        expect(image.peekPixels(pixmap), isTrue);
+      });
+    });
+
+    test('returns null for invalid data', () {
+      SkAutoDisposeScope.run(() {
+        final cache = SkDecodedImageCache(byteBudget: 1 << 20);
+        final data = SkData.fromBytes(Uint8List.fromList([1, 2, 3, 4]));
+        expect(cache.get(data), isNull);
+        expect(cache.stats.misses, 1);
+        expect(cache.stats.entryCount, 0);
+      });
+    });
+  });
+}
@@ -606,6 +606,286 @@ void main() {
     });
   });
 
+  group('SkCanvasCommandBuffer', () {
+    void drawScene(
+      SkCanvas canvas,
+      SkPaint fill,
+      SkPaint stroke,
+      SkPath path,
+      SkRRect rrect,
+    ) {
+      canvas.clear(SkColor(0xFFFFFFFF));
+      canvas.save();
+      canvas.translate(10, 5);
+      canvas.rotate(15);
+      canvas.drawRect(SkRect.fromLTRB(0, 0, 30, 20), fill);
+      canvas.restore();
+      canvas.drawCircle(70, 30, 15, stroke);
+      canvas.drawLine(5, 95, 95, 60, stroke);
+      canvas.clipRect(SkRect.fromLTRB(0, 40, 100, 100), doAntiAlias: true);
+      canvas.drawPath(path, fill);
+      canvas.drawRRect(rrect, stroke);
+      canvas.drawPoints(SkPointMode.polygon, const [
+        SkPoint(10, 50),
+        SkPoint(30, 70),
+        SkPoint(50, 50),
+      ], stroke);
+      canvas.saveLayer(paint: SkPaint()..alpha = 128);
+      canvas.drawArc(SkRect.fromLTRB(50, 50, 90, 90), 0, 270, true, fill);
+      canvas.restore();
+    }
+
+    void recordScene(
+      SkCanvasCommandBuffer commands,
+      SkPaint fill,
+      SkPaint stroke,
+      SkPath path,
+      SkRRect rrect,
+    ) {
+      commands.clear(SkColor(0xFFFFFFFF));
+      commands.save();
+      commands.translate(10, 5);
+      commands.rotate(15);
+      commands.drawRect(SkRect.fromLTRB(0, 0, 30, 20), fill);
+      commands.restore();
+      commands.drawCircle(70, 30, 15, stroke);
+      commands.drawLine(5, 95, 95, 60, stroke);
+      commands.clipRect(SkRect.fromLTRB(0, 40, 100, 100), doAntiAlias: true);
+      commands.drawPath(path, fill);
+      commands.drawRRect(rrect, stroke);
+      commands.drawPoints(SkPointMode.polygon, const [
+        SkPoint(10, 50),
+        SkPoint(30, 70),
+        SkPoint(50, 50),
+      ], stroke);
+      commands.saveLayer(paint: SkPaint()..alpha = 128);
+      commands.drawArc(SkRect.fromLTRB(50, 50, 90, 90), 0, 270, true, fill);
+      commands.restore();
+    }
+
+    test('matches direct drawing', () {
+      SkAutoDisposeScope.run(() {
+        final fill = SkPaint()..color = SkColor(0xFF3366CC);
+        final stroke = SkPaint()
+          ..color = SkColor(0xFFCC3300)
+          ..style = SkPaintStyle.stroke
+          ..strokeWidth = 3;
+        final path = (SkPathBuilder()
+              ..moveTo(20, 60)
+              ..lineTo(80, 60)
+              ..lineTo(50, 95)
+              ..close())
+            .detach();
+        final rrect = SkRRect()
+          ..setRectXY(SkRect.fromLTRB(15, 45, 85, 90), 8, 8);
+
+        final direct = createSurface();
+        drawScene(direct.canvas, fill, stroke, path, rrect);
+
+        final batched = createSurface();
+        final commands = SkCanvasCommandBuffer();
+        recordScene(commands, fill, stroke, path, rrect);
+        // fill, stroke, path, rrect and the layer paint.
+        expect(commands.objectCount, 5);
+        batched.canvas.executeCommands(commands);
+
+        final expected = SkPixmap();
+        final actual = SkPixmap();
+        expect(direct.peekPixels(expected), isTrue);
+        expect(batched.peekPixels(actual), isTrue);
+        for (var y = 0; y < 100; y++) {
+          for (var x = 0; x < 100; x++) {
+            expect(
+              actual.getPixelColor(x, y),
+              expected.getPixelColor(x, y),
+              reason: 'pixel ($x, $y)',
+            );
+          }
+        }
+      });
+    });
+
+    test('matches direct drawing for the remaining canvas methods', () {
+      SkAutoDisposeScope.run(() {
+        final imageSurface = createSurface(width: 16, height: 16);
+        imageSurface.canvas
+          ..clear(SkColor(0xFF00AA00))
+          ..drawRect(
+            SkRect.fromLTRB(4, 4, 12, 12),
+            SkPaint()..color = SkColor(0xFFAA00AA),
+          );
+        final image = imageSurface.makeImageSnapshot()!;
+
+        final fill = SkPaint()..color = SkColor(0xFF3366CC);
+        final recorder = SkPictureRecorder();
+        recorder
+            .beginRecording(SkRect.fromLTRB(0, 0, 30, 30))
+            .drawCircle(15, 15, 12, fill);
+        final picture = recorder.finishRecording();
+        recorder
+            .beginRecording(SkRect.fromLTRB(0, 0, 30, 30))
+            .drawOval(SkRect.fromLTRB(0, 5, 30, 25), fill);
+        final drawable = recorder.finishRecordingAsDrawable();
+
+        final layer = SkCanvasSaveLayerRec(
+          bounds: SkRect.fromLTRB(0, 0, 50, 50),
+          paint: SkPaint()..alpha = 160,
+          backdrop: SkImageFilter.blur(sigmaX: 2, sigmaY: 2),
+        );
+        final lattice = SkLattice(
+          xDivs: [4, 12],
+          yDivs: [4, 12],
+          rectTypes: List.generate(
+            9,
+            (i) => i == 4
+                ? SkLatticeRectType.fixedColor
+                : SkLatticeRectType.defaultRect,
+          ),
+          colors: List.filled(9, SkColor(0xFFCC3300)),
+        );
+        final cubics = const [
+          SkPoint(5, 60),
+          SkPoint(15, 55),
+          SkPoint(25, 65),
+          SkPoint(35, 60),
+          SkPoint(40, 70),
+          SkPoint(30, 80),
+          SkPoint(35, 90),
+          SkPoint(25, 95),
+          SkPoint(15, 85),
+          SkPoint(5, 90),
+          SkPoint(10, 80),
+          SkPoint(0, 70),
+        ];
+        final cornerColors = [
+          SkColor(0xFFFF0000),
+          SkColor(0xFF00FF00),
+          SkColor(0xFF0000FF),
+          SkColor(0xFFFFFF00),
+        ];
+        final annotation = SkData.fromBytes(
+          Uint8List.fromList('https://skia.org'.codeUnits),
+        );
+
+        final direct = createSurface();
+        direct.canvas
+          ..clearColor4f(const SkColor4f(1, 1, 1, 1))
+          ..drawColor4f(const SkColor4f(0, 0, 1, 0.25), SkBlendMode.srcOver)
+          ..saveLayerRec(layer)
+          ..drawRect(SkRect.fromLTRB(10, 10, 40, 40), fill)
+          ..restore()
+          ..drawPicture(picture, matrix: Matrix3.identity()..translate(60, 0))
+          ..drawDrawable(drawable, matrix: Matrix3.identity()..translate(0, 30))
+          ..drawImageNine(
+            image,
+            const SkIRect.fromLTRB(4, 4, 12, 12),
+            SkRect.fromLTRB(45, 35, 95, 55),
+          )
+          ..drawImageLattice(image, lattice, SkRect.fromLTRB(60, 60, 95, 95))
+          ..drawAtlas(
+            image,
+            [SkRSXForm(1, 0, 40, 80)],
+            [SkRect.fromLTRB(0, 0, 16, 16)],
+            colors: [SkColor(0xFF808080)],
+            mode: SkBlendMode.modulate,
+          )
+          ..drawPatch(
+            cubics,
+            colors: cornerColors,
+            mode: SkBlendMode.dst,
+            paint: fill,
+          )
+          ..drawUrlAnnotation(SkRect.fromLTRB(0, 0, 10, 10), annotation);
+
+        final batched = createSurface();
+        final commands = SkCanvasCommandBuffer()
+          ..clearColor4f(const SkColor4f(1, 1, 1, 1))
+          ..drawColor4f(const SkColor4f(0, 0, 1, 0.25), SkBlendMode.srcOver)
+          ..saveLayerRec(layer)
+          ..drawRect(SkRect.fromLTRB(10, 10, 40, 40), fill)
+          ..restore()
+          ..drawPicture(picture, matrix: Matrix3.identity()..translate(60, 0))
+          ..drawDrawable(drawable, matrix: Matrix3.identity()..translate(0, 30))
+          ..drawImageNine(
+            image,
+            const SkIRect.fromLTRB(4, 4, 12, 12),
+            SkRect.fromLTRB(45, 35, 95, 55),
+          )
+          ..drawImageLattice(image, lattice, SkRect.fromLTRB(60, 60, 95, 95))
+          ..drawAtlas(
+            image,
+            [SkRSXForm(1, 0, 40, 80)],
+            [SkRect.fromLTRB(0, 0, 16, 16)],
+            colors: [SkColor(0xFF808080)],
+            mode: SkBlendMode.modulate,
+          )
+          ..drawPatch(
+            cubics,
+            colors: cornerColors,
+            mode: SkBlendMode.dst,
+            paint: fill,
+          )
+          ..drawUrlAnnotation(SkRect.fromLTRB(0, 0, 10, 10), annotation);
+        batched.canvas.executeCommands(commands);
+
+        final expected = SkPixmap();
+        final actual = SkPixmap();
+        expect(direct.peekPixels(expected), isTrue);
+        expect(batched.peekPixels(actual), isTrue);
+        for (var y = 0; y < 100; y++) {
+          for (var x = 0; x < 100; x++) {
+            expect(
+              actual.getPixelColor(x, y),
+              expected.getPixelColor(x, y),
+              reason: 'pixel ($x, $y)',
+            );
+          }
+        }
+      });
+    });
+
+    test('drawImageLattice rejects fixed colors without colors', () {
+      SkAutoDisposeScope.run(() {
+        final image = createSurface(width: 16, height: 16).makeImageSnapshot()!;
+        final lattice = SkLattice(
+          xDivs: [4],
+          yDivs: [4],
+          rectTypes: List.filled(4, SkLatticeRectType.fixedColor),
+        );
+        expect(
+          () => SkCanvasCommandBuffer().drawImageLattice(
+            image,
+            lattice,
+            SkRect.fromLTRB(0, 0, 16, 16),
+          ),
+          throwsArgumentError,
+        );
+      });
+    });
+
+    test('reset discards recorded commands', () {
+      SkAutoDisposeScope.run(() {
+        final surface = createSurface();
+        final commands = SkCanvasCommandBuffer()
+          ..clear(SkColor(0xFFFF0000));
+        expect(commands.isEmpty, isFalse);
+
+        commands.reset();
+        expect(commands.isEmpty, isTrue);
+        expect(commands.objectCount, 0);
+
+        commands.clear(SkColor(0xFF00FF00));
+        surface.canvas.executeCommands(commands);
+        // Executing the same buffer twice is allowed.
+        surface.canvas.executeCommands(commands);
+
+        final pixmap = SkPixmap();
+        expect(surface.peekPixels(pixmap), isTrue);
+        expect(pixmap.getPixelColor(50, 50), SkColor(0xFF00FF00));
+      });
+    });
+  });
+
   group('SkPathBuilder', () {
     test('lineTo moveTo', () {
       SkAutoDisposeScope.run(() {
@@ -366,4 +366,306 @@ void main() {
       });
     });
   });
+
+  group('Animated WebP', () {
+    const colors = [0xFFFF0000, 0xFF00FF00, 0xFF0000FF];
+    const durations = [40, 80, 120];
+
+    SkPixmap createFramePixmap(int color, {int width = 20, int height = 10}) {
+      final surface = createSurface(width: width, height: height);
+      surface.canvas.clear(SkColor(color));
+      final pixmap = SkPixmap();
+      expect(surface.peekPixels(pixmap), isTrue);
+      return pixmap;
+    }
+
+    const lossless = SkWebpEncoderOptions(
+      compression: SkWebpEncoderCompression.lossless,
+      quality: 50,
+    );
+
+    void expectAnimation(SkData data, {required int repetitionCount}) {
+      final codec = SkCodec.fromData(data)!;
+      expect(codec.getEncodedFormat(), SkEncodedImageFormat.webp);
+      expect(codec.getInfo().width, 20);
+      expect(codec.getInfo().height, 10);
+      expect(codec.getFrameCount(), 3);
+      expect(codec.getRepetitionCount(), repetitionCount);
+      expect(
+        codec.getFrameInfo().map((frame) => frame.duration),
+        durations,
+      );
+      final first = SkPixmap();
+      codec.decodeToBitmap()!.peekPixels(first);
+      expect(first.getPixelColor(5, 5), SkColor(colors[0]));
+    }
+
+    test('encodeAnimated encodes every frame', () {
+      SkAutoDisposeScope.run(() {
+        final stream = SkDynamicMemoryWStream();
+        final frames = [
+          for (var i = 0; i < colors.length; i++)
+            SkWebpEncoderFrame(
+              createFramePixmap(colors[i]),
+              Duration(milliseconds: durations[i]),
+            ),
+        ];
+        expect(
+          SkWebPEncoder.encodeAnimated(stream, frames, options: lossless),
+          isTrue,
+        );
+        // SkCodec reports an animation that loops forever as -1.
+        expectAnimation(stream.detachAsData(), repetitionCount: -1);
+      });
+    });
+
+    test('encodeAnimated rejects no frames and mismatched sizes', () {
+      SkAutoDisposeScope.run(() {
+        final stream = SkDynamicMemoryWStream();
+        expect(SkWebPEncoder.encodeAnimated(stream, []), isFalse);
+        expect(
+          SkWebPEncoder.encodeAnimated(stream, [
+            SkWebpEncoderFrame(
+              createFramePixmap(colors[0]),
+              const Duration(milliseconds: 10),
+            ),
+            SkWebpEncoderFrame(
+              createFramePixmap(colors[1], width: 10),
+              const Duration(milliseconds: 10),
+            ),
+          ]),
+          isFalse,
+        );
+      });
+    });
+
+    test('SkWebpAnimEncoder adds frames one at a time', () {
+      SkAutoDisposeScope.run(() {
+        final encoder = SkWebpAnimEncoder.create(
+          width: 20,
+          height: 10,
+          options: lossless,
+          loopCount: 2,
+        )!;
+        for (var i = 0; i < colors.length; i++) {
+          expect(
+            encoder.addFrame(
+              createFramePixmap(colors[i]),
+              Duration(milliseconds: durations[i]),
+            ),
+            isTrue,
+          );
+        }
+        expect(encoder.frameCount, 3);
+        expect(
+          encoder.addFrame(
+            createFramePixmap(colors[0], height: 20),
+            const Duration(milliseconds: 10),
+          ),
+          isFalse,
+        );
+
+        final stream = SkDynamicMemoryWStream();
+        expect(encoder.finish(stream), isTrue);
+        expect(
+          encoder.addFrame(
+            createFramePixmap(colors[0]),
+            const Duration(milliseconds: 10),
+          ),
+          isFalse,
+        );
+        // Played twice, the first time is not a repetition.
+        expectAnimation(stream.detachAsData(), repetitionCount: 1);
+      });
+    });
+
+    test('SkWebpAnimEncoder fails without frames', () {
+      SkAutoDisposeScope.run(() {
+        expect(SkWebpAnimEncoder.create(width: 0, height: 10), isNull);
+        final encoder = SkWebpAnimEncoder.create(width: 20, height: 10)!;
+        expect(encoder.finish(SkDynamicMemoryWStream()), isFalse);
+      });
+    });
+  });
+
+  group('SkRowEncoder', () {
+    SkPicture createTestPicture(int width, int height) {
+      final recorder = SkPictureRecorder();
+      final canvas = recorder.beginRecording(
+        SkRect.fromLTRB(0, 0, width.toDouble(), height.toDouble()),
+        useRTree: true,
+      );
+      canvas.drawRect(
+        SkRect.fromLTRB(0, 0, width.toDouble(), height / 2),
+        SkPaint()..color = SkColor(0xFFFF0000),
+      );
+      canvas.drawRect(
+        SkRect.fromLTRB(0, height / 2, width.toDouble(), height.toDouble()),
+        SkPaint()..color = SkColor(0xFF0000FF),
+      );
+      return recorder.finishRecording();
+    }
+
+    test('writeRows encodes a PNG in several calls', () {
+      SkAutoDisposeScope.run(() {
+        final pixmap = createTestPixmap();
+        final stream = SkDynamicMemoryWStream();
+        final encoder = SkRowEncoder.png(stream, width: 50, height: 50)!;
+        final top = SkPixmap();
+        final bottom = SkPixmap();
+        expect(
+          pixmap.extractSubset(top, SkIRect.fromXYWH(0, 0, 50, 20)),
+          isTrue,
+        );
+        expect(
+          pixmap.extractSubset(bottom, SkIRect.fromXYWH(0, 20, 50, 30)),
+          isTrue,
+        );
+
+        expect(encoder.writeRows(top), isTrue);
+        expect(encoder.finish(), isFalse);
+        expect(encoder.writeRows(bottom), isTrue);
+        expect(encoder.rowsWritten, 50);
+        expect(encoder.writeRows(top), isFalse);
+        expect(encoder.finish(), isTrue);
+
+        final codec = SkCodec.fromData(stream.detachAsData())!;
+        final decoded = SkPixmap();
+        codec.decodeToBitmap()!.peekPixels(decoded);
+        expect(decoded.getPixelColor(5, 5), SkColor(0xFFFF0000));
+        expect(decoded.getPixelColor(25, 25), SkColor(0xFF00FF00));
+      });
+    });
+
+    test('renderInStrips matches a single playback', () {
+      SkAutoDisposeScope.run(() {
+        final picture = createTestPicture(64, 100);
+        final stream = SkDynamicMemoryWStream();
+        final encoder = SkRowEncoder.png(
+          stream,
+          width: 64,
+          height: 100,
+          opaque: true,
+        )!;
+
+        final stats = picture.renderInStrips(encoder, bandHeight: 16)!;
+        expect(stats.bandCount, 7);
+        expect(stats.bandBytes, 2 * 64 * 16 * 4);
+        expect(stats.megapixelsPerSecond, greaterThan(0));
+        expect(encoder.rowsWritten, 100);
+        expect(picture.renderInStrips(encoder), isNull);
+
+        final codec = SkCodec.fromData(stream.detachAsData())!;
+        expect(codec.getInfo().width, 64);
+        expect(codec.getInfo().height, 100);
+        final decoded = SkPixmap();
+        codec.decodeToBitmap()!.peekPixels(decoded);
+        for (final y in [0, 15, 16, 49]) {
+          expect(decoded.getPixelColor(32, y), SkColor(0xFFFF0000));
+        }
+        for (final y in [50, 63, 64, 99]) {
+          expect(decoded.getPixelColor(32, y), SkColor(0xFF0000FF));
+        }
+      });
+    });
+
+    test('renderInStrips encodes a JPEG', () {
+      SkAutoDisposeScope.run(() {
+        final picture = createTestPicture(40, 40);
+        final stream = SkDynamicMemoryWStream();
+        final encoder = SkRowEncoder.jpeg(stream, width: 40, height: 40)!;
+
+        expect(
+          picture.renderInStrips(encoder, bandHeight: 8)?.bandCount,
+          5,
+        );
+        final codec = SkCodec.fromData(stream.detachAsData())!;
+        final decoded = SkPixmap();
+        codec.decodeToBitmap()!.peekPixels(decoded);
+        final color = decoded.getPixelColor(20, 5);
+        expect(color.red, greaterThan(240));
+        expect(color.blue, lessThan(16));
+      });
+    });
+
+    test('rejects empty images', () {
+      SkAutoDisposeScope.run(() {
+        final stream = SkDynamicMemoryWStream();
+        expect(SkRowEncoder.png(stream, width: 0, height: 10), isNull);
+        expect(SkRowEncoder.jpeg(stream, width: 10, height: 0), isNull);
+      });
+    });
+  });
+
+  group('SkEncodeQueue', () {
+    SkColor decodedColor(SkData data, int x, int y) {
+      final codec = SkCodec.fromData(data)!;
+      final decoded = SkPixmap();
+      codec.decodeToBitmap()!.peekPixels(decoded);
+      return decoded.getPixelColor(x, y);
+    }
+
+    test('encodes more images than its capacity', () async {
+      final queue = SkEncodeQueue(capacity: 2);
+      final image = SkImage.rasterCopyWithPixmap(createTestPixmap())!;
+      final results = await Future.wait([
+        for (var i = 0; i < 8; i++)
+          queue.encodeImage(
+            image,
+            format: i.isEven
+                ? SkEncodedImageFormat.png
+                : SkEncodedImageFormat.webp,
+          ),
+      ]);
+
+      for (final result in results) {
+        expect(decodedColor(result.data!, 25, 25), SkColor(0xFF00FF00));
+      }
+      expect(queue.inFlight, 0);
+      final stats = queue.stats;
+      expect(stats.submitted, 8);
+      expect(stats.encoded, 8);
+      expect(stats.failed, 0);
+      expect(
+        stats.encodedBytes,
+        results.fold<int>(0, (sum, result) => sum + result.data!.size),
+      );
+      expect(stats.maxEncodeTime, lessThanOrEqualTo(stats.totalEncodeTime));
+      queue.dispose();
+    });
+
+    test('encodePixmap copies the pixels', () async {
+      final queue = SkEncodeQueue();
+      final surface = createSurface(width: 10, height: 10);
+      surface.canvas.clear(SkColor(0xFFFF0000));
+      final pixmap = SkPixmap();
+      expect(surface.peekPixels(pixmap), isTrue);
+
+      final future = queue.encodePixmap(
+        pixmap,
+        format: SkEncodedImageFormat.jpeg,
+      );
+      surface.canvas.clear(SkColor(0xFF0000FF));
+
+      final color = decodedColor((await future).data!, 5, 5);
+      expect(color.red, greaterThan(240));
+      expect(color.blue, lessThan(16));
+      queue.dispose();
+    });
+
+    test('reports unsupported formats as failed', () async {
+      final queue = SkEncodeQueue();
+      final image = SkImage.rasterCopyWithPixmap(createTestPixmap())!;
+      final result = await queue.encodeImage(
+        image,
+        format: SkEncodedImageFormat.gif,
+      );
+      expect(result.data, isNull);
+      expect(queue.stats.failed, 1);
+
+      queue.resetStats();
+      expect(queue.stats.failed, 0);
+      queue.dispose();
+    });
+  });
 }
@@ -1,7 +1,9 @@
+import 'dart:io';
 import 'dart:typed_data';
 
 import 'package:skia_dart/skia_dart.dart';
 import 'package:test/test.dart';
+import 'package:vector_math/vector_math_64.dart';
 
 const _fontPath = 'test/NotoSans-ASCII.ttf';
 
@@ -103,6 +105,40 @@ void main() {
       }
     });
 
+    test('getTableView views the table without copying', () {
+      int tag(String name) => name.codeUnits.fold(0, (t, c) => t << 8 | c);
+
+      for (final name in ['cmap', 'hmtx', 'GSUB']) {
+        final view = typeface.getTableView(tag(name))!;
+        expect(view, typeface.getTableData(tag(name)), reason: name);
+        expect(typeface.getTableView(tag(name)), view, reason: name);
+        expect(() => view[0] = 0, throwsUnsupportedError);
+      }
+      expect(typeface.getTableView(tag('zzzz')), isNull);
+
+      final hmtx = typeface.getTableView(tag('hmtx'))!;
+      SkTypeface.purgeTableCache();
+      expect(hmtx, typeface.getTableData(tag('hmtx')));
+    });
+
+    test('refTableData borrows every table of a typeface made from data', () {
+      int tag(String name) => name.codeUnits.fold(0, (t, c) => t << 8 | c);
+
+      SkAutoDisposeScope.run(() {
+        final face = fontMgr.createFromData(SkData.fromFile(_fontPath)!)!;
+
+        final glyf = face.refTableData(tag('glyf'))!;
+        expect(glyf.borrowed, isTrue);
+        expect(glyf.data.toUint8List(), face.getTableData(tag('glyf')));
+
+        final head = face.refTableData(tag('head'))!;
+        expect(head.borrowed, isTrue);
+        expect(head.data.toUint8List(), face.getTableData(tag('head')));
+
+        expect(face.refTableData(tag('zzzz')), isNull);
+      });
+    });
+
     test('style and synthetic flags', () {
       expect(typeface.isBold, isFalse);
       expect(typeface.isItalic, isFalse);
@@ -550,4 +586,130 @@ void main() {
       });
     });
   });
+
+  group('SkFont prewarm', () {
+    test('prewarmGlyphs caches images for small glyphs', () {
+      SkAutoDisposeScope.run(() {
+        final font = SkFont(typeface: typeface, size: 24);
+        final glyphs = font.textToGlyphs(SkEncodedText.string('Hello'));
+
+        final result = font.prewarmGlyphs(glyphs);
+        expect(result.imageCount, glyphs.length);
+        expect(result.pathCount, 0);
+        expect(result.glyphCount, glyphs.length);
+      });
+    });
+
+    test('prewarmGlyphs caches every subpixel offset', () {
+      SkAutoDisposeScope.run(() {
+        final font = SkFont(typeface: typeface, size: 24)..isSubpixel = true;
+        final glyphs = font.textToGlyphs(SkEncodedText.string('Hello'));
+
+        // Horizontal text is positioned at quarter pixels along x.
+        final result = font.prewarmGlyphs(glyphs);
+        expect(result.imageCount, glyphs.length * 4);
+        expect(result.pathCount, 0);
+      });
+    });
+
+    test('prewarmGlyphs caches paths for large glyphs', () {
+      SkAutoDisposeScope.run(() {
+        final font = SkFont(typeface: typeface, size: 24);
+        final glyphs = font.textToGlyphs(SkEncodedText.string('Hi'));
+
+        final result = font.prewarmGlyphs(
+          glyphs,
+          matrix: Matrix3.identity()..scale(40.0),
+        );
+        expect(result.imageCount, 0);
+        expect(result.pathCount, glyphs.length);
+      });
+    });
+
+    test('prewarmGlyphsBatch prewarms every request', () {
+      SkAutoDisposeScope.run(() {
+        final sizes = [10.0, 14.0, 18.0, 600.0];
+        final requests = [
+          for (final size in sizes)
+            SkFontPrewarmRequest(
+              SkFont(typeface: typeface, size: size),
+              SkFont(typeface: typeface).textToGlyphs(
+                SkEncodedText.string('abc'),
+              ),
+            ),
+        ];
+
+        final results = SkFont.prewarmGlyphsBatch(requests, maxThreads: 2);
+        expect(results.map((r) => r.imageCount), [3, 3, 3, 0]);
+        expect(results.map((r) => r.pathCount), [0, 0, 0, 3]);
+        expect(SkFont.prewarmGlyphsBatch(const []), isEmpty);
+      });
+    });
+
+    test('prewarmGlyphsAsync completes with the results', () async {
+      final font = SkFont(typeface: typeface, size: 20);
+      final glyphs = font.textToGlyphs(SkEncodedText.string('xyz'));
+      final future = SkFont.prewarmGlyphsAsync([
+        SkFontPrewarmRequest(font, glyphs),
+      ]);
+      // The request was copied.
+      font.dispose();
+
+      final results = await future;
+      expect(results, hasLength(1));
+      expect(results.single.imageCount, glyphs.length);
+    });
+  });
+
+  group('SkIndexedFontMgr', () {
+    late Directory tempDir;
+
+    setUp(() {
+      tempDir = Directory.systemTemp.createTempSync('skia_font_index');
+      Directory('${tempDir.path}/fonts').createSync();
+      File(_fontPath).copySync('${tempDir.path}/fonts/NotoSans.ttf');
+    });
+
+    tearDown(() {
+      tempDir.deleteSync(recursive: true);
+    });
+
+    test(
+      'reuses the stored index until the font files change',
+      () {
+        SkAutoDisposeScope.run(() {
+          final fonts = ['${tempDir.path}/fonts'];
+          final indexPath = '${tempDir.path}/fonts.index';
+
+          final first = SkIndexedFontMgr.create(fonts, indexPath: indexPath)!;
+          expect(first.info.rebuilt, isTrue);
+          expect(first.info.fileCount, 1);
+          expect(first.info.faceCount, 1);
+          expect(first.countFamilies(), 1);
+          expect(first.getFamilyName(0), 'Noto Sans');
+          expect(File(indexPath).existsSync(), isTrue);
+
+          final second = SkIndexedFontMgr.create(fonts, indexPath: indexPath)!;
+          expect(second.info.rebuilt, isFalse);
+          expect(second.getFamilyName(0), 'Noto Sans');
+          final typeface = second.matchFamilyStyle(
+            'noto sans',
+            SkFontStyle.normal(),
+          )!;
+          expect(typeface.familyName, 'Noto Sans');
+          expect(
+            second.matchFamilyStyle('Missing', SkFontStyle.normal()),
+            isNull,
+          );
+
+          final fontFile = File('${tempDir.path}/fonts/NotoSans.ttf');
+          fontFile.setLastModifiedSync(DateTime(2001));
+          final third = SkIndexedFontMgr.create(fonts, indexPath: indexPath)!;
+          expect(third.info.rebuilt, isTrue);
+          expect(third.countFamilies(), 1);
+        });
+      },
+      skip: !Platform.isLinux,
+    );
+  });
 }
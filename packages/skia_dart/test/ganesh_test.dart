@@ -157,6 +157,55 @@ void main() {
           });
         });
 
+        test('isolate bound images are destroyed in batches', () async {
+          final surface = SkSurface.newRenderTarget(
+            context,
+            SkImageInfo(
+              width: 16,
+              height: 16,
+              colorType: SkColorType.rgba8888,
+              alphaType: SkAlphaType.premul,
+            ),
+          )!;
+          final runLoop = RunLoop.instance;
+          Future<void> drain() async {
+            for (var i = 0; i < 100 && runLoop.pendingDestroyCount > 0; i++) {
+              await Future<void>.delayed(Duration.zero);
+            }
+          }
+
+          await drain();
+          expect(runLoop.pendingDestroyCount, 0);
+
+          final images = [
+            for (var i = 0; i < 200; i++) surface.makeImageSnapshot()!,
+          ];
+          // Destruction of the images is queued and run by a single message.
+          for (final image in images) {
+            image.dispose();
+          }
+          expect(runLoop.pendingDestroyCount, images.length);
+          await drain();
+          expect(runLoop.pendingDestroyCount, 0);
+
+          final more = [
+            for (var i = 0; i < 200; i++) surface.makeImageSnapshot()!,
+          ];
+          for (final image in more) {
+            image.dispose();
+          }
+          expect(runLoop.pendingDestroyCount, more.length);
+          // Flushing destroys the queued images synchronously; the pending
+          // message then finds nothing left to do.
+          runLoop.flush();
+          expect(runLoop.pendingDestroyCount, 0);
+          runLoop.flush();
+          context.flushAndSubmit(syncCpu: true);
+          await Future<void>.delayed(Duration.zero);
+          expect(runLoop.pendingDestroyCount, 0);
+          surface.dispose();
+        });
+
         test('SkSurface.newRenderTarget with props', () {
           SkAutoDisposeScope.run(() {
             final props = SkSurfaceProps(
@@ -3,7 +3,6 @@ import 'dart:io';
 import 'package:skia_dart/skia_dart.dart';
 // ignore: depend_on_referenced_packages
 import 'package:test_api/src/backend/invoker.dart' as test_api;
-import 'dart:ffi' as ffi;
 
 class Goldens {
   static bool verify(SkPixmap pixmap, {bool platformSpecific = false}) {
@@ -56,6 +55,8 @@ class Goldens {
         pixmap,
         goldenPixmap,
         5, // tolerance
+        goldenFileName: goldenFileName,
+        failedGoldenOutputDir: failedGoldenOutputDir,
       );
     });
 
@@ -70,31 +71,52 @@ class Goldens {
     return matchesGolden;
   }
 
-  static bool _comparePixmapsFuzzy(SkPixmap a, SkPixmap b, int tolerance) {
-    if (a.info.width != b.info.width || a.info.height != b.info.height) {
-      return false;
-    }
+  static bool _comparePixmapsFuzzy(
+    SkPixmap a,
+    SkPixmap b,
+    int tolerance, {
+    required String goldenFileName,
+    required String failedGoldenOutputDir,
+  }) {
+    assert(a.colorType == SkColorType.rgba8888);
+    assert(b.colorType == SkColorType.rgba8888);
 
-    assert(a.info.colorType == SkColorType.rgba8888);
-    assert(b.info.colorType == SkColorType.rgba8888);
+    final storeDiff = failedGoldenOutputDir.isNotEmpty;
+    final diffMask = SkBitmap();
+    final diffPixmap = SkPixmap();
+    if (storeDiff) {
+      diffMask.tryAllocPixels(
+        SkImageInfo(
+          width: a.width,
+          height: a.height,
+          colorType: SkColorType.gray8,
+          alphaType: SkAlphaType.opaque,
+        ),
+      );
+      diffMask.peekPixels(diffPixmap);
+    }
 
-    for (int y = 0; y < a.info.height; y++) {
-      final pixelsA = a
-          .getAddr(0, y)
-          .cast<ffi.Uint8>()
-          .asTypedList(a.info.width * 4);
-      final pixelsB = b
-          .getAddr(0, y)
-          .cast<ffi.Uint8>()
-          .asTypedList(b.info.width * 4);
-      for (int x = 0; x < a.info.width * 4; x++) {
-        if ((pixelsA[x] - pixelsB[x]).abs() > tolerance) {
-          return false;
-        }
+    final result = a.compare(
+      b,
+      tolerance: tolerance,
+      diffMask: storeDiff ? diffPixmap : null,
+    );
+    if (result == null) {
+      return false;
+    }
+    if (!result.matches) {
+      print('Golden mismatch: $result');
+      if (storeDiff) {
+        final diffFile = File(
+          '$failedGoldenOutputDir/'
+          '${goldenFileName.replaceFirst(RegExp(r'\.png$'), '')}_diff.png',
+        );
+        diffFile.parent.createSync(recursive: true);
+        SkPngEncoder.encode(SkFileWStream(diffFile.path), diffPixmap);
+        print('Stored golden diff: ${diffFile.path}');
       }
     }
-
-    return true;
+    return result.matches;
   }
 
   static void _storeFailedGolden(
@@ -0,0 +1,125 @@
+import 'package:skia_dart/skia_dart.dart';
+import 'package:test/test.dart';
+
+import 'icu.dart';
+
+const _fontPath = 'test/NotoSans-ASCII.ttf';
+
+void main() {
+  late SkFontMgr fontMgr;
+  late SkTypeface typeface;
+  late SkUnicode? unicode;
+
+  loadIcuData();
+
+  setUpAll(() {
+    fontMgr = SkFontMgr.createPlatformDefault()!;
+    typeface = fontMgr.createFromFile(_fontPath)!;
+    unicode = SkUnicode.icu() ?? SkUnicode.icu4x() ?? SkUnicode.libgrapheme();
+  });
+
+  tearDownAll(() {
+    unicode?.dispose();
+    typeface.dispose();
+    fontMgr.dispose();
+  });
+
+  SkFontCollection createFontCollection() {
+    final collection = SkFontCollection();
+    collection.setDefaultFontManagerWithFamilyNames(fontMgr, [
+      typeface.familyName,
+    ]);
+    return collection;
+  }
+
+  SkParagraphBuilder createBuilder(
+    SkFontCollection fontCollection,
+    String text, {
+    double fontSize = 16,
+  }) {
+    final style = SkTextStyle()
+      ..typeface = typeface
+      ..fontSize = fontSize;
+    final builder = SkParagraphBuilder(
+      style: SkParagraphStyle(),
+      fontCollection: fontCollection,
+      unicode: unicode!,
+      recordInputs: true,
+    );
+    builder.pushStyle(style);
+    builder.addText(text);
+    builder.pop();
+    return builder;
+  }
+
+  group('SkParagraphEditor', () {
+    const lines = [
+      'The quick brown fox jumps over the lazy dog',
+      'Pack my box with five dozen liquor jugs',
+      'How vexingly quick daft zebras jump',
+    ];
+
+    test('relays out only the edited block', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final collection = createFontCollection();
+        final editor = SkParagraphEditor(
+          createBuilder(collection, lines.join('\n')),
+        );
+        expect(editor.layout(120), 3);
+        expect(editor.layout(120), 0);
+
+        final start = lines[0].length + 1 + 'Pack my '.length;
+        editor.replace(start, start + 'box'.length, 'crate');
+        expect(editor.text, startsWith('${lines[0]}\nPack my crate with'));
+        expect(editor.layout(120), 1);
+
+        final fresh = SkParagraphEditor(createBuilder(collection, editor.text));
+        fresh.layout(120);
+        expect(editor.height, fresh.height);
+        expect(editor.lineCount, fresh.lineCount);
+        expect(editor.longestLine, fresh.longestLine);
+
+        expect(editor.layout(200), 3);
+      });
+    });
+
+    test('splits and joins blocks at line breaks', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final collection = createFontCollection();
+        final editor = SkParagraphEditor(
+          createBuilder(collection, lines.join('\n')),
+        );
+        editor.layout(1000);
+        expect(editor.lineCount, 3);
+
+        final end = lines[0].length;
+        editor.replace(end, end + 1, ' ');
+        editor.layout(1000);
+        expect(editor.lineCount, 2);
+
+        editor.replace(0, 0, 'first\n\n');
+        editor.layout(1000);
+        expect(editor.lineCount, 4);
+        expect(editor.getGlyphPositionAtCoordinate(0, 0).position, 0);
+
+        final boxes = editor.getRectsForRange(0, 5);
+        expect(boxes, hasLength(1));
+        expect(boxes.first.rect.top, 0);
+      });
+    });
+
+    test('rejects invalid ranges', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final collection = createFontCollection();
+        final editor = SkParagraphEditor(createBuilder(collection, 'h\u00e9'));
+        expect(() => editor.replace(2, 1, ''), throwsArgumentError);
+        expect(() => editor.replace(0, 10, ''), throwsArgumentError);
+        expect(() => editor.replace(2, 2, 'x'), throwsArgumentError);
+        expect(editor.text, 'h\u00e9');
+      });
+    });
+  });
+}
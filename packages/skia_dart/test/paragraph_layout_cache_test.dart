@@ -0,0 +1,144 @@
+import 'package:skia_dart/skia_dart.dart';
+import 'package:test/test.dart';
+
+import 'icu.dart';
+
+const _fontPath = 'test/NotoSans-ASCII.ttf';
+
+void main() {
+  late SkFontMgr fontMgr;
+  late SkTypeface typeface;
+  late SkUnicode? unicode;
+
+  loadIcuData();
+
+  setUpAll(() {
+    fontMgr = SkFontMgr.createPlatformDefault()!;
+    typeface = fontMgr.createFromFile(_fontPath)!;
+    unicode = SkUnicode.icu() ?? SkUnicode.icu4x() ?? SkUnicode.libgrapheme();
+  });
+
+  tearDownAll(() {
+    unicode?.dispose();
+    typeface.dispose();
+    fontMgr.dispose();
+  });
+
+  SkFontCollection createFontCollection() {
+    final collection = SkFontCollection();
+    collection.setDefaultFontManagerWithFamilyNames(fontMgr, [
+      typeface.familyName,
+    ]);
+    return collection;
+  }
+
+  SkParagraphBuilder createBuilder(
+    SkFontCollection fontCollection,
+    String text, {
+    double fontSize = 16,
+    bool recordInputs = true,
+  }) {
+    final style = SkTextStyle()
+      ..typeface = typeface
+      ..fontSize = fontSize;
+    final builder = SkParagraphBuilder(
+      style: SkParagraphStyle(),
+      fontCollection: fontCollection,
+      unicode: unicode!,
+      recordInputs: recordInputs,
+    );
+    builder.pushStyle(style);
+    builder.addText(text);
+    builder.pop();
+    return builder;
+  }
+
+  group('SkParagraphLayoutCache', () {
+    test('reuses layouts of identical builders', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final cache = SkParagraphLayoutCache(byteBudget: 1 << 20);
+        final collection = createFontCollection();
+        const text = 'The quick brown fox jumps over the lazy dog';
+
+        final first = cache.build(createBuilder(collection, text), 120);
+        final second = cache.build(createBuilder(collection, text), 120);
+        expect(cache.stats.misses, 1);
+        expect(cache.stats.hits, 1);
+        expect(cache.stats.entryCount, 1);
+        expect(second.height, first.height);
+        expect(second.lineNumber, first.lineNumber);
+
+        final uncached = createBuilder(collection, text).build()..layout(120);
+        expect(first.height, uncached.height);
+        expect(first.longestLine, uncached.longestLine);
+
+        cache.build(createBuilder(collection, text), 200);
+        cache.build(createBuilder(collection, text, fontSize: 20), 120);
+        cache.build(createBuilder(collection, '$text!'), 120);
+        expect(cache.stats.misses, 4);
+        expect(cache.stats.entryCount, 4);
+        expect(cache.stats.hitRate, closeTo(0.2, 1e-9));
+      });
+    });
+
+    test('requires a builder that records its inputs', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final cache = SkParagraphLayoutCache(byteBudget: 1 << 20);
+        final builder = createBuilder(
+          createFontCollection(),
+          'The quick brown fox',
+          recordInputs: false,
+        );
+        expect(() => cache.build(builder, 120), throwsArgumentError);
+        expect(() => SkParagraphEditor(builder), throwsArgumentError);
+        expect(cache.stats.misses, 0);
+        builder.build().layout(120);
+      });
+    });
+
+    test('relaying out a cached paragraph leaves the entry intact', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final cache = SkParagraphLayoutCache(byteBudget: 1 << 20);
+        final collection = createFontCollection();
+        const text = 'The quick brown fox jumps over the lazy dog';
+
+        final narrow = cache.build(createBuilder(collection, text), 80);
+        final lines = narrow.lineNumber;
+        narrow.layout(1000);
+        expect(narrow.lineNumber, 1);
+
+        final again = cache.build(createBuilder(collection, text), 80);
+        expect(cache.stats.hits, 1);
+        expect(again.lineNumber, lines);
+        expect(again.maxWidth, 80);
+      });
+    });
+
+    test('evicts over budget and on font collection clear', () {
+      if (unicode == null) return;
+      SkAutoDisposeScope.run(() {
+        final cache = SkParagraphLayoutCache(byteBudget: 1 << 20);
+        final collection = createFontCollection();
+        final other = createFontCollection();
+        cache.build(createBuilder(collection, 'first'), 100);
+        cache.build(createBuilder(other, 'second'), 100);
+        expect(cache.stats.entryCount, 2);
+        expect(cache.stats.bytes, greaterThan(0));
+
+        collection.clearCaches();
+        expect(cache.stats.entryCount, 1);
+        expect(cache.stats.evictions, 1);
+
+        cache.byteBudget = 0;
+        expect(cache.stats.entryCount, 0);
+        expect(cache.stats.bytes, 0);
+
+        cache.resetStats();
+        expect(cache.stats.evictions, 0);
+      });
+    });
+  });
+}
@@ -229,6 +229,48 @@ void main() {
       });
     });
 
+    test('adds runs like the equivalent push, add and pop calls', () {
+      if (unicode == null) return;
+
+      SkAutoDisposeScope.run(() {
+        final collection = createFontCollection();
+        final first = createParagraphTextStyle();
+        final second = first.copyWith(color: SkColors.red);
+        const placeholder = SkPlaceholderStyle(
+          width: 20,
+          height: 18,
+          alignment: SkPlaceholderAlignment.middle,
+        );
+
+        final expected = createParagraphBuilder(fontCollection: collection)
+          ..pushStyle(first)
+          ..addText('Hello ')
+          ..pop()
+          ..pushStyle(second)
+          ..addText('w\u00f6rld')
+          ..addPlaceholder(placeholder)
+          ..pop()
+          ..addText('!');
+        final builder = createParagraphBuilder(fontCollection: collection);
+        builder.addRuns([
+          SkParagraphRun.text('Hello ', style: first),
+          SkParagraphRun.text('w\u00f6rld', style: second),
+          SkParagraphRun.placeholder(placeholder, style: second),
+          const SkParagraphRun.text('!'),
+        ]);
+        expect(builder.text, 'Hello w\u00f6rld\u{FFFC}!');
+
+        final paragraph = builder.build()..layout(180);
+        final reference = expected.build()..layout(180);
+        expect(paragraph.height, reference.height);
+        expect(paragraph.longestLine, reference.longestLine);
+        expect(
+          paragraph.getRectsForPlaceholders().single.rect,
+          reference.getRectsForPlaceholders().single.rect,
+        );
+      });
+    });
+
     test('placeholder value type supports copyWith and equality', () {
       const style = SkPlaceholderStyle(
         width: 24,
@@ -1059,6 +1101,138 @@ void main() {
       });
     });
 
+    test('exports all line metrics in one table', () {
+      final activeUnicode = unicode;
+      if (activeUnicode == null) return;
+
+      SkAutoDisposeScope.run(() {
+        final paragraph = createLaidOutParagraph(width: 80);
+        final lines = paragraph.lineMetrics;
+        expect(lines.length, greaterThan(1));
+
+        final table = paragraph.getLineMetricsTable(includeStyleRuns: true);
+        expect(table.length, lines.length);
+        for (var i = 0; i < lines.length; i++) {
+          final line = lines[i];
+          expect(table.startIndex[i], line.startIndex);
+          expect(table.endIndex[i], line.endIndex);
+          expect(table.endIncludingNewline[i], line.endIncludingNewline);
+          expect(table.isHardBreak[i], line.isHardBreak);
+          expect(table.ascent[i], line.ascent);
+          expect(table.width[i], line.width);
+          expect(table.baseline[i], line.baseline);
+          expect(table.lineNumber[i], line.lineNumber);
+
+          final runs = line.styleMetrics;
+          final first = table.styleRunOffsets![i];
+          expect(table.styleRunOffsets![i + 1] - first, runs.length);
+          for (var j = 0; j < runs.length; j++) {
+            expect(table.styleRunTextStarts![first + j], runs[j].textStart);
+            expect(
+              table.styleRunFontMetrics![first + j].ascent,
+              runs[j].fontMetrics.ascent,
+            );
+          }
+        }
+
+        final plain = paragraph.getLineMetricsTable();
+        expect(plain.styleRunOffsets, isNull);
+        expect(plain.width, table.width);
+
+        paragraph.layout(1000);
+        expect(paragraph.getLineMetricsTable().length, 1);
+      });
+    });
+
+    test('lays out a batch like serial layout', () {
+      final activeUnicode = unicode;
+      if (activeUnicode == null) return;
+
+      SkAutoDisposeScope.run(() {
+        final fontCollection = createFontCollection();
+        SkParagraph build(int i) {
+          final builder = createParagraphBuilder(
+            fontCollection: fontCollection,
+          );
+          builder.pushStyle(createParagraphTextStyle());
+          builder.addText('Paragraph $i ' * (1 + i % 7));
+          return builder.build();
+        }
+
+        const count = 24;
+        final widths = [for (var i = 0; i < count; i++) 60.0 + 15 * (i % 5)];
+        final serial = [for (var i = 0; i < count; i++) build(i)];
+        final batch = [for (var i = 0; i < count; i++) build(i)];
+        for (var i = 0; i < count; i++) {
+          serial[i].layout(widths[i]);
+        }
+        SkParagraph.layoutBatch(batch, widths);
+
+        for (var i = 0; i < count; i++) {
+          expect(batch[i].maxWidth, widths[i]);
+          expect(batch[i].height, serial[i].height);
+          expect(batch[i].longestLine, serial[i].longestLine);
+          expect(
+            batch[i].getLineMetricsTable().width,
+            serial[i].getLineMetricsTable().width,
+          );
+        }
+
+        expect(
+          () => SkParagraph.layoutBatch([serial[0], serial[0]], [10, 20]),
+          throwsArgumentError,
+        );
+        expect(
+          () => SkParagraph.layoutBatch([serial[0]], [10, 20]),
+          throwsArgumentError,
+        );
+      });
+    });
+
+    test('hit-test index agrees with the linear lookup', () {
+      if (unicode == null) return;
+
+      SkAutoDisposeScope.run(() {
+        final style = SkTextStyle()
+          ..typeface = typeface
+          ..fontSize = 16;
+        final builder = createParagraphBuilder(style: SkParagraphStyle())
+          ..pushStyle(style)
+          ..addText(
+            [for (var i = 0; i < 40; i++) 'Line $i of the document'].join('\n'),
+          )
+          ..pop();
+        final paragraph = builder.build()..layout(1000);
+        final points = [
+          for (var y = -5.0; y < paragraph.height + 20; y += 7)
+            for (var x = -10.0; x < paragraph.longestLine + 20; x += 3.3)
+              SkPoint(x, y),
+        ];
+        final expected = [
+          for (final point in points)
+            paragraph.getGlyphPositionAtCoordinate(point.x, point.y),
+        ];
+
+        expect(paragraph.hitTestIndexEnabled, isFalse);
+        expect(paragraph.getGlyphPositionsAtCoordinates(points), expected);
+        paragraph.hitTestIndexEnabled = true;
+        expect(paragraph.getGlyphPositionsAtCoordinates(points), expected);
+        expect(
+          paragraph.getGlyphPositionAtCoordinate(points[5].x, points[5].y),
+          expected[5],
+        );
+        final cluster = paragraph.getClosestGlyphClusterAt(20, 30)!;
+        expect(cluster.bounds.left, lessThanOrEqualTo(20));
+        expect(cluster.bounds.right, greaterThan(20));
+
+        // The index is rebuilt for the new layout.
+        paragraph.layout(60);
+        final wrapped = paragraph.getGlyphPositionAtCoordinate(1, 200);
+        paragraph.hitTestIndexEnabled = false;
+        expect(paragraph.getGlyphPositionAtCoordinate(1, 200), wrapped);
+      });
+    });
+
     test('renders paragraph golden', () {
       final activeUnicode = unicode;
       if (activeUnicode == null) return;
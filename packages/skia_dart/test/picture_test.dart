@@ -137,6 +137,204 @@ void main() {
     });
   });
 
+  group('SkPicture.playbackTiled', () {
+    SkPicture recordScene({required bool useRTree}) {
+      final recorder = SkPictureRecorder();
+      final canvas = recorder.beginRecording(
+        SkRect.fromLTRB(0, 0, 200, 150),
+        useRTree: useRTree,
+      );
+      final paint = SkPaint()..isAntialias = true;
+      for (var i = 0; i < 60; i++) {
+        paint.color = SkColor(0xFF000000 | (i * 0x0B1F37 & 0xFFFFFF));
+        canvas.drawCircle(
+          (i * 37 % 200).toDouble(),
+          (i * 53 % 150).toDouble(),
+          5.0 + i % 17,
+          paint,
+        );
+      }
+      canvas.saveLayer(paint: SkPaint()..alpha = 160);
+      canvas.rotate(12);
+      canvas.drawRect(
+        SkRect.fromLTRB(30, 10, 170, 60),
+        SkPaint()..color = SkColor(0xFF2266AA),
+      );
+      canvas.restore();
+      return recorder.finishRecording();
+    }
+
+    void expectSamePixels(SkPixmap actual, SkPixmap expected) {
+      for (var y = 0; y < expected.height; y++) {
+        for (var x = 0; x < expected.width; x++) {
+          expect(
+            actual.getPixelColor(x, y),
+            expected.getPixelColor(x, y),
+            reason: 'pixel ($x, $y)',
+          );
+        }
+      }
+    }
+
+    for (final useRTree in [false, true]) {
+      test('matches playback (useRTree: $useRTree)', () {
+        SkAutoDisposeScope.run(() {
+          final picture = recordScene(useRTree: useRTree);
+          final matrix = Matrix3.identity()
+            ..setEntry(0, 2, 3.5)
+            ..setEntry(1, 2, -2.25);
+
+          final reference = _makeSurface(width: 200, height: 150);
+          reference.canvas.clear(SkColor(0xFFFFFFFF));
+          reference.canvas.translate(3.5, -2.25);
+          picture.playback(reference.canvas);
+          final expected = SkPixmap();
+          expect(reference.peekPixels(expected), isTrue);
+
+          final tiled = _makeSurface(width: 200, height: 150);
+          tiled.canvas.clear(SkColor(0xFFFFFFFF));
+          final actual = SkPixmap();
+          expect(tiled.peekPixels(actual), isTrue);
+          // Tile sizes that do not divide the surface evenly.
+          expect(
+            picture.playbackTiled(
+              actual,
+              matrix: matrix,
+              tileWidth: 37,
+              tileHeight: 23,
+              maxThreads: 4,
+            ),
+            isTrue,
+          );
+          expectSamePixels(actual, expected);
+        });
+      });
+    }
+
+    test('single thread and invalid tiles', () {
+      SkAutoDisposeScope.run(() {
+        final picture = recordScene(useRTree: true);
+        final surface = _makeSurface(width: 200, height: 150);
+        final pixmap = SkPixmap();
+        expect(surface.peekPixels(pixmap), isTrue);
+        expect(picture.playbackTiled(pixmap, maxThreads: 1), isTrue);
+        expect(
+          () => picture.playbackTiled(pixmap, tileWidth: 0),
+          throwsRangeError,
+        );
+        expect(picture.playbackTiled(SkPixmap()), isFalse);
+      });
+    });
+  });
+
+  group('SkPicture.computeDamage', () {
+    const deviceBounds = SkIRect.fromLTRB(0, 0, 200, 100);
+
+    SkPicture recordFrame(SkPaint paint, double cursorX) {
+      final recorder = SkPictureRecorder();
+      final canvas = recorder.beginRecording(SkRect.fromLTRB(0, 0, 200, 100));
+      canvas.drawRect(SkRect.fromLTRB(10, 10, 60, 60), paint);
+      canvas.drawRect(SkRect.fromLTRB(140, 10, 190, 60), paint);
+      canvas.drawRect(SkRect.fromLTWH(cursorX, 80, 4, 10), paint);
+      return recorder.finishRecording();
+    }
+
+    test('reports only the changed ops', () {
+      SkAutoDisposeScope.run(() {
+        final paint = SkPaint()..color = SkColor(0xFF336699);
+        final previous = recordFrame(paint, 20);
+        final current = recordFrame(paint, 100);
+
+        final damage = current.computeDamage(
+          previous,
+          deviceBounds: deviceBounds,
+        );
+        expect(
+          damage.containsRect(const SkIRect.fromLTRB(20, 80, 24, 90)),
+          isTrue,
+        );
+        expect(
+          damage.containsRect(const SkIRect.fromLTRB(100, 80, 104, 90)),
+          isTrue,
+        );
+        expect(damage.containsPoint(30, 30), isFalse);
+        expect(damage.containsPoint(160, 30), isFalse);
+        expect(damage.containsPoint(60, 85), isFalse);
+
+        final unchanged = recordFrame(paint, 100).computeDamage(
+          current,
+          deviceBounds: deviceBounds,
+        );
+        expect(unchanged.isEmpty, isTrue);
+
+        final full = current.computeDamage(null, deviceBounds: deviceBounds);
+        expect(full.bounds, deviceBounds);
+      });
+    });
+
+    test('paint changes damage the affected ops', () {
+      SkAutoDisposeScope.run(() {
+        final previous = recordFrame(
+          SkPaint()..color = SkColor(0xFF336699),
+          20,
+        );
+        final current = recordFrame(
+          SkPaint()..color = SkColor(0xFF993366),
+          20,
+        );
+
+        final damage = current.computeDamage(
+          previous,
+          deviceBounds: deviceBounds,
+        );
+        expect(
+          damage.containsRect(const SkIRect.fromLTRB(10, 10, 60, 60)),
+          isTrue,
+        );
+        expect(
+          damage.containsRect(const SkIRect.fromLTRB(140, 10, 190, 60)),
+          isTrue,
+        );
+        expect(damage.containsPoint(100, 30), isFalse);
+      });
+    });
+
+    test('clipped playback over the previous frame matches a full repaint', () {
+      SkAutoDisposeScope.run(() {
+        final paint = SkPaint()..color = SkColor(0xFF336699);
+        final previous = recordFrame(paint, 20);
+        final current = recordFrame(paint, 100);
+
+        final full = _makeSurface(width: 200, height: 100);
+        full.canvas.clear(SkColor(0xFFFFFFFF));
+        current.playback(full.canvas);
+
+        final incremental = _makeSurface(width: 200, height: 100);
+        incremental.canvas.clear(SkColor(0xFFFFFFFF));
+        previous.playback(incremental.canvas);
+        final damage = current.computeDamage(
+          previous,
+          deviceBounds: deviceBounds,
+        );
+        incremental.canvas.save();
+        incremental.canvas.clipRegion(damage);
+        incremental.canvas.clear(SkColor(0xFFFFFFFF));
+        current.playback(incremental.canvas);
+        incremental.canvas.restore();
+
+        final expected = SkPixmap();
+        final actual = SkPixmap();
+        expect(full.peekPixels(expected), isTrue);
+        expect(incremental.peekPixels(actual), isTrue);
+        for (var y = 0; y < 100; y++) {
+          for (var x = 0; x < 200; x++) {
+            expect(actual.getPixelColor(x, y), expected.getPixelColor(x, y));
+          }
+        }
+      });
+    });
+  });
+
   group('SkPictureTransfer', () {
     test('create and toPicture', () {
       SkAutoDisposeScope.run(() {
@@ -251,5 +251,109 @@ void main() {
         }
       });
     });
+
+    group('compare', () {
+      // 21 pixels wide, so every row ends with pixels compared one at a time.
+      SkPixmap createPixmap({
+        int width = 21,
+        SkColorType colorType = SkColorType.rgba8888,
+      }) {
+        final bitmap = SkBitmap();
+        expect(
+          bitmap.tryAllocPixels(
+            SkImageInfo(
+              width: width,
+              height: 5,
+              colorType: colorType,
+              alphaType: colorType == SkColorType.rgba8888
+                  ? SkAlphaType.unpremul
+                  : SkAlphaType.premul,
+            ),
+          ),
+          isTrue,
+        );
+        final pixmap = SkPixmap();
+        expect(bitmap.peekPixels(pixmap), isTrue);
+        return pixmap;
+      }
+
+      test('reports deltas, differing pixels and bounds', () {
+        SkAutoDisposeScope.run(() {
+          final a = createPixmap()..eraseColor(SkColor(0xFF808080));
+          final b = createPixmap()..eraseColor(SkColor(0xFF808080));
+
+          final same = a.compare(b)!;
+          expect(same.matches, isTrue);
+          expect(same.maxDelta, 0);
+          expect(same.bounds.isEmpty, isTrue);
+
+          b.eraseColor(
+            SkColor(0xFF838080),
+            subset: const SkIRect.fromLTRB(17, 2, 19, 4),
+          );
+          final withinTolerance = a.compare(b, tolerance: 3)!;
+          expect(withinTolerance.matches, isTrue);
+          expect(withinTolerance.maxDelta, 3);
+
+          final different = a.compare(b, tolerance: 2)!;
+          expect(different.differentPixels, 4);
+          expect(different.bounds, const SkIRect.fromLTRB(17, 2, 19, 4));
+
+          b.eraseColor(
+            SkColor(0x7F808080),
+            subset: const SkIRect.fromLTRB(3, 1, 4, 2),
+          );
+          final withAlpha = a.compare(b, tolerance: 2)!;
+          expect(withAlpha.maxDelta, 128);
+          expect(withAlpha.differentPixels, 5);
+          expect(withAlpha.bounds, const SkIRect.fromLTRB(3, 1, 19, 4));
+
+          final ignoringAlpha = a.compare(b, tolerance: 2, ignoreAlpha: true)!;
+          expect(ignoringAlpha.maxDelta, 3);
+          expect(ignoringAlpha.differentPixels, 4);
+        });
+      });
+
+      test('writes a diff mask', () {
+        SkAutoDisposeScope.run(() {
+          final a = createPixmap()..eraseColor(SkColor(0xFF808080));
+          final b = createPixmap()..eraseColor(SkColor(0xFF808080));
+          b.eraseColor(
+            SkColor(0xFF858080),
+            subset: const SkIRect.fromLTRB(2, 0, 20, 1),
+          );
+          final mask = createPixmap(colorType: SkColorType.alpha8);
+
+          expect(a.compare(b, tolerance: 2, diffMask: mask)!.matches, isFalse);
+          expect(mask.getPixelAlpha(1, 0), 0);
+          expect(mask.getPixelAlpha(2, 0), 1);
+          expect(mask.getPixelAlpha(19, 0), 1);
+          expect(mask.getPixelAlpha(20, 0), 0);
+
+          expect(
+            a.compare(
+              b,
+              diffMask: mask,
+              diffMode: SkPixmapDiffMode.delta,
+            ),
+            isNotNull,
+          );
+          expect(mask.getPixelAlpha(19, 0), closeTo(5 / 255, 1e-6));
+          expect(mask.getPixelAlpha(19, 1), 0);
+        });
+      });
+
+      test('rejects pixmaps that cannot be compared', () {
+        SkAutoDisposeScope.run(() {
+          final a = createPixmap();
+          expect(a.compare(createPixmap(width: 20)), isNull);
+          expect(
+            a.compare(createPixmap(colorType: SkColorType.alpha8)),
+            isNull,
+          );
+          expect(a.compare(a, diffMask: createPixmap()), isNull);
+        });
+      });
+    });
   });
 }
@@ -373,6 +373,158 @@ void main() {
     });
   });
 
+  group('SkShaperBuffer', () {
+    test('shapeToBuffer shapes a batch into flat arrays', () {
+      SkAutoDisposeScope.run(() {
+        final unicode = SkUnicode.icu();
+        if (unicode == null) return;
+        final shaper = SkShaper.harfbuzzShapeThenWrap(unicode);
+        if (shaper == null) return;
+        final font = SkFont(typeface: typeface, size: 20);
+        final buffer = SkShaperBuffer();
+
+        shaper.shapeToBuffer([
+          SkShaperText('Hello', font: font),
+          SkShaperText('wrap these words', font: font, width: 60),
+        ], buffer);
+
+        final hello = font.textToGlyphs(SkEncodedText.string('Hello'));
+        final words = font.textToGlyphs(SkEncodedText.string('wrapthesewords'));
+        expect(buffer.glyphs.length, greaterThanOrEqualTo(hello.length));
+        expect(buffer.glyphs.sublist(0, hello.length), hello);
+        expect(buffer.clusters.sublist(0, hello.length), [0, 1, 2, 3, 4]);
+        expect(buffer.positions.length, buffer.glyphs.length * 2);
+        expect(buffer.fontCount, 1);
+        expect(buffer.font(0).size, 20);
+
+        expect(buffer.lineCount, greaterThanOrEqualTo(4));
+        final first = buffer.line(0);
+        expect(first.text, 0);
+        expect(first.top, 0);
+        expect(first.baseline, greaterThan(0));
+        expect(first.width, greaterThan(0));
+        expect(buffer.positions[0], 0);
+        expect(buffer.positions[1], first.baseline);
+
+        final second = buffer.line(1);
+        expect(second.text, 1);
+        expect(second.top, 0);
+        var glyphCount = 0;
+        for (var i = 1; i < buffer.lineCount; i++) {
+          final line = buffer.line(i);
+          expect(line.text, 1);
+          if (i > 1) expect(line.top, buffer.line(i - 1).bottom);
+          for (var r = 0; r < line.runCount; r++) {
+            final run = buffer.run(line.runOffset + r);
+            expect(run.fontIndex, 0);
+            glyphCount += run.glyphCount;
+          }
+        }
+        // Spaces at the ends of lines may be left out.
+        expect(glyphCount, greaterThanOrEqualTo(words.length));
+
+        shaper.shapeToBuffer([SkShaperText('Hi', font: font)], buffer);
+        expect(buffer.lineCount, 1);
+        expect(buffer.glyphs.length, 2);
+      });
+    });
+  });
+
+  group('SkShapingCache', () {
+    SkTextBlob? shapeWith(SkShaper shaper, SkUnicode unicode, String text) {
+      final bidiIterator = SkBiDiRunIterator.unicode(unicode, text);
+      final scriptIterator = SkScriptRunIterator.harfBuzz(text);
+      if (bidiIterator == null || scriptIterator == null) return null;
+      final handler = SkTextBlobBuilderRunHandler(text, SkPoint(0, 0));
+      shaper.shape(
+        text,
+        fontIterator: SkFontRunIterator.trivial(
+          SkFont(typeface: typeface, size: 24),
+          utf8Bytes: text.length,
+        ),
+        bidiIterator: bidiIterator,
+        scriptIterator: scriptIterator,
+        languageIterator: SkLanguageRunIterator(text),
+        width: 200,
+        handler: handler,
+      );
+      return handler.makeBlob();
+    }
+
+    test('reuses shaped words and matches the uncached shaper', () {
+      SkAutoDisposeScope.run(() {
+        final unicode = SkUnicode.icu();
+        if (unicode == null) return;
+        final cache = SkShapingCache(byteBudget: 1 << 20);
+        final cached = SkShaper.harfbuzzCachedShapeThenWrap(unicode, cache);
+        final uncached = SkShaper.harfbuzzShapeThenWrap(unicode);
+        if (cached == null || uncached == null) return;
+        const text = 'the quick brown fox jumps over the lazy dog';
+
+        final first = shapeWith(cached, unicode, text);
+        if (first == null) return;
+        final afterFirst = cache.stats;
+        expect(afterFirst.misses, greaterThan(0));
+        expect(afterFirst.entryCount, greaterThan(0));
+        expect(afterFirst.hits, greaterThan(0)); // 'the' appears twice.
+
+        final second = shapeWith(cached, unicode, text)!;
+        final afterSecond = cache.stats;
+        expect(afterSecond.misses, afterFirst.misses);
+        expect(afterSecond.hits, greaterThan(afterFirst.hits));
+
+        final expected = shapeWith(uncached, unicode, text)!.bounds;
+        for (final bounds in [first.bounds, second.bounds]) {
+          expect(bounds.left, closeTo(expected.left, 1));
+          expect(bounds.top, closeTo(expected.top, 1));
+          expect(bounds.right, closeTo(expected.right, 1));
+          expect(bounds.bottom, closeTo(expected.bottom, 1));
+        }
+      });
+    });
+
+    test('purge and budget', () {
+      SkAutoDisposeScope.run(() {
+        final unicode = SkUnicode.icu();
+        if (unicode == null) return;
+        final cache = SkShapingCache(byteBudget: 1 << 20);
+        final shaper = SkShaper.harfbuzzCachedShapeThenWrap(unicode, cache);
+        if (shaper == null) return;
+        if (shapeWith(shaper, unicode, 'one two three') == null) return;
+        expect(cache.stats.bytes, greaterThan(0));
+
+        SkShaper.harfBuzzPurgeCaches();
+        expect(cache.stats.entryCount, 0);
+        expect(cache.stats.bytes, 0);
+
+        shapeWith(shaper, unicode, 'one two three');
+        cache.byteBudget = 0;
+        expect(cache.byteBudget, 0);
+        expect(cache.stats.entryCount, 0);
+        expect(cache.stats.evictions, greaterThan(0));
+
+        cache.resetStats();
+        expect(cache.stats.hits, 0);
+        expect(cache.stats.misses, 0);
+        expect(cache.stats.evictions, 0);
+      });
+    });
+
+    test('shapers keep a disposed cache alive', () {
+      SkAutoDisposeScope.run(() {
+        final unicode = SkUnicode.icu();
+        if (unicode == null) return;
+        final cache = SkShapingCache(byteBudget: 1 << 20);
+        final shaper = SkShaper.harfbuzzCachedShapeThenWrap(unicode, cache);
+        if (shaper == null) return;
+        cache.dispose();
+
+        expect(shapeWith(shaper, unicode, 'one two one'), isNotNull);
+        expect(shapeWith(shaper, unicode, 'one two one'), isNotNull);
+      });
+    });
+  });
+
   group('SkTextBlobBuilderRunHandler', () {
     test('endPoint starts at offset', () {
       SkAutoDisposeScope.run(() {
@@ -1,7 +1,11 @@
 import 'package:skia_dart/skia_dart.dart';
 import 'package:test/test.dart';
 
+import 'icu.dart';
+
 void main() {
+  loadIcuData();
+
   group('SkUnicode', () {
     test('icu can be used with SkBiDiRunIterator', () {
       final unicode = SkUnicode.icu();
@@ -31,4 +35,85 @@ void main() {
       unicode.dispose();
     });
   });
+  group('SkUnicodeAnalysis', () {
+    test('analyze marks breaks, classes and bidi regions', () {
+      SkAutoDisposeScope.run(() {
+        final unicode = SkUnicode.icu();
+        if (unicode == null) return;
+        final analysis = SkUnicodeAnalysis();
+
+        final analyzed = unicode.analyze([
+          const SkUnicodeText('ab cd\nef'),
+          const SkUnicodeText('\u05D0\u05D1 x', leftToRight: false),
+          const SkUnicodeText(''),
+        ], analysis);
+
+        expect(analyzed, isTrue);
+        expect(analysis.textCount, 3);
+        final flags = analysis.flagsOf(0);
+        expect(flags.length, 9);
+        bool has(int offset, int flag) => flags[offset] & flag != 0;
+        for (var i = 0; i <= 8; i++) {
+          expect(has(i, SkUnicodeAnalysisFlags.graphemeStart), isTrue);
+        }
+        expect(has(2, SkUnicodeAnalysisFlags.whitespace), isTrue);
+        expect(has(5, SkUnicodeAnalysisFlags.whitespace), isTrue);
+        expect(has(5, SkUnicodeAnalysisFlags.control), isTrue);
+        expect(has(1, SkUnicodeAnalysisFlags.whitespace), isFalse);
+        expect(has(3, SkUnicodeAnalysisFlags.softLineBreakBefore), isTrue);
+        expect(has(1, SkUnicodeAnalysisFlags.softLineBreakBefore), isFalse);
+        expect(has(6, SkUnicodeAnalysisFlags.hardLineBreakBefore), isTrue);
+        expect(has(0, SkUnicodeAnalysisFlags.wordBreak), isTrue);
+        expect(has(2, SkUnicodeAnalysisFlags.wordBreak), isTrue);
+        expect(has(1, SkUnicodeAnalysisFlags.wordBreak), isFalse);
+        expect(analysis.bidiRegionsOf(0), [const SkUnicodeBidiRegion(0, 8, 0)]);
+
+        // Hebrew letters take two UTF-8 code units each.
+        final hebrew = analysis.flagsOf(1);
+        expect(hebrew.length, 7);
+        expect(hebrew[0] & SkUnicodeAnalysisFlags.graphemeStart, isNonZero);
+        expect(hebrew[1] & SkUnicodeAnalysisFlags.graphemeStart, 0);
+        final regions = analysis.bidiRegionsOf(1);
+        expect(regions.first, const SkUnicodeBidiRegion(0, 5, 1));
+        expect(regions.last.end, 6);
+        expect(regions.last.level, 2);
+
+        expect(analysis.flagsOf(2), [0]);
+        expect(analysis.bidiRegionsOf(2), isEmpty);
+      });
+    });
+
+    test('analyze reuses cached results', () {
+      SkAutoDisposeScope.run(() {
+        final unicode = SkUnicode.icu();
+        if (unicode == null) return;
+        final analysis = SkUnicodeAnalysis();
+        final cache = SkUnicodeAnalysisCache(byteBudget: 1 << 20);
+        const texts = [SkUnicodeText('one two'), SkUnicodeText('three')];
+
+        unicode.analyze(texts, analysis, cache: cache);
+        final uncached = analysis.flagsOf(0).toList();
+        expect(analysis.isCached(0), isFalse);
+        expect(cache.stats.misses, 2);
+        expect(cache.stats.entryCount, 2);
+
+        unicode.analyze(texts, analysis, cache: cache, maxThreads: 1);
+        expect(analysis.isCached(0), isTrue);
+        expect(analysis.isCached(1), isTrue);
+        expect(analysis.flagsOf(0), uncached);
+        expect(cache.stats.hits, 2);
+
+        // A different locale is a different entry.
+        unicode.analyze([
+          const SkUnicodeText('one two', locale: 'fr'),
+        ], analysis, cache: cache);
+        expect(analysis.isCached(0), isFalse);
+        expect(cache.stats.entryCount, 3);
+
+        cache.byteBudget = 0;
+        expect(cache.stats.entryCount, 0);
+        expect(cache.stats.bytes, 0);
+      });
+    });
+  });
 }
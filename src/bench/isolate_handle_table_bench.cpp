@@ -0,0 +1,138 @@
+// Multithreaded stress benchmark for the RunLoop object-to-isolate table.
+//
+// Compares IsolateHandleTable against the previous layout (two maps behind a
+// single mutex) with a workload that mirrors image and surface lifetimes:
+// every object gets a handle, a few refs and lookups, and is then released.
+//
+// Usage: isolate_handle_table_bench [max_threads] [ops_per_thread]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "wrapper/isolate_handle_table.h"
+
+namespace {
+
+// The table as it was before sharding, kept for comparison.
+class LegacyTable {
+ public:
+  void set(const void* object, int64_t handle) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    object_to_handle_[object] = handle;
+    auto insert = object_ref_count_.insert({object, 1});
+    if (!insert.second) {
+      insert.first->second++;
+    }
+  }
+
+  void ref(const void* object) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = object_ref_count_.find(object);
+    if (it != object_ref_count_.end()) {
+      it->second++;
+    }
+  }
+
+  std::optional<int64_t> get(const void* object) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = object_to_handle_.find(object);
+    if (it != object_to_handle_.end()) {
+      return it->second;
+    }
+    return std::nullopt;
+  }
+
+  std::optional<int64_t> unref(const void* object) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = object_to_handle_.find(object);
+    if (it == object_to_handle_.end()) {
+      return std::nullopt;
+    }
+    const int64_t handle = it->second;
+    auto ref_it = object_ref_count_.find(object);
+    if (--ref_it->second == 0) {
+      object_ref_count_.erase(ref_it);
+      object_to_handle_.erase(it);
+    }
+    return handle;
+  }
+
+ private:
+  std::unordered_map<const void*, int64_t> object_to_handle_;
+  std::unordered_map<const void*, int64_t> object_ref_count_;
+  std::mutex mutex_;
+};
+
+// Objects live in a sliding window so the table holds a steady population of
+// live entries while others are being inserted and erased.
+constexpr size_t kLiveObjects = 1024;
+// set + 2 x ref + 2 x get + 3 x unref
+constexpr size_t kOpsPerObject = 8;
+
+template <typename Table>
+void run_thread(Table& table, int64_t isolate_handle, size_t ops) {
+  // Stand-ins for native objects; only their addresses are used.
+  std::vector<int64_t> objects(kLiveObjects);
+  const size_t iterations = ops / kOpsPerObject;
+  uint64_t checksum = 0;
+  for (size_t i = 0; i < iterations; ++i) {
+    const void* object = &objects[i % kLiveObjects];
+    if (i >= kLiveObjects) {
+      // Release the object that has been alive for kLiveObjects iterations.
+      for (int r = 0; r < 3; ++r) {
+        checksum += table.unref(object).value_or(0);
+      }
+    }
+    table.set(object, isolate_handle);
+    table.ref(object);
+    table.ref(object);
+    checksum += table.get(object).value_or(0);
+    checksum += table.get(object).value_or(0);
+  }
+  for (size_t i = 0; i < std::min(iterations, kLiveObjects); ++i) {
+    for (int r = 0; r < 3; ++r) {
+      table.unref(&objects[i]);
+    }
+  }
+  if (checksum == 0) {
+    std::fprintf(stderr, "unexpected checksum\n");
+  }
+}
+
+template <typename Table>
+double measure(int threads, size_t ops_per_thread) {
+  Table table;
+  std::vector<std::thread> workers;
+  const auto start = std::chrono::steady_clock::now();
+  for (int t = 0; t < threads; ++t) {
+    workers.emplace_back([&table, t, ops_per_thread] { run_thread(table, t + 1, ops_per_thread); });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+  return static_cast<double>(threads) * ops_per_thread / elapsed.count();
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int hardware_threads = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  const int max_threads = argc > 1 ? std::atoi(argv[1]) : hardware_threads;
+  const size_t ops_per_thread = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 4000000;
+
+  std::printf("%8s %16s %16s %8s\n", "threads", "legacy ops/s", "sharded ops/s", "speedup");
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    const double legacy = measure<LegacyTable>(threads, ops_per_thread);
+    const double sharded = measure<IsolateHandleTable>(threads, ops_per_thread);
+    std::printf("%8d %16.0f %16.0f %7.2fx\n", threads, legacy, sharded, sharded / legacy);
+  }
+  return 0;
+}
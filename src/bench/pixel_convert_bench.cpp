@@ -0,0 +1,120 @@
+// Benchmark for the bulk color conversions behind sk_color_premultiply_array,
+// sk_color_unpremultiply_array and sk_bitmap_get_pixel_colors.
+//
+// Converts a 4K frame with the per-pixel loops the C API used before, with
+// the SkOpts kernels on one thread, and with the kernels split across the
+// worker pool, and reports the best time of each.
+//
+// Usage: pixel_convert_bench [iterations] [width] [height]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <random>
+#include <vector>
+
+#include "include/core/SkBitmap.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkUnPreMultiply.h"
+#include "wrapper/pixel_convert.h"
+
+namespace {
+
+double best_ms(int iterations, const std::function<void()>& fn) {
+  double best = 0;
+  for (int i = 0; i < iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    fn();
+    const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+    best = i == 0 ? elapsed.count() : std::min(best, elapsed.count());
+  }
+  return best;
+}
+
+// Number of pixels with a channel differing by more than one.
+size_t count_mismatches(const std::vector<uint32_t>& a, const std::vector<uint32_t>& b) {
+  size_t mismatches = 0;
+  for (size_t i = 0; i < a.size(); ++i) {
+    for (int shift = 0; shift < 32; shift += 8) {
+      const int delta = static_cast<int>((a[i] >> shift) & 0xff) - static_cast<int>((b[i] >> shift) & 0xff);
+      if (delta > 1 || delta < -1) {
+        ++mismatches;
+        break;
+      }
+    }
+  }
+  return mismatches;
+}
+
+void report(const char* name, double scalar, double simd, double threaded, size_t mismatches) {
+  std::printf("%-14s %10.2f %10.2f %10.2f %8.2fx %8.2fx %10zu\n", name, scalar, simd, threaded, scalar / simd, scalar / threaded, mismatches);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const int iterations = argc > 1 ? std::atoi(argv[1]) : 20;
+  const int width = argc > 2 ? std::atoi(argv[2]) : 3840;
+  const int height = argc > 3 ? std::atoi(argv[3]) : 2160;
+  const int pixels = width * height;
+
+  std::mt19937 random(1);
+  std::vector<SkColor> colors(pixels);
+  for (SkColor& color : colors) {
+    color = random();
+  }
+  std::vector<SkPMColor> pmcolors(pixels);
+  for (int i = 0; i < pixels; ++i) {
+    pmcolors[i] = SkPreMultiplyColor(colors[i]);
+  }
+
+  SkBitmap bitmap;
+  bitmap.allocN32Pixels(width, height);
+  std::copy(pmcolors.begin(), pmcolors.end(), static_cast<SkPMColor*>(bitmap.getPixels()));
+
+  std::vector<uint32_t> expected(pixels);
+  std::vector<uint32_t> actual(pixels);
+
+  std::printf("%d x %d, best of %d, times in ms\n", width, height, iterations);
+  std::printf("%-14s %10s %10s %10s %9s %9s %10s\n", "", "scalar", "simd", "threaded", "simd x", "thread x", "mismatches");
+
+  {
+    const double scalar = best_ms(iterations, [&] {
+      for (int i = 0; i < pixels; ++i) {
+        expected[i] = SkPreMultiplyColor(colors[i]);
+      }
+    });
+    const double simd = best_ms(iterations, [&] { PremultiplyColors(colors.data(), pixels, actual.data(), 1); });
+    const double threaded = best_ms(iterations, [&] { PremultiplyColors(colors.data(), pixels, actual.data()); });
+    report("premultiply", scalar, simd, threaded, count_mismatches(expected, actual));
+  }
+
+  {
+    const double scalar = best_ms(iterations, [&] {
+      for (int i = 0; i < pixels; ++i) {
+        expected[i] = SkUnPreMultiply::PMColorToColor(pmcolors[i]);
+      }
+    });
+    const double simd = best_ms(iterations, [&] { UnpremultiplyColors(pmcolors.data(), pixels, actual.data(), 1); });
+    const double threaded = best_ms(iterations, [&] { UnpremultiplyColors(pmcolors.data(), pixels, actual.data()); });
+    report("unpremultiply", scalar, simd, threaded, count_mismatches(expected, actual));
+  }
+
+  {
+    const double scalar = best_ms(iterations, [&] {
+      uint32_t* out = expected.data();
+      for (int y = 0; y < height; ++y) {
+        for (int x = 0; x < width; ++x) {
+          *out++ = bitmap.getColor(x, y);
+        }
+      }
+    });
+    const double simd = best_ms(iterations, [&] { ReadPixelColors(bitmap.pixmap(), actual.data(), 1); });
+    const double threaded = best_ms(iterations, [&] { ReadPixelColors(bitmap.pixmap(), actual.data()); });
+    report("pixel colors", scalar, simd, threaded, count_mismatches(expected, actual));
+  }
+  return 0;
+}
@@ -0,0 +1,150 @@
+// Feeds malformed streams to sk_canvas_execute_commands: missing or wrong
+// versions, truncated commands, unknown opcodes, enum operands past the end
+// of their enum and bad object indices. Each must be rejected with false,
+// after the commands before it have run and without the bad one drawing.
+//
+// Exits with a non-zero status if any stream is handled differently.
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkColor.h"
+#include "include/core/SkFont.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSurface.h"
+#include "include/core/SkVertices.h"
+#include "wrapper/include/sk_canvas.h"
+#include "wrapper/sk_types_priv.h"
+
+namespace {
+
+constexpr uint32_t kOutOfRange = 0xFF;
+
+// Builds a command stream the way SkCanvasCommandBuffer encodes it.
+class Stream {
+ public:
+  explicit Stream(uint32_t version = SK_CANVAS_COMMANDS_VERSION) { u32(version); }
+
+  Stream& u32(uint32_t value) {
+    const size_t offset = bytes_.size();
+    bytes_.resize(offset + sizeof(value));
+    memcpy(bytes_.data() + offset, &value, sizeof(value));
+    return *this;
+  }
+
+  Stream& f32(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return u32(bits);
+  }
+
+  Stream& op(sk_canvas_command_t opcode) { return u32(opcode); }
+
+  Stream& rect(float l, float t, float r, float b) { return f32(l).f32(t).f32(r).f32(b); }
+
+  Stream& sampling(uint32_t filter, uint32_t mipmap) { return u32(0).u32(0).f32(0).f32(0).u32(filter).u32(mipmap); }
+
+  // Drops the last `count` bytes.
+  Stream& truncate(size_t count) {
+    bytes_.resize(bytes_.size() - count);
+    return *this;
+  }
+
+  const std::vector<uint8_t>& bytes() const { return bytes_; }
+
+ private:
+  std::vector<uint8_t> bytes_;
+};
+
+struct Fixture {
+  Fixture() {
+    surface = SkSurfaces::Raster(SkImageInfo::MakeN32Premul(8, 8));
+    paint.setColor(SK_ColorBLUE);
+    image = surface->makeImageSnapshot();
+    const SkPoint positions[] = {{0, 0}, {8, 0}, {0, 8}};
+    vertices = SkVertices::MakeCopy(SkVertices::kTriangles_VertexMode, 3, positions, nullptr, nullptr);
+  }
+
+  sk_sp<SkSurface> surface;
+  SkPaint paint;
+  SkFont font;
+  sk_sp<SkImage> image;
+  sk_sp<SkVertices> vertices;
+};
+
+int failures = 0;
+
+// Clears the surface to white, runs `stream` and checks the result and the
+// color it leaves at the origin.
+void expect(const char* name, Fixture& fixture, const Stream& stream, bool expected_result, SkColor expected_color, const std::vector<const void*>& objects) {
+  fixture.surface->getCanvas()->clear(SK_ColorWHITE);
+  const bool result = sk_canvas_execute_commands(ToCanvas(fixture.surface->getCanvas()), stream.bytes().data(), stream.bytes().size(), objects.data(), objects.size());
+  SkPixmap pixmap;
+  const SkColor color = fixture.surface->peekPixels(&pixmap) ? pixmap.getColor(0, 0) : 0;
+  if (result != expected_result || color != expected_color) {
+    std::printf("%s: returned %d with color 0x%08x, expected %d with 0x%08x\n", name, result, color, expected_result, expected_color);
+    ++failures;
+  }
+}
+
+}  // namespace
+
+int main() {
+  Fixture fixture;
+  // Objects: 0 paint, 1 font, 2 image, 3 vertices, 4 null.
+  const std::vector<const void*> objects = {&fixture.paint, &fixture.font, fixture.image.get(), fixture.vertices.get(), nullptr};
+  auto cleared = [](SkColor color) { return Stream().op(CLEAR_SK_CANVAS_COMMAND).u32(color); };
+
+  expect("valid", fixture, cleared(SK_ColorRED).op(DRAW_PAINT_SK_CANVAS_COMMAND).u32(0), true, SK_ColorBLUE, objects);
+  expect("header only", fixture, Stream(), true, SK_ColorWHITE, objects);
+  expect("empty", fixture, Stream().truncate(4), false, SK_ColorWHITE, objects);
+  expect("wrong version", fixture, Stream(SK_CANVAS_COMMANDS_VERSION + 1).op(CLEAR_SK_CANVAS_COMMAND).u32(SK_ColorRED), false, SK_ColorWHITE, objects);
+
+  // Truncated commands.
+  expect("truncated opcode", fixture, cleared(SK_ColorRED).u32(0).truncate(2), false, SK_ColorRED, objects);
+  expect("truncated arguments", fixture, cleared(SK_ColorRED).op(DRAW_RECT_SK_CANVAS_COMMAND).rect(0, 0, 8, 8).truncate(4), false, SK_ColorRED, objects);
+  expect("truncated paint", fixture, cleared(SK_ColorRED).op(DRAW_RECT_SK_CANVAS_COMMAND).rect(0, 0, 8, 8), false, SK_ColorRED, objects);
+  expect("truncated points", fixture, cleared(SK_ColorRED).op(DRAW_POINTS_SK_CANVAS_COMMAND).u32(0).u32(1000).f32(0).f32(0), false, SK_ColorRED, objects);
+  expect("truncated text", fixture, cleared(SK_ColorRED).op(DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND).u32(0xFFFFFFF0), false, SK_ColorRED, objects);
+
+  // Unknown opcodes.
+  expect("unknown opcode", fixture, cleared(SK_ColorRED).u32(0xFFFF).op(DRAW_PAINT_SK_CANVAS_COMMAND).u32(0), false, SK_ColorRED, objects);
+
+  // Enum operands past the end of their enum.
+  expect("clip op", fixture, cleared(SK_ColorRED).op(CLIP_RECT_SK_CANVAS_COMMAND).rect(0, 0, 8, 8).u32(kOutOfRange).u32(0), false, SK_ColorRED, objects);
+  expect("draw color mode", fixture, cleared(SK_ColorRED).op(DRAW_COLOR_SK_CANVAS_COMMAND).u32(SK_ColorBLUE).u32(kOutOfRange), false, SK_ColorRED, objects);
+  expect("point mode", fixture, cleared(SK_ColorRED).op(DRAW_POINTS_SK_CANVAS_COMMAND).u32(kOutOfRange).u32(1).f32(0).f32(0).u32(0), false, SK_ColorRED, objects);
+  expect("filter mode", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_SK_CANVAS_COMMAND).u32(2).f32(0).f32(0).sampling(kOutOfRange, 0).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("mipmap mode", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_SK_CANVAS_COMMAND).u32(2).f32(0).f32(0).sampling(0, kOutOfRange).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("text encoding", fixture, cleared(SK_ColorRED).op(DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND).u32(1).u32('A').u32(kOutOfRange).f32(0).f32(8).u32(1).u32(0), false, SK_ColorRED, objects);
+  expect("vertices mode", fixture, cleared(SK_ColorRED).op(DRAW_VERTICES_SK_CANVAS_COMMAND).u32(3).u32(kOutOfRange).u32(0), false, SK_ColorRED, objects);
+  expect("save layer flags", fixture, cleared(SK_ColorRED).op(SAVE_LAYER_SK_CANVAS_COMMAND).u32(4), false, SK_ColorRED, objects);
+  expect("save layer rec flags", fixture, cleared(SK_ColorRED).op(SAVE_LAYER_REC_SK_CANVAS_COMMAND).u32(0).u32(1 << 3), false, SK_ColorRED, objects);
+  expect("draw color4f mode", fixture, cleared(SK_ColorRED).op(DRAW_COLOR4F_SK_CANVAS_COMMAND).f32(0).f32(0).f32(1).f32(1).u32(kOutOfRange), false, SK_ColorRED, objects);
+  expect("image nine filter", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_NINE_SK_CANVAS_COMMAND).u32(2).u32(2).u32(2).u32(6).u32(6).rect(0, 0, 8, 8).u32(kOutOfRange).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("lattice rect type", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND).u32(2).u32(0).u32(0).u32(1).u32(kOutOfRange).rect(0, 0, 8, 8).u32(0).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("lattice fixed color without colors", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND).u32(2).u32(0).u32(0).u32(1).u32(SkCanvas::Lattice::kFixedColor).rect(0, 0, 8, 8).u32(0).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("lattice colors without rect types", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND).u32(2).u32(0).u32(0).u32(2).u32(SK_ColorBLUE).rect(0, 0, 8, 8).u32(0).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("atlas mode", fixture, cleared(SK_ColorRED).op(DRAW_ATLAS_SK_CANVAS_COMMAND).u32(2).u32(1).f32(1).f32(0).f32(0).f32(0).rect(0, 0, 8, 8).u32(0).u32(kOutOfRange).sampling(0, 0).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("truncated atlas", fixture, cleared(SK_ColorRED).op(DRAW_ATLAS_SK_CANVAS_COMMAND).u32(2).u32(1000).f32(1), false, SK_ColorRED, objects);
+  expect("truncated patch", fixture, cleared(SK_ColorRED).op(DRAW_PATCH_SK_CANVAS_COMMAND).f32(0).f32(0), false, SK_ColorRED, objects);
+
+  // Bad object indices.
+  expect("index past table", fixture, cleared(SK_ColorRED).op(DRAW_PAINT_SK_CANVAS_COMMAND).u32(static_cast<uint32_t>(objects.size())), false, SK_ColorRED, objects);
+  expect("null object", fixture, cleared(SK_ColorRED).op(DRAW_PAINT_SK_CANVAS_COMMAND).u32(4), false, SK_ColorRED, objects);
+  expect("missing required object", fixture, cleared(SK_ColorRED).op(DRAW_PAINT_SK_CANVAS_COMMAND).u32(SK_CANVAS_COMMAND_NO_OBJECT), false, SK_ColorRED, objects);
+  expect("optional index past table", fixture, cleared(SK_ColorRED).op(DRAW_IMAGE_SK_CANVAS_COMMAND).u32(2).f32(0).f32(0).sampling(0, 0).u32(99), false, SK_ColorRED, objects);
+  expect("no object table", fixture, cleared(SK_ColorRED).op(DRAW_PAINT_SK_CANVAS_COMMAND).u32(0), false, SK_ColorRED, {});
+
+  if (failures) {
+    std::printf("%d failures\n", failures);
+    return 1;
+  }
+  std::printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,89 @@
+// Checks the bulk color conversions behind sk_color_premultiply_array and
+// sk_color_unpremultiply_array against SkPreMultiplyColor and
+// SkUnPreMultiply::PMColorToColor for every alpha value, allowing each channel
+// to differ by one. Both SkPMColor byte orders are checked, so the swizzles of
+// platforms whose N32 order differs from this one's are covered too.
+//
+// Exits with a non-zero status if any color differs by more than that.
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "include/core/SkColor.h"
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkSwizzle.h"
+#include "include/core/SkUnPreMultiply.h"
+#include "wrapper/pixel_convert.h"
+
+namespace {
+
+bool channels_match(uint32_t a, uint32_t b) {
+  for (int shift = 0; shift < 32; shift += 8) {
+    const int delta = static_cast<int>((a >> shift) & 0xff) - static_cast<int>((b >> shift) & 0xff);
+    if (delta > 1 || delta < -1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Returns the number of mismatches, printing the first few.
+int check(const char* name, const std::vector<uint32_t>& inputs, const std::vector<uint32_t>& expected, const std::vector<uint32_t>& actual) {
+  int mismatches = 0;
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (!channels_match(expected[i], actual[i])) {
+      if (++mismatches <= 10) {
+        std::printf("%s: 0x%08x -> 0x%08x, expected 0x%08x\n", name, inputs[i], actual[i], expected[i]);
+      }
+    }
+  }
+  return mismatches;
+}
+
+}  // namespace
+
+int main() {
+  // Every alpha with every value of one channel, and the other channels
+  // derived from it, so that each channel sees every value at every alpha.
+  std::vector<SkColor> colors;
+  for (unsigned alpha = 0; alpha < 256; ++alpha) {
+    for (unsigned value = 0; value < 256; ++value) {
+      colors.push_back(SkColorSetARGB(alpha, value, 255 - value, (value * 97) & 0xff));
+    }
+  }
+  const int count = static_cast<int>(colors.size());
+
+  std::vector<SkPMColor> n32(count);
+  for (int i = 0; i < count; ++i) {
+    n32[i] = SkPreMultiplyColor(colors[i]);
+  }
+  // The same premultiplied colors with red and blue in the other order.
+  std::vector<SkPMColor> swapped(count);
+  SkSwapRB(swapped.data(), n32.data(), count);
+  const SkColorType other_type = kN32_SkColorType == kBGRA_8888_SkColorType ? kRGBA_8888_SkColorType : kBGRA_8888_SkColorType;
+
+  std::vector<uint32_t> expected(count);
+  std::vector<uint32_t> actual(count);
+  int mismatches = 0;
+
+  PremultiplyColors(colors.data(), count, actual.data());
+  mismatches += check("premultiply n32", colors, n32, actual);
+  PremultiplyColors(colors.data(), count, actual.data(), 0, other_type);
+  mismatches += check("premultiply swapped", colors, swapped, actual);
+
+  for (int i = 0; i < count; ++i) {
+    expected[i] = SkUnPreMultiply::PMColorToColor(n32[i]);
+  }
+  UnpremultiplyColors(n32.data(), count, actual.data());
+  mismatches += check("unpremultiply n32", n32, expected, actual);
+  UnpremultiplyColors(swapped.data(), count, actual.data(), 0, other_type);
+  mismatches += check("unpremultiply swapped", swapped, expected, actual);
+
+  if (mismatches) {
+    std::printf("%d mismatches\n", mismatches);
+    return 1;
+  }
+  std::printf("ok\n");
+  return 0;
+}
@@ -0,0 +1,126 @@
+#include "async_task.h"
+
+#include <chrono>
+
+#include "run_loop.h"
+#include "worker_pool.h"
+
+namespace {
+
+struct Counters {
+  std::atomic<uint64_t> submitted{0};
+  std::atomic<uint64_t> completed{0};
+  std::atomic<uint64_t> cancelled{0};
+  std::atomic<int64_t> queue_depth{0};
+  std::atomic<int64_t> running{0};
+  std::atomic<uint64_t> total_queue_ns{0};
+  std::atomic<uint64_t> max_queue_ns{0};
+  std::atomic<uint64_t> total_run_ns{0};
+};
+
+Counters& counters() {
+  static Counters counters;
+  return counters;
+}
+
+uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+AsyncTask::AsyncTask(int64_t isolate_handle, Callback work, Callback completion)
+    : isolate_handle_(isolate_handle), work_(std::move(work)), completion_(std::move(completion)), submit_time_ns_(now_ns()) {}
+
+AsyncTask* AsyncTask::submit(int64_t isolate_handle, Callback work, Callback completion) {
+  AsyncTask* task = new AsyncTask(isolate_handle, std::move(work), std::move(completion));
+  counters().submitted.fetch_add(1, std::memory_order_relaxed);
+  counters().queue_depth.fetch_add(1, std::memory_order_relaxed);
+  WorkerPool::shared().add([task] { task->run(); });
+  return task;
+}
+
+bool AsyncTask::cancel() {
+  cancel_requested_.store(true, std::memory_order_relaxed);
+  Status expected = Status::kPending;
+  if (!status_.compare_exchange_strong(expected, Status::kCancelled, std::memory_order_acq_rel)) {
+    return false;
+  }
+  counters().queue_depth.fetch_sub(1, std::memory_order_relaxed);
+  counters().cancelled.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+void AsyncTask::run() {
+  Status expected = Status::kPending;
+  if (status_.compare_exchange_strong(expected, Status::kRunning, std::memory_order_acq_rel)) {
+    Counters& c = counters();
+    const uint64_t start = now_ns();
+    const uint64_t queued = start - submit_time_ns_;
+    c.queue_depth.fetch_sub(1, std::memory_order_relaxed);
+    c.running.fetch_add(1, std::memory_order_relaxed);
+    c.total_queue_ns.fetch_add(queued, std::memory_order_relaxed);
+    uint64_t max = c.max_queue_ns.load(std::memory_order_relaxed);
+    while (queued > max && !c.max_queue_ns.compare_exchange_weak(max, queued, std::memory_order_relaxed)) {
+    }
+
+    work_(*this);
+
+    c.total_run_ns.fetch_add(now_ns() - start, std::memory_order_relaxed);
+    c.running.fetch_sub(1, std::memory_order_relaxed);
+    c.completed.fetch_add(1, std::memory_order_relaxed);
+    status_.store(Status::kCompleted, std::memory_order_release);
+  }
+  // Release whatever the work captured on this thread rather than on the
+  // isolate.
+  work_ = nullptr;
+
+  if (!completion_ || !RunLoop::schedule(isolate_handle_, &AsyncTask::complete, this)) {
+    // Without a completion, or once the isolate is gone, nobody else will
+    // release the pool's reference.
+    completion_ = nullptr;
+    unref();
+  }
+}
+
+void AsyncTask::complete(void* data) {
+  AsyncTask* task = static_cast<AsyncTask*>(data);
+  task->completion_(*task);
+  task->completion_ = nullptr;
+  task->unref();
+}
+
+void AsyncTask::ref() {
+  ref_count_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void AsyncTask::unref() {
+  if (ref_count_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete this;
+  }
+}
+
+AsyncTask::Stats AsyncTask::stats() {
+  const Counters& c = counters();
+  return {
+      c.submitted.load(std::memory_order_relaxed),
+      c.completed.load(std::memory_order_relaxed),
+      c.cancelled.load(std::memory_order_relaxed),
+      c.queue_depth.load(std::memory_order_relaxed),
+      c.running.load(std::memory_order_relaxed),
+      c.total_queue_ns.load(std::memory_order_relaxed),
+      c.max_queue_ns.load(std::memory_order_relaxed),
+      c.total_run_ns.load(std::memory_order_relaxed),
+  };
+}
+
+void AsyncTask::reset_stats() {
+  // Queue depth and running describe the current state and are not reset.
+  Counters& c = counters();
+  c.submitted.store(0, std::memory_order_relaxed);
+  c.completed.store(0, std::memory_order_relaxed);
+  c.cancelled.store(0, std::memory_order_relaxed);
+  c.total_queue_ns.store(0, std::memory_order_relaxed);
+  c.max_queue_ns.store(0, std::memory_order_relaxed);
+  c.total_run_ns.store(0, std::memory_order_relaxed);
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+// A unit of work that runs on the shared WorkerPool and reports back to a Dart
+// isolate.
+//
+// The work runs on a pool thread. Afterwards the completion is scheduled with
+// RunLoop::schedule on the isolate that submitted the task, so it can safely
+// touch isolate-bound state. The completion runs even if the task was
+// cancelled before it started, so it can release whatever the work would
+// have consumed; check status() to tell the two apart.
+//
+// Tasks are reference counted. submit() returns one reference that belongs to
+// the caller; the pool holds another until the completion has run.
+class AsyncTask {
+ public:
+  enum class Status : int {
+    kPending,
+    kRunning,
+    kCompleted,
+    kCancelled,
+  };
+
+  using Callback = std::function<void(AsyncTask&)>;
+
+  struct Stats {
+    uint64_t submitted;
+    uint64_t completed;
+    uint64_t cancelled;
+    // Tasks waiting for a pool thread and tasks currently running.
+    int64_t queue_depth;
+    int64_t running;
+    // Time between submission and the work starting, and time spent running
+    // the work, summed over all completed tasks.
+    uint64_t total_queue_ns;
+    uint64_t max_queue_ns;
+    uint64_t total_run_ns;
+  };
+
+  static AsyncTask* submit(int64_t isolate_handle, Callback work, Callback completion);
+
+  // Cancels the task if its work has not started yet. Returns false if the
+  // work is already running or done; running work can poll
+  // cancel_requested() to stop early.
+  bool cancel();
+
+  bool cancel_requested() const { return cancel_requested_.load(std::memory_order_relaxed); }
+  Status status() const { return status_.load(std::memory_order_acquire); }
+
+  void ref();
+  void unref();
+
+  static Stats stats();
+  static void reset_stats();
+
+ private:
+  AsyncTask(int64_t isolate_handle, Callback work, Callback completion);
+
+  void run();
+  static void complete(void* task);
+
+  const int64_t isolate_handle_;
+  Callback work_;
+  Callback completion_;
+  const uint64_t submit_time_ns_;
+  std::atomic<Status> status_{Status::kPending};
+  std::atomic_bool cancel_requested_{false};
+  std::atomic<int> ref_count_{2};
+};
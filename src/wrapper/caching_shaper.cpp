@@ -0,0 +1,313 @@
+#include "caching_shaper.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "include/core/SkFontMgr.h"
+
+#ifdef SK_SHAPER_HARFBUZZ_AVAILABLE
+  #include "modules/skshaper/include/SkShaper_harfbuzz.h"
+  #include "modules/skshaper/include/SkShaper_skunicode.h"
+#endif
+
+namespace {
+
+template <typename Value>
+struct RecordedRun {
+  size_t end;
+  Value value;
+};
+
+// Consumes `iterator` to the end, recording every run.
+template <typename Value, typename Iterator, typename Get>
+std::vector<RecordedRun<Value>> Record(Iterator& iterator, Get get) {
+  std::vector<RecordedRun<Value>> runs;
+  while (!iterator.atEnd()) {
+    iterator.consume();
+    runs.push_back({iterator.endOfCurrentRun(), get(iterator)});
+  }
+  return runs;
+}
+
+// Returns the index of the run containing `offset`, starting the search at
+// `run`. Text past the last run belongs to the last run.
+template <typename Value>
+size_t NextRun(const std::vector<RecordedRun<Value>>& runs, size_t run, size_t offset) {
+  while (run + 1 < runs.size() && runs[run].end <= offset) {
+    ++run;
+  }
+  return run;
+}
+
+// Replays recorded runs for the fallback shaper, since the caller's
+// iterators cannot be rewound.
+template <typename Base, typename Value>
+class ReplayRunIterator : public Base {
+ public:
+  explicit ReplayRunIterator(const std::vector<RecordedRun<Value>>& runs) : runs_(runs) {}
+
+  void consume() override { ++consumed_; }
+  size_t endOfCurrentRun() const override { return consumed_ > 0 ? runs_[consumed_ - 1].end : 0; }
+  bool atEnd() const override { return consumed_ >= runs_.size(); }
+
+ protected:
+  const Value& current() const { return runs_[consumed_ > 0 ? consumed_ - 1 : 0].value; }
+
+ private:
+  const std::vector<RecordedRun<Value>>& runs_;
+  size_t consumed_ = 0;
+};
+
+class ReplayFontRunIterator final : public ReplayRunIterator<SkShaper::FontRunIterator, SkFont> {
+ public:
+  using ReplayRunIterator::ReplayRunIterator;
+  const SkFont& currentFont() const override { return current(); }
+};
+
+class ReplayBiDiRunIterator final : public ReplayRunIterator<SkShaper::BiDiRunIterator, uint8_t> {
+ public:
+  using ReplayRunIterator::ReplayRunIterator;
+  uint8_t currentLevel() const override { return current(); }
+};
+
+class ReplayScriptRunIterator final : public ReplayRunIterator<SkShaper::ScriptRunIterator, SkFourByteTag> {
+ public:
+  using ReplayRunIterator::ReplayRunIterator;
+  SkFourByteTag currentScript() const override { return current(); }
+};
+
+class ReplayLanguageRunIterator final : public ReplayRunIterator<SkShaper::LanguageRunIterator, std::string> {
+ public:
+  using ReplayRunIterator::ReplayRunIterator;
+  const char* currentLanguage() const override { return current().c_str(); }
+};
+
+// Collects the glyphs of a word shaped on a single line.
+class WordRunHandler final : public SkShaper::RunHandler {
+ public:
+  explicit WordRunHandler(ShapingCache::Word* word) : word_(word) {}
+
+  void beginLine() override {}
+  void runInfo(const RunInfo&) override {}
+  void commitRunInfo() override {}
+
+  Buffer runBuffer(const RunInfo& info) override {
+    const size_t start = word_->glyphs.size();
+    const size_t count = start + info.glyphCount;
+    word_->glyphs.resize(count);
+    word_->positions.resize(count);
+    word_->offsets.resize(count);
+    word_->clusters.resize(count);
+    return {word_->glyphs.data() + start, word_->positions.data() + start, word_->offsets.data() + start, word_->clusters.data() + start, {word_->advance.fX, 0}};
+  }
+
+  void commitRunBuffer(const RunInfo& info) override { word_->advance.fX += info.fAdvance.fX; }
+  void commitLine() override {}
+
+ private:
+  ShapingCache::Word* word_;
+};
+
+// A word or a run of spaces with uniform font, bidi level, script and
+// language.
+struct Piece {
+  size_t start;
+  size_t end;
+  size_t font;
+  size_t bidi;
+  size_t script;
+  size_t language;
+  bool space;
+  std::shared_ptr<const ShapingCache::Word> word;
+};
+
+bool NeedsFallback(const char* utf8, size_t length, const std::vector<RecordedRun<uint8_t>>& levels, size_t features) {
+  if (features > 0) {
+    return true;
+  }
+  for (const auto& run : levels) {
+    if (run.value & 1) {
+      return true;
+    }
+  }
+  for (size_t i = 0; i < length; ++i) {
+    const char c = utf8[i];
+    // Hard line breaks, including U+2028 and U+2029.
+    if (c == '\n' || c == '\r' || (c == '\xE2' && i + 2 < length && utf8[i + 1] == '\x80' && (utf8[i + 2] == '\xA8' || utf8[i + 2] == '\xA9'))) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
+CachingShaper::CachingShaper(std::unique_ptr<SkShaper> shaper, std::unique_ptr<SkShaper> fallback, sk_sp<SkFontMgr> font_manager, sk_sp<SkUnicode> unicode, sk_sp<ShapingCache> cache)
+    : shaper_(std::move(shaper)), fallback_(std::move(fallback)), font_manager_(std::move(font_manager)), unicode_(std::move(unicode)), cache_(std::move(cache)) {}
+
+void CachingShaper::shape(const char* utf8, size_t utf8Bytes, const SkFont& srcFont, bool leftToRight, SkScalar width, RunHandler* handler) const {
+  const uint8_t level = leftToRight ? 0 : 1;
+  std::unique_ptr<FontRunIterator> font = MakeFontMgrRunIterator(utf8, utf8Bytes, srcFont, font_manager_ ? font_manager_ : SkFontMgr::RefEmpty());
+  std::unique_ptr<BiDiRunIterator> bidi;
+  std::unique_ptr<ScriptRunIterator> script;
+#ifdef SK_SHAPER_HARFBUZZ_AVAILABLE
+  bidi = SkShapers::unicode::BidiRunIterator(unicode_, utf8, utf8Bytes, level);
+  script = SkShapers::HB::ScriptRunIterator(utf8, utf8Bytes);
+#endif
+  if (!bidi) {
+    bidi = std::make_unique<TrivialBiDiRunIterator>(level, utf8Bytes);
+  }
+  if (!script) {
+    script = std::make_unique<TrivialScriptRunIterator>(SkSetFourByteTag('Z', 'y', 'y', 'y'), utf8Bytes);
+  }
+  std::unique_ptr<LanguageRunIterator> language = MakeStdLanguageRunIterator(utf8, utf8Bytes);
+  shape(utf8, utf8Bytes, *font, *bidi, *script, *language, nullptr, 0, width, handler);
+}
+
+void CachingShaper::shape(const char* utf8, size_t utf8Bytes, FontRunIterator& font, BiDiRunIterator& bidi, ScriptRunIterator& script, LanguageRunIterator& language, SkScalar width, RunHandler* handler) const {
+  shape(utf8, utf8Bytes, font, bidi, script, language, nullptr, 0, width, handler);
+}
+
+void CachingShaper::shape(const char* utf8, size_t utf8Bytes, FontRunIterator& font, BiDiRunIterator& bidi, ScriptRunIterator& script, LanguageRunIterator& language, const Feature* features, size_t featuresSize, SkScalar width, RunHandler* handler) const {
+  const auto fonts = Record<SkFont>(font, [](const FontRunIterator& it) { return it.currentFont(); });
+  const auto levels = Record<uint8_t>(bidi, [](const BiDiRunIterator& it) { return it.currentLevel(); });
+  const auto scripts = Record<SkFourByteTag>(script, [](const ScriptRunIterator& it) { return it.currentScript(); });
+  const auto languages = Record<std::string>(language, [](const LanguageRunIterator& it) { return std::string(it.currentLanguage()); });
+
+  if (NeedsFallback(utf8, utf8Bytes, levels, featuresSize) || fonts.empty() || levels.empty() || scripts.empty() || languages.empty()) {
+    ReplayFontRunIterator replay_font(fonts);
+    ReplayBiDiRunIterator replay_bidi(levels);
+    ReplayScriptRunIterator replay_script(scripts);
+    ReplayLanguageRunIterator replay_language(languages);
+    fallback_->shape(utf8, utf8Bytes, replay_font, replay_bidi, replay_script, replay_language, features, featuresSize, width, handler);
+    return;
+  }
+
+  // Split the text at spaces and at every run boundary.
+  std::vector<Piece> pieces;
+  size_t run_font = 0;
+  size_t run_bidi = 0;
+  size_t run_script = 0;
+  size_t run_language = 0;
+  size_t start = 0;
+  while (start < utf8Bytes) {
+    run_font = NextRun(fonts, run_font, start);
+    run_bidi = NextRun(levels, run_bidi, start);
+    run_script = NextRun(scripts, run_script, start);
+    run_language = NextRun(languages, run_language, start);
+    size_t run_end = std::min({fonts[run_font].end, levels[run_bidi].end, scripts[run_script].end, languages[run_language].end, utf8Bytes});
+    if (run_end <= start) {
+      run_end = utf8Bytes;
+    }
+    const bool space = utf8[start] == ' ';
+    size_t end = start + 1;
+    while (end < run_end && (utf8[end] == ' ') == space) {
+      ++end;
+    }
+    pieces.push_back({start, end, run_font, run_bidi, run_script, run_language, space, nullptr});
+    start = end;
+  }
+
+  for (Piece& piece : pieces) {
+    const SkFont& piece_font = fonts[piece.font].value;
+    const uint8_t level = levels[piece.bidi].value;
+    const SkFourByteTag piece_script = scripts[piece.script].value;
+    const char* piece_language = languages[piece.language].value.c_str();
+    const size_t length = piece.end - piece.start;
+    ShapingCache::Key key = ShapingCache::MakeKey(utf8 + piece.start, length, piece_font, piece_script, piece_language, level);
+    piece.word = cache_->find(key);
+    if (piece.word) {
+      continue;
+    }
+    auto word = std::make_shared<ShapingCache::Word>();
+    word->advance = {0, 0};
+    WordRunHandler word_handler(word.get());
+    TrivialFontRunIterator word_font(piece_font, length);
+    TrivialBiDiRunIterator word_bidi(level, length);
+    TrivialScriptRunIterator word_script(piece_script, length);
+    TrivialLanguageRunIterator word_language(piece_language, length);
+    shaper_->shape(utf8 + piece.start, length, word_font, word_bidi, word_script, word_language, nullptr, 0, SK_ScalarMax, &word_handler);
+    cache_->insert(key, word);
+    piece.word = std::move(word);
+  }
+
+  // Greedy wrapping at spaces; spaces at the end of a line may overhang.
+  std::vector<size_t> line_starts = {0};
+  float line_width = 0;
+  bool line_has_word = false;
+  for (size_t i = 0; i < pieces.size(); ++i) {
+    const float advance = pieces[i].word->advance.fX;
+    if (!pieces[i].space) {
+      if (line_has_word && line_width + advance > width) {
+        line_starts.push_back(i);
+        line_width = 0;
+      }
+      line_has_word = true;
+    }
+    line_width += advance;
+  }
+  line_starts.push_back(pieces.size());
+
+  // Consecutive pieces with the same font, level, script and language form
+  // one run.
+  struct LineRun {
+    size_t first;
+    size_t last;
+    float advance;
+    size_t glyphs;
+  };
+  std::vector<LineRun> runs;
+  for (size_t line = 0; line + 1 < line_starts.size(); ++line) {
+    runs.clear();
+    for (size_t i = line_starts[line]; i < line_starts[line + 1]; ++i) {
+      const Piece& piece = pieces[i];
+      if (!runs.empty()) {
+        const Piece& previous = pieces[runs.back().last];
+        if (fonts[previous.font].value == fonts[piece.font].value && previous.bidi == piece.bidi && previous.script == piece.script && previous.language == piece.language) {
+          runs.back().last = i;
+          runs.back().advance += piece.word->advance.fX;
+          runs.back().glyphs += piece.word->glyphs.size();
+          continue;
+        }
+      }
+      runs.push_back({i, i, piece.word->advance.fX, piece.word->glyphs.size()});
+    }
+
+    auto run_info = [&](const LineRun& run) {
+      const Piece& first = pieces[run.first];
+      return RunHandler::RunInfo{fonts[first.font].value, levels[first.bidi].value, scripts[first.script].value, languages[first.language].value.c_str(), {run.advance, 0}, run.glyphs, RunHandler::Range(first.start, pieces[run.last].end - first.start)};
+    };
+
+    handler->beginLine();
+    for (const LineRun& run : runs) {
+      handler->runInfo(run_info(run));
+    }
+    handler->commitRunInfo();
+    for (const LineRun& run : runs) {
+      const RunHandler::RunInfo info = run_info(run);
+      const RunHandler::Buffer buffer = handler->runBuffer(info);
+      size_t glyph = 0;
+      SkPoint origin = buffer.point;
+      for (size_t i = run.first; i <= run.last; ++i) {
+        const Piece& piece = pieces[i];
+        const ShapingCache::Word& word = *piece.word;
+        for (size_t g = 0; g < word.glyphs.size(); ++g, ++glyph) {
+          buffer.glyphs[glyph] = word.glyphs[g];
+          if (buffer.offsets) {
+            buffer.positions[glyph] = origin + word.positions[g];
+            buffer.offsets[glyph] = word.offsets[g];
+          } else {
+            buffer.positions[glyph] = origin + word.positions[g] + word.offsets[g];
+          }
+          if (buffer.clusters) {
+            buffer.clusters[glyph] = static_cast<uint32_t>(piece.start) + word.clusters[g];
+          }
+        }
+        origin.fX += word.advance.fX;
+      }
+      handler->commitRunBuffer(info);
+    }
+    handler->commitLine();
+  }
+}
@@ -0,0 +1,31 @@
+#pragma once
+
+#include <memory>
+
+#include "modules/skshaper/include/SkShaper.h"
+#include "wrapper/shaping_cache.h"
+
+// A shape-then-wrap shaper that shapes text word by word and reuses earlier
+// results from a ShapingCache. Words are split at ASCII spaces and at font,
+// script, language and bidi run boundaries, shaped without context by
+// `shaper`, and wrapped greedily at spaces; a word wider than the line is not
+// broken.
+//
+// Text that needs reordering (an odd bidi level), OpenType features or hard
+// line breaks is passed to `fallback` unchanged.
+class CachingShaper : public SkShaper {
+ public:
+  // `shaper` must neither wrap nor reorder.
+  CachingShaper(std::unique_ptr<SkShaper> shaper, std::unique_ptr<SkShaper> fallback, sk_sp<SkFontMgr> font_manager, sk_sp<SkUnicode> unicode, sk_sp<ShapingCache> cache);
+
+  void shape(const char* utf8, size_t utf8Bytes, const SkFont& srcFont, bool leftToRight, SkScalar width, RunHandler* handler) const override;
+  void shape(const char* utf8, size_t utf8Bytes, FontRunIterator& font, BiDiRunIterator& bidi, ScriptRunIterator& script, LanguageRunIterator& language, SkScalar width, RunHandler* handler) const override;
+  void shape(const char* utf8, size_t utf8Bytes, FontRunIterator& font, BiDiRunIterator& bidi, ScriptRunIterator& script, LanguageRunIterator& language, const Feature* features, size_t featuresSize, SkScalar width, RunHandler* handler) const override;
+
+ private:
+  std::unique_ptr<SkShaper> shaper_;
+  std::unique_ptr<SkShaper> fallback_;
+  sk_sp<SkFontMgr> font_manager_;
+  sk_sp<SkUnicode> unicode_;
+  sk_sp<ShapingCache> cache_;
+};
@@ -0,0 +1,46 @@
+#include "decoded_image_cache.h"
+
+#include "include/core/SkBitmap.h"
+#include "src/core/SkChecksum.h"
+#include "wrapper/scaled_decode.h"
+
+bool DecodedImageCache::Key::operator==(const Key& other) const {
+  return content_hash == other.content_hash && content_size == other.content_size && width == other.width &&
+         height == other.height && color_type == other.color_type &&
+         SkColorSpace::Equals(color_space.get(), other.color_space.get());
+}
+
+size_t DecodedImageCache::KeyHash::operator()(const Key& key) const {
+  uint64_t hash = key.content_hash;
+  hash = hash * 31 + static_cast<uint64_t>(key.width);
+  hash = hash * 31 + static_cast<uint64_t>(key.height);
+  hash = hash * 31 + static_cast<uint64_t>(key.color_type);
+  if (key.color_space) {
+    hash = hash * 31 + key.color_space->toXYZD50Hash();
+    hash = hash * 31 + key.color_space->transferFnHash();
+  }
+  return static_cast<size_t>(hash);
+}
+
+sk_sp<SkImage> DecodedImageCache::get(const sk_sp<SkData>& data, int width, int height, SkColorType color_type, sk_sp<SkColorSpace> color_space) {
+  if (!data) {
+    return nullptr;
+  }
+  // Keyed on the request as given: resolving zero dimensions against the
+  // encoded size would need a codec on every lookup.
+  Key key{SkChecksum::Hash64(data->data(), data->size()), data->size(), width, height, color_type, std::move(color_space)};
+  sk_sp<SkImage> image;
+  if (cache_.find(key, &image)) {
+    return image;
+  }
+
+  SkBitmap bitmap;
+  decode_scaled(data, width, height, color_type, key.color_space, &bitmap);
+  if (bitmap.drawsNothing()) {
+    return nullptr;
+  }
+  // An image larger than the whole budget is evicted right away; the caller
+  // still gets it.
+  const size_t bytes = bitmap.computeByteSize();
+  return cache_.insert(std::move(key), bitmap.asImage(), bytes);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkData.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkRefCnt.h"
+#include "wrapper/lru_cache.h"
+
+// LRU cache of decoded raster images, keyed by a hash of the encoded bytes and
+// the requested size, color type and color space. Unlike the global resource
+// cache used by deferred images, every requested size is decoded directly
+// (see decode_scaled), so a thumbnail never costs a full-size decode that
+// stays resident.
+//
+// The byte budget only covers pixels held by the cache; images handed out
+// stay alive while referenced even after they are evicted.
+class DecodedImageCache {
+ public:
+  using Stats = LruCacheStats;
+
+  explicit DecodedImageCache(size_t budget) : cache_(budget) {}
+
+  DecodedImageCache(const DecodedImageCache&) = delete;
+  DecodedImageCache& operator=(const DecodedImageCache&) = delete;
+
+  // Returns the cached image or decodes and inserts it. Returns null if the
+  // data cannot be decoded. Decoding happens outside the lock, so concurrent
+  // misses on the same key may both decode; the first insert wins.
+  sk_sp<SkImage> get(const sk_sp<SkData>& data, int width, int height, SkColorType color_type, sk_sp<SkColorSpace> color_space);
+
+  size_t budget() const { return cache_.budget(); }
+  // Evicts entries as needed to fit the new budget.
+  void set_budget(size_t budget) { cache_.set_budget(budget); }
+  void purge() { cache_.purge(); }
+
+  Stats stats() const { return cache_.stats(); }
+  void reset_stats() { cache_.reset_stats(); }
+
+ private:
+  struct Key {
+    uint64_t content_hash;
+    size_t content_size;
+    int width;
+    int height;
+    SkColorType color_type;
+    sk_sp<SkColorSpace> color_space;
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  LruCache<Key, sk_sp<SkImage>, KeyHash> cache_;
+};
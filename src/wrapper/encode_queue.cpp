@@ -0,0 +1,161 @@
+#include "encode_queue.h"
+
+#include <algorithm>
+#include <chrono>
+#include <memory>
+
+#include "include/core/SkPixmap.h"
+#include "include/core/SkStream.h"
+
+namespace {
+
+uint64_t now_ns() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+}  // namespace
+
+sk_sp<SkData> EncodePixmap(const SkPixmap& pixmap, const EncodeOptions& options) {
+  SkDynamicMemoryWStream stream;
+  bool encoded = false;
+  switch (options.format) {
+    case SkEncodedImageFormat::kPNG:
+      encoded = SkPngEncoder::Encode(&stream, pixmap, options.png);
+      break;
+    case SkEncodedImageFormat::kJPEG:
+      encoded = SkJpegEncoder::Encode(&stream, pixmap, options.jpeg);
+      break;
+    case SkEncodedImageFormat::kWEBP:
+      encoded = SkWebpEncoder::Encode(&stream, pixmap, options.webp);
+      break;
+    default:
+      break;
+  }
+  return encoded ? stream.detachAsData() : nullptr;
+}
+
+// Shared by the work and the completion of a job. The slot is freed when the
+// encode finishes, or when the job is destroyed if the work never ran.
+struct EncodeQueue::Job {
+  Job(sk_sp<EncodeQueue> queue, sk_sp<SkImage> image, EncodeOptions options, Completion completion)
+      : queue(std::move(queue)), image(std::move(image)), options(std::move(options)), completion(std::move(completion)), submit_ns(now_ns()) {}
+
+  ~Job() { release(); }
+
+  void release() {
+    if (!released.exchange(true, std::memory_order_acq_rel)) {
+      queue->release();
+    }
+  }
+
+  sk_sp<EncodeQueue> queue;
+  sk_sp<SkImage> image;
+  EncodeOptions options;
+  Completion completion;
+  const uint64_t submit_ns;
+  Result result = {};
+  // Set by the work if cancellation was requested while it ran. Read by the
+  // completion, which is scheduled after the work.
+  bool cancelled = false;
+  std::atomic_bool released{false};
+};
+
+EncodeQueue::EncodeQueue(int capacity) : capacity_(std::max(capacity, 1)) {}
+
+bool EncodeQueue::acquire() {
+  int current = in_flight_.load(std::memory_order_relaxed);
+  do {
+    if (current >= capacity_) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++stats_.rejected;
+      return false;
+    }
+  } while (!in_flight_.compare_exchange_weak(current, current + 1, std::memory_order_acq_rel));
+  std::lock_guard<std::mutex> lock(mutex_);
+  ++stats_.submitted;
+  return true;
+}
+
+void EncodeQueue::release() {
+  in_flight_.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+AsyncTask* EncodeQueue::submit(int64_t isolate_handle, sk_sp<SkImage> image, EncodeOptions options, Completion completion) {
+  if (!acquire()) {
+    return nullptr;
+  }
+  // Texture backed images can only be read on their context's thread, so
+  // they are reported as failed encodes.
+  if (image && image->isTextureBacked()) {
+    image.reset();
+  }
+  return start(isolate_handle, std::move(image), std::move(options), std::move(completion));
+}
+
+AsyncTask* EncodeQueue::submit(int64_t isolate_handle, const SkPixmap& pixmap, EncodeOptions options, Completion completion) {
+  if (!acquire()) {
+    return nullptr;
+  }
+  return start(isolate_handle, SkImages::RasterFromPixmapCopy(pixmap), std::move(options), std::move(completion));
+}
+
+AsyncTask* EncodeQueue::start(int64_t isolate_handle, sk_sp<SkImage> image, EncodeOptions options, Completion completion) {
+  auto job = std::make_shared<Job>(sk_ref_sp(this), std::move(image), std::move(options), std::move(completion));
+  AsyncTask::Callback work = [job](AsyncTask& task) {
+    const uint64_t begin_ns = now_ns();
+    job->result.queue_ns = begin_ns - job->submit_ns;
+    if (job->image && !task.cancel_requested()) {
+      SkPixmap pixmap;
+      const sk_sp<SkImage> raster = job->image->peekPixels(&pixmap) ? job->image : job->image->makeRasterImage();
+      if (raster && raster->peekPixels(&pixmap)) {
+        job->result.data = EncodePixmap(pixmap, job->options);
+      }
+    }
+    job->result.encode_ns = now_ns() - begin_ns;
+    // The encoded data may wait a while for the isolate, the source need not.
+    job->image.reset();
+    // A job cancelled while it ran is counted as cancelled by the completion
+    // only, so that every submitted job is counted exactly once.
+    job->cancelled = task.cancel_requested();
+    if (!job->cancelled) {
+      job->queue->record(job->result);
+    }
+    job->release();
+  };
+  AsyncTask::Callback done = [job](AsyncTask& task) {
+    if (task.status() == AsyncTask::Status::kCancelled || job->cancelled) {
+      std::lock_guard<std::mutex> lock(job->queue->mutex_);
+      ++job->queue->stats_.cancelled;
+    }
+    if (job->completion) {
+      job->completion(task, job->result);
+    }
+  };
+  return AsyncTask::submit(isolate_handle, std::move(work), std::move(done));
+}
+
+void EncodeQueue::record(const Result& result) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (result.data) {
+    ++stats_.encoded;
+    stats_.encoded_bytes += result.data->size();
+  } else {
+    ++stats_.failed;
+  }
+  stats_.total_queue_ns += result.queue_ns;
+  stats_.max_queue_ns = std::max(stats_.max_queue_ns, result.queue_ns);
+  stats_.total_encode_ns += result.encode_ns;
+  stats_.max_encode_ns = std::max(stats_.max_encode_ns, result.encode_ns);
+}
+
+EncodeQueue::Stats EncodeQueue::stats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  Stats stats = stats_;
+  stats.in_flight = in_flight();
+  return stats;
+}
+
+void EncodeQueue::reset_stats() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  stats_ = {};
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+
+#include "async_task.h"
+#include "include/codec/SkEncodedImageFormat.h"
+#include "include/core/SkData.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkRefCnt.h"
+#include "include/encode/SkJpegEncoder.h"
+#include "include/encode/SkPngEncoder.h"
+#include "include/encode/SkWebpEncoder.h"
+
+class SkPixmap;
+
+struct EncodeOptions {
+  SkEncodedImageFormat format = SkEncodedImageFormat::kPNG;
+  SkPngEncoder::Options png;
+  // `jpeg.xmpMetadata` points into `xmp_metadata`, which keeps it alive.
+  SkJpegEncoder::Options jpeg;
+  sk_sp<SkData> xmp_metadata;
+  SkWebpEncoder::Options webp;
+};
+
+// Encodes `pixmap` into memory. Returns null if the format is not PNG, JPEG
+// or WebP, or the pixmap cannot be encoded.
+sk_sp<SkData> EncodePixmap(const SkPixmap& pixmap, const EncodeOptions& options);
+
+// Encodes images on the shared worker pool with at most `capacity` encodes in
+// flight, so that a producer that outpaces the encoders is pushed back
+// instead of queueing source images without bound.
+//
+// Jobs keep the queue alive until they are done.
+class EncodeQueue : public SkNVRefCnt<EncodeQueue> {
+ public:
+  struct Result {
+    // Null if encoding failed or the job was cancelled.
+    sk_sp<SkData> data;
+    // Time between submission and the encode starting, and spent encoding.
+    uint64_t queue_ns;
+    uint64_t encode_ns;
+  };
+
+  struct Stats {
+    uint64_t submitted;
+    // Submissions refused because the queue was full.
+    uint64_t rejected;
+    // Every submitted job ends up in exactly one of these three, once its
+    // completion has run. A job cancelled while encoding is only cancelled.
+    uint64_t encoded;
+    uint64_t failed;
+    uint64_t cancelled;
+    int in_flight;
+    size_t encoded_bytes;
+    uint64_t total_queue_ns;
+    uint64_t max_queue_ns;
+    uint64_t total_encode_ns;
+    uint64_t max_encode_ns;
+  };
+
+  // Called on the submitting isolate once the job is done or cancelled.
+  using Completion = std::function<void(AsyncTask& task, Result& result)>;
+
+  explicit EncodeQueue(int capacity);
+
+  int capacity() const { return capacity_; }
+  int in_flight() const { return in_flight_.load(std::memory_order_relaxed); }
+
+  // Starts encoding `image` on the pool and calls `completion` on the isolate
+  // with the given handle. The image is held until the encode has finished;
+  // lazy images are rasterized on the pool thread and texture backed ones
+  // fail. Returns null without doing anything only if the queue is full. A
+  // slot is taken until the encode has finished, not until `completion` runs.
+  AsyncTask* submit(int64_t isolate_handle, sk_sp<SkImage> image, EncodeOptions options, Completion completion);
+  // Like the above, but encodes a copy of `pixmap`, made once a slot is free.
+  AsyncTask* submit(int64_t isolate_handle, const SkPixmap& pixmap, EncodeOptions options, Completion completion);
+
+  Stats stats() const;
+  // Resets the cumulative counters; the number in flight is kept.
+  void reset_stats();
+
+ private:
+  struct Job;
+
+  // Takes a slot, or counts a rejection if none is free.
+  bool acquire();
+  void release();
+  // Runs a job in an acquired slot. A null image fails.
+  AsyncTask* start(int64_t isolate_handle, sk_sp<SkImage> image, EncodeOptions options, Completion completion);
+  void record(const Result& result);
+
+  const int capacity_;
+  std::atomic<int> in_flight_{0};
+
+  mutable std::mutex mutex_;
+  Stats stats_ = {};
+};
@@ -0,0 +1,505 @@
+#include "font_index.h"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <system_error>
+#include <tuple>
+
+#include "include/core/SkFontScanner.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkString.h"
+#include "src/core/SkChecksum.h"
+#include "wrapper/worker_pool.h"
+
+// The stored index is a Header followed by the families, faces and ranges
+// arrays and the string bytes, in native byte order.
+struct FontIndex::Header {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t fingerprint;
+  uint32_t file_count;
+  uint32_t family_count;
+  uint32_t face_count;
+  uint32_t range_count;
+  uint32_t string_bytes;
+  uint32_t reserved;
+};
+
+struct FontIndex::Family {
+  uint32_t name_offset;
+  uint32_t name_length;
+  uint32_t first_face;
+  uint32_t face_count;
+};
+
+struct FontIndex::Face {
+  uint32_t path_offset;
+  uint32_t path_length;
+  uint32_t family;
+  int32_t ttc_index;
+  uint16_t weight;
+  uint16_t width;
+  uint16_t slant;
+  uint16_t reserved;
+  uint32_t first_range;
+  uint32_t range_count;
+};
+
+// An inclusive range of code points.
+struct FontIndex::Range {
+  uint32_t first;
+  uint32_t last;
+};
+
+namespace {
+
+constexpr uint32_t kMagic = SkSetFourByteTag('s', 'k', 'f', 'i');
+constexpr uint32_t kVersion = 1;
+
+struct FontFile {
+  std::string path;
+  uint64_t size;
+  int64_t mtime;
+};
+
+bool is_font_file(const std::filesystem::path& path) {
+  std::string extension = path.extension().string();
+  std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return std::tolower(c); });
+  return extension == ".ttf" || extension == ".otf" || extension == ".ttc" || extension == ".otc";
+}
+
+// Lists the font files below `directories`, sorted by path. Unreadable
+// directories and files are skipped.
+std::vector<FontFile> list_font_files(const std::vector<std::string>& directories) {
+  namespace fs = std::filesystem;
+  std::vector<FontFile> files;
+  for (const std::string& directory : directories) {
+    std::error_code error;
+    fs::recursive_directory_iterator it(directory, fs::directory_options::follow_directory_symlink | fs::directory_options::skip_permission_denied, error);
+    for (; !error && it != fs::recursive_directory_iterator(); it.increment(error)) {
+      const fs::directory_entry& entry = *it;
+      std::error_code entry_error;
+      if (!entry.is_regular_file(entry_error) || !is_font_file(entry.path())) {
+        continue;
+      }
+      const uint64_t size = entry.file_size(entry_error);
+      if (entry_error) {
+        continue;
+      }
+      const fs::file_time_type mtime = entry.last_write_time(entry_error);
+      if (entry_error) {
+        continue;
+      }
+      files.push_back({entry.path().string(), size, static_cast<int64_t>(mtime.time_since_epoch().count())});
+    }
+  }
+  std::sort(files.begin(), files.end(), [](const FontFile& a, const FontFile& b) { return a.path < b.path; });
+  files.erase(std::unique(files.begin(), files.end(), [](const FontFile& a, const FontFile& b) { return a.path == b.path; }), files.end());
+  return files;
+}
+
+uint64_t fingerprint(const std::vector<FontFile>& files) {
+  uint64_t hash = kVersion;
+  for (const FontFile& file : files) {
+    hash = SkChecksum::Hash64(file.path.data(), file.path.size(), hash);
+    hash = SkChecksum::Hash64(&file.size, sizeof(file.size), hash);
+    hash = SkChecksum::Hash64(&file.mtime, sizeof(file.mtime), hash);
+  }
+  return hash;
+}
+
+uint16_t read16(const uint8_t* p) {
+  return static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+uint32_t read32(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+// Appends the code point ranges of the Unicode character map of face
+// `ttc_index` in the sfnt data. Format 4 segments are taken whole, so a range
+// may include a few unmapped code points.
+void read_coverage(const uint8_t* data, size_t size, int ttc_index, std::vector<std::pair<uint32_t, uint32_t>>* ranges) {
+  if (size < 12) {
+    return;
+  }
+  size_t offset = 0;
+  if (read32(data) == SkSetFourByteTag('t', 't', 'c', 'f')) {
+    const uint32_t count = read32(data + 8);
+    if (ttc_index < 0 || static_cast<uint32_t>(ttc_index) >= count || 12 + 4 * static_cast<size_t>(ttc_index) + 4 > size) {
+      return;
+    }
+    offset = read32(data + 12 + 4 * ttc_index);
+  }
+  if (offset > size || size - offset < 12) {
+    return;
+  }
+  const size_t table_count = read16(data + offset + 4);
+  if ((size - offset - 12) / 16 < table_count) {
+    return;
+  }
+  const uint8_t* cmap = nullptr;
+  size_t cmap_size = 0;
+  for (size_t i = 0; i < table_count; ++i) {
+    const uint8_t* record = data + offset + 12 + 16 * i;
+    const uint32_t table_offset = read32(record + 8);
+    const uint32_t table_length = read32(record + 12);
+    if (read32(record) == SkSetFourByteTag('c', 'm', 'a', 'p') && table_offset <= size && table_length <= size - table_offset) {
+      cmap = data + table_offset;
+      cmap_size = table_length;
+      break;
+    }
+  }
+  if (cmap_size < 4) {
+    return;
+  }
+  const size_t subtable_count = read16(cmap + 2);
+  if ((cmap_size - 4) / 8 < subtable_count) {
+    return;
+  }
+  // Prefer a full repertoire format 12 subtable over a BMP only format 4 one.
+  const uint8_t* format4 = nullptr;
+  const uint8_t* format12 = nullptr;
+  size_t format4_size = 0;
+  size_t format12_size = 0;
+  for (size_t i = 0; i < subtable_count; ++i) {
+    const uint8_t* record = cmap + 4 + 8 * i;
+    const uint16_t platform = read16(record);
+    const uint16_t encoding = read16(record + 2);
+    const uint32_t subtable_offset = read32(record + 4);
+    const bool unicode = platform == 0 || (platform == 3 && (encoding == 1 || encoding == 10));
+    if (!unicode || subtable_offset > cmap_size - 2) {
+      continue;
+    }
+    const uint8_t* subtable = cmap + subtable_offset;
+    const uint16_t format = read16(subtable);
+    if (format == 12) {
+      format12 = subtable;
+      format12_size = cmap_size - subtable_offset;
+    } else if (format == 4) {
+      format4 = subtable;
+      format4_size = cmap_size - subtable_offset;
+    }
+  }
+  if (format12 && format12_size >= 16) {
+    const size_t group_count = read32(format12 + 12);
+    if ((format12_size - 16) / 12 < group_count) {
+      return;
+    }
+    for (size_t i = 0; i < group_count; ++i) {
+      const uint8_t* group = format12 + 16 + 12 * i;
+      const uint32_t first = read32(group);
+      const uint32_t last = std::min<uint32_t>(read32(group + 4), 0x10FFFF);
+      if (first <= last) {
+        ranges->emplace_back(first, last);
+      }
+    }
+  } else if (format4 && format4_size >= 16) {
+    const size_t segment_count = read16(format4 + 6) / 2;
+    if ((format4_size - 16) / 4 < segment_count) {
+      return;
+    }
+    for (size_t i = 0; i < segment_count; ++i) {
+      const uint32_t last = read16(format4 + 14 + 2 * i);
+      const uint32_t first = read16(format4 + 16 + 2 * segment_count + 2 * i);
+      // The last segment only maps 0xFFFF to the missing glyph.
+      if (first <= last && first != 0xFFFF) {
+        ranges->emplace_back(first, std::min<uint32_t>(last, 0xFFFE));
+      }
+    }
+  }
+}
+
+struct ScannedFace {
+  uint32_t file;
+  int ttc_index;
+  std::string family;
+  SkFontStyle style;
+  std::vector<std::pair<uint32_t, uint32_t>> ranges;
+};
+
+std::vector<ScannedFace> scan_file(const SkFontScanner& scanner, const FontFile& file, uint32_t file_index) {
+  std::vector<ScannedFace> faces;
+  sk_sp<SkData> data = SkData::MakeFromFileName(file.path.c_str());
+  if (!data) {
+    return faces;
+  }
+  SkMemoryStream stream(data);
+  int face_count = 0;
+  if (!scanner.scanFile(&stream, &face_count)) {
+    return faces;
+  }
+  for (int i = 0; i < face_count; ++i) {
+    SkString family;
+    SkFontStyle style;
+    bool is_fixed_pitch = false;
+    SkFontScanner::AxisDefinitions axes;
+    if (!scanner.scanInstance(&stream, i, 0, &family, &style, &is_fixed_pitch, &axes, nullptr) || family.isEmpty()) {
+      continue;
+    }
+    ScannedFace face{file_index, i, family.c_str(), style, {}};
+    read_coverage(data->bytes(), data->size(), i, &face.ranges);
+    std::sort(face.ranges.begin(), face.ranges.end());
+    // Merge overlapping and adjacent ranges.
+    size_t merged = 0;
+    for (size_t r = 0; r < face.ranges.size(); ++r) {
+      if (merged > 0 && face.ranges[r].first <= face.ranges[merged - 1].second + 1) {
+        face.ranges[merged - 1].second = std::max(face.ranges[merged - 1].second, face.ranges[r].second);
+      } else {
+        face.ranges[merged++] = face.ranges[r];
+      }
+    }
+    face.ranges.resize(merged);
+    faces.push_back(std::move(face));
+  }
+  return faces;
+}
+
+std::string ascii_lower(std::string_view text) {
+  std::string lower(text);
+  std::transform(lower.begin(), lower.end(), lower.begin(), [](unsigned char c) { return std::tolower(c); });
+  return lower;
+}
+
+// Scans every file and serializes the index.
+sk_sp<SkData> build(const std::vector<FontFile>& files, uint64_t fingerprint, const SkFontScanner& scanner) {
+  std::vector<std::vector<ScannedFace>> scanned(files.size());
+  WorkerPool::shared().parallel_for(files.size(), 0, [&](size_t i) {
+    scanned[i] = scan_file(scanner, files[i], static_cast<uint32_t>(i));
+  });
+
+  // Group the faces by family name, ignoring ASCII case.
+  std::map<std::string, std::vector<ScannedFace*>> families;
+  for (std::vector<ScannedFace>& file_faces : scanned) {
+    for (ScannedFace& face : file_faces) {
+      families[ascii_lower(face.family)].push_back(&face);
+    }
+  }
+
+  std::string strings;
+  std::vector<uint32_t> path_offsets(files.size(), UINT32_MAX);
+  auto add_string = [&](std::string_view text) {
+    const uint32_t offset = static_cast<uint32_t>(strings.size());
+    strings.append(text);
+    return offset;
+  };
+
+  std::vector<FontIndex::Family> family_records;
+  std::vector<FontIndex::Face> face_records;
+  std::vector<FontIndex::Range> range_records;
+  for (auto& [key, faces] : families) {
+    std::sort(faces.begin(), faces.end(), [](const ScannedFace* a, const ScannedFace* b) {
+      const SkFontStyle& x = a->style;
+      const SkFontStyle& y = b->style;
+      return std::make_tuple(x.weight(), x.width(), x.slant(), a->file, a->ttc_index) < std::make_tuple(y.weight(), y.width(), y.slant(), b->file, b->ttc_index);
+    });
+    const std::string& name = faces.front()->family;
+    const uint32_t family = static_cast<uint32_t>(family_records.size());
+    family_records.push_back({add_string(name), static_cast<uint32_t>(name.size()), static_cast<uint32_t>(face_records.size()), static_cast<uint32_t>(faces.size())});
+    for (const ScannedFace* face : faces) {
+      const std::string& path = files[face->file].path;
+      if (path_offsets[face->file] == UINT32_MAX) {
+        path_offsets[face->file] = add_string(path);
+      }
+      face_records.push_back({
+          path_offsets[face->file],
+          static_cast<uint32_t>(path.size()),
+          family,
+          face->ttc_index,
+          static_cast<uint16_t>(face->style.weight()),
+          static_cast<uint16_t>(face->style.width()),
+          static_cast<uint16_t>(face->style.slant()),
+          0,
+          static_cast<uint32_t>(range_records.size()),
+          static_cast<uint32_t>(face->ranges.size()),
+      });
+      for (const auto& [first, last] : face->ranges) {
+        range_records.push_back({first, last});
+      }
+    }
+  }
+
+  FontIndex::Header header{};
+  header.magic = kMagic;
+  header.version = kVersion;
+  header.fingerprint = fingerprint;
+  header.file_count = static_cast<uint32_t>(files.size());
+  header.family_count = static_cast<uint32_t>(family_records.size());
+  header.face_count = static_cast<uint32_t>(face_records.size());
+  header.range_count = static_cast<uint32_t>(range_records.size());
+  header.string_bytes = static_cast<uint32_t>(strings.size());
+
+  SkDynamicMemoryWStream stream;
+  stream.write(&header, sizeof(header));
+  stream.write(family_records.data(), family_records.size() * sizeof(FontIndex::Family));
+  stream.write(face_records.data(), face_records.size() * sizeof(FontIndex::Face));
+  stream.write(range_records.data(), range_records.size() * sizeof(FontIndex::Range));
+  stream.write(strings.data(), strings.size());
+  return stream.detachAsData();
+}
+
+// Writes the index next to `path` and renames it into place, so that a
+// concurrent reader never sees a partially written index.
+void store(const SkData& data, const char* path) {
+  const std::string temp_path = std::string(path) + ".tmp";
+  {
+    SkFILEWStream stream(temp_path.c_str());
+    if (!stream.isValid() || !stream.write(data.data(), data.size())) {
+      return;
+    }
+  }
+  if (std::rename(temp_path.c_str(), path) != 0) {
+    std::remove(temp_path.c_str());
+  }
+}
+
+}  // namespace
+
+FontIndex::FontIndex(sk_sp<SkData> data) : data_(std::move(data)) {
+  const uint8_t* bytes = data_->bytes();
+  header_ = reinterpret_cast<const Header*>(bytes);
+  families_ = reinterpret_cast<const Family*>(bytes + sizeof(Header));
+  faces_ = reinterpret_cast<const Face*>(families_ + header_->family_count);
+  ranges_ = reinterpret_cast<const Range*>(faces_ + header_->face_count);
+  strings_ = reinterpret_cast<const char*>(ranges_ + header_->range_count);
+}
+
+FontIndex::~FontIndex() = default;
+
+std::unique_ptr<FontIndex> FontIndex::Load(sk_sp<SkData> data, uint64_t fingerprint) {
+  if (!data || data->size() < sizeof(Header)) {
+    return nullptr;
+  }
+  Header header;
+  std::memcpy(&header, data->data(), sizeof(header));
+  if (header.magic != kMagic || header.version != kVersion || header.fingerprint != fingerprint) {
+    return nullptr;
+  }
+  const uint64_t expected_size = sizeof(Header) + uint64_t{header.family_count} * sizeof(Family) + uint64_t{header.face_count} * sizeof(Face) + uint64_t{header.range_count} * sizeof(Range) + header.string_bytes;
+  if (expected_size != data->size()) {
+    return nullptr;
+  }
+
+  // Check every offset once so that lookups need no bounds checks.
+  std::unique_ptr<FontIndex> index(new FontIndex(std::move(data)));
+  auto in_strings = [&](uint32_t offset, uint32_t length) { return offset <= header.string_bytes && length <= header.string_bytes - offset; };
+  for (uint32_t i = 0; i < header.family_count; ++i) {
+    const Family& family = index->families_[i];
+    if (!in_strings(family.name_offset, family.name_length) || family.first_face > header.face_count || family.face_count > header.face_count - family.first_face) {
+      return nullptr;
+    }
+  }
+  for (uint32_t i = 0; i < header.face_count; ++i) {
+    const Face& face = index->faces_[i];
+    if (!in_strings(face.path_offset, face.path_length) || face.family >= header.family_count || face.first_range > header.range_count || face.range_count > header.range_count - face.first_range) {
+      return nullptr;
+    }
+  }
+  return index;
+}
+
+std::unique_ptr<FontIndex> FontIndex::Make(const std::vector<std::string>& directories, const char* index_path, const SkFontScanner& scanner, Info* info) {
+  const auto start = std::chrono::steady_clock::now();
+  const std::vector<FontFile> files = list_font_files(directories);
+  const uint64_t hash = fingerprint(files);
+
+  std::unique_ptr<FontIndex> index;
+  if (index_path) {
+    index = Load(SkData::MakeFromFileName(index_path), hash);
+  }
+  const bool rebuilt = !index;
+  if (rebuilt) {
+    sk_sp<SkData> data = build(files, hash, scanner);
+    if (index_path) {
+      store(*data, index_path);
+    }
+    index = Load(std::move(data), hash);
+  }
+
+  if (info && index) {
+    info->files = index->header_->file_count;
+    info->faces = index->header_->face_count;
+    info->families = index->header_->family_count;
+    info->rebuilt = rebuilt;
+    info->nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  }
+  return index;
+}
+
+int FontIndex::family_count() const {
+  return static_cast<int>(header_->family_count);
+}
+
+std::string_view FontIndex::family_name(int family) const {
+  return {strings_ + families_[family].name_offset, families_[family].name_length};
+}
+
+int FontIndex::find_family(const char* name) const {
+  if (!name) {
+    return -1;
+  }
+  // Families are sorted by their lower case names.
+  const std::string key = ascii_lower(name);
+  const Family* end = families_ + header_->family_count;
+  const Family* it = std::lower_bound(families_, end, key, [this](const Family& family, const std::string& key) {
+    const std::string_view name(strings_ + family.name_offset, family.name_length);
+    return ascii_lower(name) < key;
+  });
+  if (it == end || ascii_lower({strings_ + it->name_offset, it->name_length}) != key) {
+    return -1;
+  }
+  return static_cast<int>(it - families_);
+}
+
+int FontIndex::family_first_face(int family) const {
+  return static_cast<int>(families_[family].first_face);
+}
+
+int FontIndex::family_face_count(int family) const {
+  return static_cast<int>(families_[family].face_count);
+}
+
+int FontIndex::face_count() const {
+  return static_cast<int>(header_->face_count);
+}
+
+int FontIndex::face_family(int face) const {
+  return static_cast<int>(faces_[face].family);
+}
+
+std::string FontIndex::face_path(int face) const {
+  return {strings_ + faces_[face].path_offset, faces_[face].path_length};
+}
+
+int FontIndex::face_ttc_index(int face) const {
+  return faces_[face].ttc_index;
+}
+
+SkFontStyle FontIndex::face_style(int face) const {
+  const Face& record = faces_[face];
+  return SkFontStyle(record.weight, record.width, static_cast<SkFontStyle::Slant>(record.slant));
+}
+
+bool FontIndex::face_covers(int face, SkUnichar character) const {
+  const Face& record = faces_[face];
+  const Range* begin = ranges_ + record.first_range;
+  const Range* end = begin + record.range_count;
+  const uint32_t c = static_cast<uint32_t>(character);
+  const Range* it = std::upper_bound(begin, end, c, [](uint32_t c, const Range& range) { return c < range.first; });
+  return it != begin && c <= (it - 1)->last;
+}
+
+bool FontIndex::face_covers_any(int face, uint32_t first, uint32_t last) const {
+  const Face& record = faces_[face];
+  const Range* begin = ranges_ + record.first_range;
+  const Range* end = begin + record.range_count;
+  // The last range starting at or before `last` is the only one that can
+  // reach back to `first`, since the ranges are sorted and disjoint.
+  const Range* it = std::upper_bound(begin, end, last, [](uint32_t c, const Range& range) { return c < range.first; });
+  return it != begin && (it - 1)->last >= first;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "include/core/SkData.h"
+#include "include/core/SkFontStyle.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTypes.h"
+
+class SkFontScanner;
+
+// A compact index of the font files below a set of directories, recording the
+// family, style, code point coverage, path and collection index of every face.
+//
+// The index is stored in a file and memory mapped on later runs, so starting
+// up only has to list the font files instead of opening and parsing each of
+// them. It is rebuilt whenever a font file is added or removed, or its size or
+// modification time changes. Only the default instance of variable fonts is
+// indexed, and style names are not recorded.
+class FontIndex {
+ public:
+  struct Info {
+    uint32_t files;
+    uint32_t faces;
+    uint32_t families;
+    // Whether the stored index was missing or out of date and was rebuilt.
+    bool rebuilt;
+    uint64_t nanos;
+  };
+
+  // Loads the index stored at `index_path` if it still matches the font files
+  // in `directories`, otherwise scans the files with `scanner` and stores the
+  // new index there. A null `index_path` always scans and stores nothing.
+  // Failing to store the index is not an error.
+  static std::unique_ptr<FontIndex> Make(const std::vector<std::string>& directories, const char* index_path, const SkFontScanner& scanner, Info* info);
+
+  ~FontIndex();
+
+  FontIndex(const FontIndex&) = delete;
+  FontIndex& operator=(const FontIndex&) = delete;
+
+  int family_count() const;
+  std::string_view family_name(int family) const;
+  // Returns the family named `name`, ignoring ASCII case, or -1.
+  int find_family(const char* name) const;
+  // The faces of a family are consecutive, ordered by weight, width and slant.
+  int family_first_face(int family) const;
+  int family_face_count(int family) const;
+
+  int face_count() const;
+  int face_family(int face) const;
+  std::string face_path(int face) const;
+  int face_ttc_index(int face) const;
+  SkFontStyle face_style(int face) const;
+  // Whether the face's character map includes `character`. The face may still
+  // map it to the missing glyph.
+  bool face_covers(int face, SkUnichar character) const;
+  // Whether the face's character map includes any of the code points from
+  // `first` to `last` inclusive.
+  bool face_covers_any(int face, uint32_t first, uint32_t last) const;
+
+  // Records of the stored index, defined in font_index.cpp.
+  struct Header;
+  struct Family;
+  struct Face;
+  struct Range;
+
+ private:
+  explicit FontIndex(sk_sp<SkData> data);
+
+  // Returns the index in `data` if it is well formed and was built for
+  // `fingerprint`, otherwise null.
+  static std::unique_ptr<FontIndex> Load(sk_sp<SkData> data, uint64_t fingerprint);
+
+  sk_sp<SkData> data_;
+  const Header* header_;
+  const Family* families_;
+  const Face* faces_;
+  const Range* ranges_;
+  const char* strings_;
+};
@@ -0,0 +1,72 @@
+#include "font_prewarm.h"
+
+#include <chrono>
+#include <vector>
+
+#include "include/core/SkSurfaceProps.h"
+#include "src/core/SkGlyph.h"
+#include "src/core/SkScalerContext.h"
+#include "src/core/SkStrike.h"
+#include "src/core/SkStrikeSpec.h"
+
+namespace {
+
+// The subpixel offsets, in SkFixed, that drawing may pack into a glyph id
+// along one axis: just zero, or every quarter pixel.
+std::vector<SkFixed> subpixel_offsets(bool subpixel) {
+  if (!subpixel) {
+    return {0};
+  }
+  std::vector<SkFixed> offsets;
+  constexpr int kCount = 1 << SkPackedGlyphID::kSubPixelPosLen;
+  for (int i = 0; i < kCount; ++i) {
+    offsets.push_back(i * (SK_Fixed1 / kCount));
+  }
+  return offsets;
+}
+
+}  // namespace
+
+FontPrewarmResult PrewarmGlyphs(const SkFont& font, SkSpan<const SkGlyphID> glyphs, const SkMatrix& matrix, const SkPaint& paint) {
+  const auto start = std::chrono::steady_clock::now();
+  FontPrewarmResult result{0, 0, 0};
+  if (!glyphs.empty()) {
+    const SkSurfaceProps props;
+    const SkScalerContextFlags flags = SkScalerContextFlags::kFakeGammaAndBoostContrast;
+    if (SkStrikeSpec::ShouldDrawAsPath(paint, font, matrix)) {
+      SkBulkGlyphMetricsAndPaths paths{SkStrikeSpec::MakePath(font, paint, props, flags)};
+      for (const SkGlyph* glyph : paths.glyphs(glyphs)) {
+        if (glyph->path() != nullptr) {
+          ++result.paths;
+        }
+      }
+    } else {
+      const SkStrikeSpec spec = SkStrikeSpec::MakeMask(font, paint, props, flags, matrix);
+      // Subpixel positioned glyphs are drawn from one image per subpixel
+      // offset along the axis the strike rounds positions on, or along both
+      // when the matrix does not align glyphs to either.
+      const SkGlyphPositionRoundingSpec& rounding = spec.findOrCreateStrike()->roundingSpec();
+      const bool subpixel_x = rounding.isSubpixel && rounding.axisAlignment != SkAxisAlignment::kY;
+      const bool subpixel_y = rounding.isSubpixel && rounding.axisAlignment != SkAxisAlignment::kX;
+      const std::vector<SkFixed> x_offsets = subpixel_offsets(subpixel_x);
+      const std::vector<SkFixed> y_offsets = subpixel_offsets(subpixel_y);
+      std::vector<SkPackedGlyphID> ids;
+      ids.reserve(glyphs.size() * x_offsets.size() * y_offsets.size());
+      for (SkGlyphID glyph : glyphs) {
+        for (SkFixed y : y_offsets) {
+          for (SkFixed x : x_offsets) {
+            ids.emplace_back(glyph, x, y);
+          }
+        }
+      }
+      SkBulkGlyphMetricsAndImages images{spec};
+      for (const SkGlyph* glyph : images.glyphs(ids)) {
+        if (glyph->image() != nullptr) {
+          ++result.images;
+        }
+      }
+    }
+  }
+  result.nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+  return result;
+}
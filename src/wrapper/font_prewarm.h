@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "include/core/SkFont.h"
+#include "include/core/SkMatrix.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkSpan.h"
+
+struct FontPrewarmResult {
+  // Glyph images and paths now in the strike cache. A subpixel positioned
+  // glyph has an image for each subpixel offset.
+  uint32_t images;
+  uint32_t paths;
+  uint64_t nanos;
+};
+
+// Fills the global strike cache with the glyphs that drawing `glyphs` with
+// `font` and `paint` under `matrix` would look up, so the first draw does not
+// have to rasterize them, including every subpixel offset of subpixel
+// positioned fonts. Like a raster draw with default surface props,
+// glyphs too large for the cache are prepared as paths instead of images.
+// Safe to call from any thread.
+FontPrewarmResult PrewarmGlyphs(const SkFont& font, SkSpan<const SkGlyphID> glyphs, const SkMatrix& matrix, const SkPaint& paint);
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// Runs `work` on the shared worker pool, then calls `completion` on the
+// isolate with the given handle through its run loop. `work` may be NULL.
+// The completion is called for cancelled tasks as well, so it can release
+// `context`; it is not called if the isolate has shut down in the meantime.
+// The returned task must be released with sk_async_task_unref.
+SK_C_API sk_async_task_t* sk_async_submit(int64_t isolate_handle, sk_async_work_proc work, sk_async_completion_proc completion, void* context);
+// Returns true if the work had not started and will not run.
+SK_C_API bool sk_async_cancel(sk_async_task_t* task);
+// Lets running work stop early after sk_async_cancel.
+SK_C_API bool sk_async_is_cancel_requested(const sk_async_task_t* task);
+SK_C_API sk_async_status_t sk_async_get_status(const sk_async_task_t* task);
+SK_C_API void sk_async_task_unref(sk_async_task_t* task);
+
+SK_C_API int sk_async_get_thread_count(void);
+SK_C_API void sk_async_get_stats(sk_async_stats_t* stats);
+// Resets the cumulative counters; queue depth and running count are kept.
+SK_C_API void sk_async_reset_stats(void);
+
+SK_C_PLUS_PLUS_END_GUARD
@@ -86,6 +86,12 @@ SK_C_API void sk_overdraw_canvas_destroy(sk_overdraw_canvas_t* canvas);
 SK_C_API gr_recording_context_t* sk_canvas_get_recording_context(sk_canvas_t* canvas);
 SK_C_API sk_surface_t* sk_canvas_get_surface(sk_canvas_t* canvas);
 
+// Decodes and executes a stream of sk_canvas_command_t commands (see sk_types.h
+// for the encoding). Objects referenced by the stream are looked up in
+// `objects`. Returns false if the stream is malformed; commands preceding the
+// malformed one have already been executed.
+SK_C_API bool sk_canvas_execute_commands(sk_canvas_t* ccanvas, const uint8_t* ops, size_t length, const void* const objects[], size_t object_count);
+
 SK_C_PLUS_PLUS_END_GUARD
 
 #endif
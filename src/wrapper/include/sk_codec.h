@@ -40,6 +40,12 @@ SK_C_API int sk_codec_get_repetition_count(sk_codec_t* codec);
 
 SK_C_API sk_image_t* sk_codecs_deferred_image(sk_codec_t* codec, const sk_alphatype_t* alphaType);
 
+// Decodes `count` encoded images concurrently on the shared worker pool, using
+// at most `max_threads` threads including the caller (<= 0 means no limit).
+// When the requested size is smaller than the encoded one, the codec decodes
+// at the smallest natively supported size that still covers it.
+SK_C_API void sk_codec_decode_batch(const sk_codec_decode_request_t requests[], sk_codec_decode_result_t results[], size_t count, int max_threads);
+
 SK_C_PLUS_PLUS_END_GUARD
 
 #endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// A cache of decoded raster images keyed by the encoded bytes and the
+// requested size, color type and color space, with LRU eviction once
+// `byte_budget` is exceeded.
+SK_C_API sk_decoded_image_cache_t* sk_decoded_image_cache_new(size_t byte_budget);
+SK_C_API void sk_decoded_image_cache_delete(sk_decoded_image_cache_t* cache);
+// Returns a raster image of `data` decoded at width x height (a zero dimension
+// follows the aspect ratio; both zero keeps the encoded size), or NULL if the
+// data cannot be decoded. UNKNOWN_SK_COLORTYPE and a NULL color space keep
+// what the codec suggests. The caller owns a reference to the image.
+SK_C_API sk_image_t* sk_decoded_image_cache_get(sk_decoded_image_cache_t* cache, const sk_data_t* data, int width, int height, sk_colortype_t color_type, const sk_colorspace_t* color_space);
+SK_C_API size_t sk_decoded_image_cache_get_budget(const sk_decoded_image_cache_t* cache);
+SK_C_API void sk_decoded_image_cache_set_budget(sk_decoded_image_cache_t* cache, size_t byte_budget);
+SK_C_API void sk_decoded_image_cache_purge(sk_decoded_image_cache_t* cache);
+SK_C_API void sk_decoded_image_cache_get_stats(const sk_decoded_image_cache_t* cache, sk_decoded_image_cache_stats_t* stats);
+SK_C_API void sk_decoded_image_cache_reset_stats(sk_decoded_image_cache_t* cache);
+
+SK_C_PLUS_PLUS_END_GUARD
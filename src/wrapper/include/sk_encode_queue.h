@@ -0,0 +1,32 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// Encodes images on the shared worker pool instead of the calling isolate,
+// with at most `capacity` encodes in flight. Deleting the queue is safe while
+// encodes are in flight; they keep it alive until they are done.
+SK_C_API sk_encode_queue_t* sk_encode_queue_new(int capacity);
+SK_C_API void sk_encode_queue_delete(sk_encode_queue_t* queue);
+SK_C_API int sk_encode_queue_get_capacity(const sk_encode_queue_t* queue);
+SK_C_API int sk_encode_queue_get_in_flight(const sk_encode_queue_t* queue);
+
+// Refs `image` and encodes it on a pool thread, then fills `result` and calls
+// `completion` on the isolate with the given handle through its run loop.
+// `result` must stay valid until then. Returns NULL without doing anything
+// only if the queue is full, in which case the caller should wait for an
+// earlier encode to complete. Lazy images are rasterized on the pool thread;
+// texture backed images fail. The caller owns the returned task and releases
+// it with sk_async_task_unref.
+SK_C_API sk_async_task_t* sk_encode_queue_encode_image_async(int64_t isolate_handle, sk_encode_queue_t* queue, const sk_image_t* image, const sk_encode_options_t* options, sk_encode_result_t* result, sk_async_completion_proc completion, void* context);
+// Like sk_encode_queue_encode_image_async, but encodes a copy of the pixels
+// of `pixmap`, made once a slot is free, so they may change as soon as this
+// returns.
+SK_C_API sk_async_task_t* sk_encode_queue_encode_pixmap_async(int64_t isolate_handle, sk_encode_queue_t* queue, const sk_pixmap_t* pixmap, const sk_encode_options_t* options, sk_encode_result_t* result, sk_async_completion_proc completion, void* context);
+
+SK_C_API void sk_encode_queue_get_stats(const sk_encode_queue_t* queue, sk_encode_queue_stats_t* stats);
+// Resets the cumulative counters; the number in flight is kept.
+SK_C_API void sk_encode_queue_reset_stats(sk_encode_queue_t* queue);
+
+SK_C_PLUS_PLUS_END_GUARD
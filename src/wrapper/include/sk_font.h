@@ -59,6 +59,40 @@ SK_C_API sk_font_t* sk_font_make_with_size(const sk_font_t* font, float size);
 SK_C_API bool sk_font_equals(const sk_font_t* font, const sk_font_t* other);
 SK_C_API size_t sk_font_get_intercepts(const sk_font_t* font, const uint16_t glyphs[], int glyphCount, const sk_point_t pos[], float top, float bottom, const sk_paint_t* paint, float intervals[]);
 
+// Glyph prewarming
+
+typedef struct {
+  const sk_font_t* fFont;
+  const uint16_t* fGlyphs;
+  size_t fGlyphCount;
+  // NULL for the identity matrix.
+  const sk_matrix_t* fMatrix;
+  // NULL for a default paint.
+  const sk_paint_t* fPaint;
+} sk_font_prewarm_request_t;
+
+typedef struct {
+  // Glyph images and paths now in the strike cache. A subpixel positioned
+  // glyph has an image for each subpixel offset.
+  uint32_t fImageCount;
+  uint32_t fPathCount;
+  uint64_t fNanos;
+} sk_font_prewarm_result_t;
+
+// Rasterizes the glyph images, or the paths of glyphs too large to cache as
+// images, that drawing `glyphs` with `font` and `paint` under `matrix` would
+// need, so the first frame using them does not have to. `matrix` and `paint`
+// may be NULL.
+SK_C_API void sk_font_prewarm_glyphs(const sk_font_t* font, const uint16_t glyphs[], size_t count, const sk_matrix_t* matrix, const sk_paint_t* paint, sk_font_prewarm_result_t* result);
+// Prewarms `count` requests concurrently on the shared worker pool, using at
+// most `max_threads` threads including the caller (<= 0 means no limit).
+SK_C_API void sk_font_prewarm_glyphs_batch(const sk_font_prewarm_request_t requests[], sk_font_prewarm_result_t results[], size_t count, int max_threads);
+// Like sk_font_prewarm_glyphs_batch, but runs on a worker thread and calls
+// `completion` on the isolate's run loop when done. The requests are copied;
+// `results` must stay valid until `completion` has been called. The caller
+// owns the returned task and releases it with sk_async_task_unref.
+SK_C_API sk_async_task_t* sk_font_prewarm_glyphs_async(int64_t isolate_handle, const sk_font_prewarm_request_t requests[], size_t count, sk_font_prewarm_result_t results[], sk_async_completion_proc completion, void* context);
+
 // sk_text_utils
 
 SK_C_API void sk_text_utils_get_path(const void* text, size_t length, sk_text_encoding_t encoding, float x, float y, const sk_font_t* font, sk_path_t* path);
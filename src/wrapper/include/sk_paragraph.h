@@ -210,6 +210,12 @@ SK_C_API float sk_paragraph_get_longest_line(sk_paragraph_t* paragraph);
 SK_C_API bool sk_paragraph_did_exceed_max_lines(sk_paragraph_t* paragraph);
 
 SK_C_API void sk_paragraph_layout(sk_paragraph_t* paragraph, float width);
+// Lays out paragraphs[i] at widths[i] for every i, concurrently on the shared
+// worker pool using at most `max_threads` threads including the calling one
+// (zero or less means all). The result is the same as calling
+// sk_paragraph_layout on each in turn. The paragraphs must be distinct and
+// not used elsewhere until this returns; they may share font collections.
+SK_C_API void sk_paragraph_layout_batch(sk_paragraph_t* paragraphs[], const float widths[], size_t count, int max_threads);
 SK_C_API void sk_paragraph_paint(sk_paragraph_t* paragraph, sk_canvas_t* canvas, float x, float y);
 SK_C_API void sk_paragraph_paint_with_painter(sk_paragraph_t* paragraph, sk_paragraph_painter_t* painter, float x, float y);
 
@@ -217,10 +223,25 @@ SK_C_API size_t sk_paragraph_get_rects_for_range(sk_paragraph_t* paragraph, unsi
 SK_C_API size_t sk_paragraph_get_rects_for_placeholders(sk_paragraph_t* paragraph, sk_paragraph_text_box_t boxes[]);
 
 SK_C_API sk_paragraph_position_with_affinity_t sk_paragraph_get_glyph_position_at_coordinate(sk_paragraph_t* paragraph, float dx, float dy);
+// Resolves points[i] as sk_paragraph_get_glyph_position_at_coordinate would
+// into positions[i] for every i.
+SK_C_API void sk_paragraph_get_glyph_positions_at_coordinates(sk_paragraph_t* paragraph, const sk_point_t points[], size_t count, sk_paragraph_position_with_affinity_t positions[]);
+// When enabled, sk_paragraph_get_glyph_position_at_coordinate(s) and
+// sk_paragraph_get_closest_glyph_cluster_at binary search an index of the
+// drawn glyph clusters, built on the first query after each layout, instead
+// of walking every line. Trailing whitespace at soft line breaks and
+// placeholders are not hit targets in the index, and the cluster bounds it
+// reports span the height of the line. Disabled by default.
+SK_C_API void sk_paragraph_set_hit_test_index_enabled(sk_paragraph_t* paragraph, bool enabled);
+SK_C_API bool sk_paragraph_is_hit_test_index_enabled(const sk_paragraph_t* paragraph);
 SK_C_API sk_paragraph_text_range_t sk_paragraph_get_word_boundary(sk_paragraph_t* paragraph, unsigned offset);
 
 SK_C_API size_t sk_paragraph_get_line_metrics_count(sk_paragraph_t* paragraph);
 SK_C_API bool sk_paragraph_get_line_metrics_by_index(sk_paragraph_t* paragraph, size_t index, sk_line_metrics_t* line_metrics);
+// Total number of style runs over all lines.
+SK_C_API size_t sk_paragraph_get_style_metrics_count(sk_paragraph_t* paragraph);
+// Writes the metrics of every line into `buffer` in one call.
+SK_C_API void sk_paragraph_get_all_line_metrics(sk_paragraph_t* paragraph, const sk_paragraph_line_metrics_buffer_t* buffer);
 
 SK_C_API size_t sk_paragraph_get_line_number(sk_paragraph_t* paragraph);
 SK_C_API void sk_paragraph_mark_dirty(sk_paragraph_t* paragraph);
@@ -277,6 +298,9 @@ SK_C_API bool sk_font_collection_font_fallback_enabled(sk_font_collection_t* col
 SK_C_API void sk_font_collection_clear_caches(sk_font_collection_t* collection);
 
 SK_C_API sk_paragraph_builder_t* sk_paragraph_builder_make(const sk_paragraph_style_t* style, sk_font_collection_t* font_collection, sk_unicode_t* unicode);
+// Like sk_paragraph_builder_make, but the builder also keeps a copy of every
+// call, which sk_paragraph_layout_cache_build and sk_paragraph_editor_new need.
+SK_C_API sk_paragraph_builder_t* sk_paragraph_builder_make_recording(const sk_paragraph_style_t* style, sk_font_collection_t* font_collection, sk_unicode_t* unicode);
 SK_C_API void sk_paragraph_builder_delete(sk_paragraph_builder_t* builder);
 
 SK_C_API void sk_paragraph_builder_push_style(sk_paragraph_builder_t* builder, const sk_text_style_t* style);
@@ -285,6 +309,13 @@ SK_C_API void sk_paragraph_builder_peek_style(sk_paragraph_builder_t* builder, s
 
 SK_C_API void sk_paragraph_builder_add_text_len(sk_paragraph_builder_t* builder, const char* text, size_t len);
 SK_C_API void sk_paragraph_builder_add_placeholder(sk_paragraph_builder_t* builder, const sk_paragraph_placeholder_style_t* placeholder_style);
+// Adds `run_count` runs in one call. Text runs take consecutive slices of the
+// UTF-8 `text`, whose length must equal the sum of their lengths. Each run is
+// styled with styles[style_index]; the styles are copied only when the style
+// changes between consecutive runs, so a style shared by many runs should be
+// passed once and referenced by index. Returns false without changing the
+// builder if an index is out of range or the lengths do not add up.
+SK_C_API bool sk_paragraph_builder_add_runs(sk_paragraph_builder_t* builder, const sk_text_style_t* const styles[], size_t style_count, const sk_paragraph_placeholder_style_t placeholders[], size_t placeholder_count, const sk_paragraph_text_run_t runs[], size_t run_count, const char* text, size_t length);
 
 SK_C_API sk_paragraph_t* sk_paragraph_builder_build(sk_paragraph_builder_t* builder);
 
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// Styled text that is edited in place and laid out incrementally. The text is
+// split at hard line breaks into blocks that are shaped and laid out as
+// separate paragraphs, so an edit only reshapes the blocks it touches. The
+// paragraph style's max lines, ellipsis and text height behavior apply to each
+// block.
+//
+// All text offsets are in UTF-8 code units; a placeholder occupies the three
+// code units of U+FFFC.
+
+// Starts from the contents of `builder`, which is left unchanged. Returns NULL
+// unless the builder was made with sk_paragraph_builder_make_recording.
+SK_C_API sk_paragraph_editor_t* sk_paragraph_editor_new(const sk_paragraph_builder_t* builder);
+SK_C_API void sk_paragraph_editor_delete(sk_paragraph_editor_t* editor);
+// The text stays valid until the next edit.
+SK_C_API void sk_paragraph_editor_get_text(const sk_paragraph_editor_t* editor, const char** text, size_t* length);
+// Replaces [start, end) with `length` bytes of UTF-8 `text`, which takes the
+// style of the text before `start`. Returns false without changing anything if
+// the range is out of bounds or splits a code point or placeholder.
+SK_C_API bool sk_paragraph_editor_replace(sk_paragraph_editor_t* editor, size_t start, size_t end, const char* text, size_t length);
+// Lays out the blocks edited since the last layout, or all blocks if `width`
+// changed, and returns how many were laid out.
+SK_C_API size_t sk_paragraph_editor_layout(sk_paragraph_editor_t* editor, float width);
+SK_C_API float sk_paragraph_editor_get_height(const sk_paragraph_editor_t* editor);
+SK_C_API float sk_paragraph_editor_get_longest_line(const sk_paragraph_editor_t* editor);
+SK_C_API size_t sk_paragraph_editor_get_line_count(const sk_paragraph_editor_t* editor);
+SK_C_API void sk_paragraph_editor_paint(sk_paragraph_editor_t* editor, sk_canvas_t* canvas, float x, float y);
+SK_C_API sk_paragraph_position_with_affinity_t sk_paragraph_editor_get_glyph_position_at_coordinate(sk_paragraph_editor_t* editor, float dx, float dy);
+// Call with `boxes` set to NULL to get the count.
+SK_C_API size_t sk_paragraph_editor_get_rects_for_range(sk_paragraph_editor_t* editor, size_t start, size_t end, sk_paragraph_rect_height_style_t rect_height_style, sk_paragraph_rect_width_style_t rect_width_style, sk_paragraph_text_box_t boxes[]);
+
+SK_C_PLUS_PLUS_END_GUARD
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// A cache of laid out paragraphs keyed by the builder contents (text, style
+// runs, placeholders, paragraph style, font collection and unicode) and the
+// layout width, with LRU eviction once the estimated `byte_budget` is
+// exceeded. Entries shaped with a font collection are dropped by
+// sk_font_collection_clear_caches.
+SK_C_API sk_paragraph_layout_cache_t* sk_paragraph_layout_cache_new(size_t byte_budget);
+SK_C_API void sk_paragraph_layout_cache_delete(sk_paragraph_layout_cache_t* cache);
+// Returns the paragraph `builder` would build, laid out at `width`. On a hit
+// the paragraph shares the cached layout instead of being shaped again; it
+// stops sharing once it is laid out at another width or marked dirty. The
+// builder is left unchanged. Release the paragraph with sk_paragraph_delete.
+// Paragraphs from one cache must not be used concurrently. Returns NULL unless
+// the builder was made with sk_paragraph_builder_make_recording.
+SK_C_API sk_paragraph_t* sk_paragraph_layout_cache_build(sk_paragraph_layout_cache_t* cache, const sk_paragraph_builder_t* builder, float width);
+SK_C_API size_t sk_paragraph_layout_cache_get_budget(const sk_paragraph_layout_cache_t* cache);
+SK_C_API void sk_paragraph_layout_cache_set_budget(sk_paragraph_layout_cache_t* cache, size_t byte_budget);
+SK_C_API void sk_paragraph_layout_cache_purge(sk_paragraph_layout_cache_t* cache);
+SK_C_API void sk_paragraph_layout_cache_get_stats(const sk_paragraph_layout_cache_t* cache, sk_paragraph_layout_cache_stats_t* stats);
+SK_C_API void sk_paragraph_layout_cache_reset_stats(sk_paragraph_layout_cache_t* cache);
+
+SK_C_PLUS_PLUS_END_GUARD
@@ -42,6 +42,24 @@ SK_C_API void sk_picture_playback(const sk_picture_t* picture, sk_canvas_t* canv
 SK_C_API int sk_picture_approximate_op_count(const sk_picture_t* picture, bool nested);
 SK_C_API size_t sk_picture_approximate_bytes_used(const sk_picture_t* picture);
 
+// Plays the picture back into `pixmap`, split into tile_width x tile_height
+// tiles that are rasterized concurrently on up to max_threads threads
+// (max_threads <= 0 uses all available workers). Each tile is drawn with the
+// full pixmap as its device and the tile as its clip, so the result matches
+// sk_picture_playback() on a single raster canvas pixel for pixel. Pictures
+// recorded with an sk_rtree_factory_t only replay the ops that intersect each
+// tile. `matrix` may be null. Returns false if the pixmap cannot be drawn to.
+SK_C_API bool sk_picture_playback_tiled(const sk_picture_t* picture, const sk_pixmap_t* pixmap, const sk_matrix_t* matrix, int tile_width, int tile_height, int max_threads);
+
+// Sets `damage` to the device-space area in which playing back `current` with
+// `matrix` into a surface of `device_bounds` may differ from playing back
+// `previous` the same way. Ops are compared by type, geometry, paint, matrix,
+// clip and the unique ids of the images, text blobs, paths and vertices they
+// draw. The result is conservative. If `previous` is null the whole
+// `device_bounds` is damaged. `matrix` may be null. Repainting only the damage
+// matches a full repaint only where `current` paints an opaque background.
+SK_C_API void sk_picture_compute_damage(const sk_picture_t* previous, const sk_picture_t* current, const sk_matrix_t* matrix, const sk_irect_t* device_bounds, sk_region_t* damage);
+
 // SkRTreeFactory
 
 SK_C_API sk_rtree_factory_t* sk_rtree_factory_new(void);
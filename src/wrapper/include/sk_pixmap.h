@@ -56,13 +56,35 @@ SK_C_API bool sk_pixmap_read_pixels_to_pixmap(const sk_pixmap_t* cpixmap, const
 SK_C_API bool sk_pixmap_scale_pixels(const sk_pixmap_t* cpixmap, const sk_pixmap_t* dst, const sk_sampling_options_t* sampling);
 SK_C_API bool sk_pixmap_erase_color(const sk_pixmap_t* cpixmap, sk_color_t color, const sk_irect_t* subset);
 SK_C_API bool sk_pixmap_erase_color4f(const sk_pixmap_t* cpixmap, const sk_color4f_t* color, const sk_irect_t* subset);
+// Compares `a` and `b`, which must have the same size and the same 32-bit
+// color type with 8-bit channels. A pixel differs if any channel differs by
+// more than `tolerance`. `options` may be NULL. If `diff_mask` is not NULL it
+// must be an alpha 8 or gray 8 pixmap of the same size, and receives a
+// visualization of the differences chosen by `options`. Returns false if the
+// pixmaps cannot be compared.
+SK_C_API bool sk_pixmap_compare(const sk_pixmap_t* a, const sk_pixmap_t* b, int tolerance, const sk_pixmap_compare_options_t* options, sk_pixmap_compare_stats_t* stats, const sk_pixmap_t* diff_mask);
 
 // Sk*Encoder
 
 SK_C_API bool sk_webpencoder_encode(sk_wstream_t* dst, const sk_pixmap_t* src, const sk_webpencoder_options_t* options);
+// Encodes `count` frames of the same size as an animation that loops forever.
+SK_C_API bool sk_webpencoder_encode_animated(sk_wstream_t* dst, const sk_webpencoder_frame_t frames[], size_t count, const sk_webpencoder_options_t* options);
 SK_C_API bool sk_jpegencoder_encode(sk_wstream_t* dst, const sk_pixmap_t* src, const sk_jpegencoder_options_t* options);
 SK_C_API bool sk_pngencoder_encode(sk_wstream_t* dst, const sk_pixmap_t* src, const sk_pngencoder_options_t* options);
 
+// Encodes an animated WebP a frame at a time. Frames are compressed as they
+// are added, so only the current one is held uncompressed; the animation is
+// written to `dst` by sk_webp_anim_encoder_finish. `loop_count` 0 loops
+// forever. Returns NULL for an empty size.
+SK_C_API sk_webp_anim_encoder_t* sk_webp_anim_encoder_new(int width, int height, const sk_webpencoder_options_t* options, int loop_count);
+SK_C_API void sk_webp_anim_encoder_delete(sk_webp_anim_encoder_t* encoder);
+// Fails unless `frame` has the animation's size and `duration` in
+// milliseconds is not negative, and after finishing.
+SK_C_API bool sk_webp_anim_encoder_add_frame(sk_webp_anim_encoder_t* encoder, const sk_pixmap_t* frame, int duration);
+SK_C_API int sk_webp_anim_encoder_get_frame_count(const sk_webp_anim_encoder_t* encoder);
+// Fails if no frame was added.
+SK_C_API bool sk_webp_anim_encoder_finish(sk_webp_anim_encoder_t* encoder, sk_wstream_t* dst);
+
 // SkSwizzle
 
 SK_C_API void sk_swizzle_swap_rb(uint32_t* dest, const uint32_t* src, int count);
@@ -71,6 +93,9 @@ SK_C_API void sk_swizzle_swap_rb(uint32_t* dest, const uint32_t* src, int count)
 
 SK_C_API sk_color_t sk_color_unpremultiply(const sk_pmcolor_t pmcolor);
 SK_C_API sk_pmcolor_t sk_color_premultiply(const sk_color_t color);
+// The array conversions use SIMD kernels that round differently from
+// sk_color_unpremultiply and sk_color_premultiply: each channel of the result
+// may differ from theirs by one.
 SK_C_API void sk_color_unpremultiply_array(const sk_pmcolor_t* pmcolors, int size, sk_color_t* colors);
 SK_C_API void sk_color_premultiply_array(const sk_color_t* colors, int size, sk_pmcolor_t* pmcolors);
 SK_C_API void sk_color_get_bit_shift(int* a, int* r, int* g, int* b);
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// Encoders that take an image a few rows at a time and write it to `dst`,
+// which must outlive them. Rows are converted from the pixmap's color and
+// alpha type. WebP cannot be encoded incrementally and has no row encoder.
+// Returns NULL if the image is empty or cannot be started; `options` may be
+// NULL for the defaults. XMP metadata and origin are not written to JPEGs.
+SK_C_API sk_row_encoder_t* sk_row_encoder_new_png(sk_wstream_t* dst, int width, int height, bool opaque, const sk_pngencoder_options_t* options);
+SK_C_API sk_row_encoder_t* sk_row_encoder_new_jpeg(sk_wstream_t* dst, int width, int height, const sk_jpegencoder_options_t* options);
+SK_C_API void sk_row_encoder_delete(sk_row_encoder_t* encoder);
+SK_C_API int sk_row_encoder_get_rows_written(const sk_row_encoder_t* encoder);
+// Encodes the next rows from `rows`, which must be as wide as the image.
+// Fails if it has more rows than remain or after an earlier failure.
+SK_C_API bool sk_row_encoder_write_rows(sk_row_encoder_t* encoder, const sk_pixmap_t* rows);
+// Completes the image once every row has been written.
+SK_C_API bool sk_row_encoder_finish(sk_row_encoder_t* encoder);
+
+// Plays `picture` back into bands of `band_height` rows cleared to
+// `background` and encodes each band with `encoder` before the next but one
+// is drawn, then finishes the encoder. Memory is bounded by two bands rather
+// than the image, whose size is the encoder's. The encoder must not have
+// been written to. `stats` may be NULL.
+SK_C_API bool sk_picture_render_in_strips(const sk_picture_t* picture, int band_height, sk_color_t background, sk_row_encoder_t* encoder, sk_strip_render_stats_t* stats);
+
+SK_C_PLUS_PLUS_END_GUARD
@@ -6,5 +6,14 @@ SK_C_PLUS_PLUS_BEGIN_GUARD
 
 SK_C_API void sk_run_loop_initialize(void* dart_api_dl_data);
 SK_C_API bool sk_run_loop_get_isolate_handle(const void* object, int64_t* handle);
+// Destroys all objects queued for destruction on the isolate right away.
+// Must be called on the isolate with the given handle.
+SK_C_API void sk_run_loop_flush(int64_t isolate_handle);
+// Returns the number of objects queued for destruction on the isolate.
+SK_C_API size_t sk_run_loop_get_pending_destroy_count(int64_t isolate_handle);
+// Drops the objects still queued for destruction on an isolate that is shutting
+// down. Takes the isolate handle as a pointer so that it can be used as a Dart
+// native finalizer.
+SK_C_API void sk_run_loop_shutdown(void* isolate_handle);
 
 SK_C_PLUS_PLUS_END_GUARD
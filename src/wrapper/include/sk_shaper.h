@@ -54,12 +54,69 @@ typedef struct {
   sk_shaper_run_handler_commit_line_proc commitLine;
 } sk_shaper_run_handler_procs_t;
 
+// Bulk shaping
+
+typedef struct {
+  const char* fUtf8;
+  size_t fUtf8Bytes;
+  const sk_font_t* fFont;
+  bool fLeftToRight;
+  float fWidth;
+} sk_shaper_buffer_text_t;
+
+// A run of glyphs with one font and bidi level. Glyphs are
+// [fGlyphOffset, fGlyphOffset + fGlyphCount) of the buffer's glyph arrays and
+// the UTF-8 range is relative to the run's text.
+typedef struct {
+  uint32_t fGlyphOffset;
+  uint32_t fGlyphCount;
+  uint32_t fUtf8Begin;
+  uint32_t fUtf8End;
+  uint32_t fFontIndex;
+  float fAdvanceX;
+  uint8_t fBidiLevel;
+} sk_shaper_buffer_run_t;
+
+// A line of runs [fRunOffset, fRunOffset + fRunCount) of text fText. Lines of
+// each text are stacked from y = 0; fBaseline is the y of the glyph origins.
+typedef struct {
+  uint32_t fText;
+  uint32_t fRunOffset;
+  uint32_t fRunCount;
+  float fTop;
+  float fBaseline;
+  float fBottom;
+  float fWidth;
+} sk_shaper_buffer_line_t;
+
+// Pointers into an sk_shaper_buffer_t, valid until it is shaped into again or
+// deleted. Positions are absolute and include glyph offsets; clusters are
+// UTF-8 offsets into each glyph's text.
+typedef struct {
+  const uint16_t* fGlyphs;
+  const sk_point_t* fPositions;
+  const uint32_t* fClusters;
+  size_t fGlyphCount;
+  const sk_shaper_buffer_run_t* fRuns;
+  size_t fRunCount;
+  const sk_shaper_buffer_line_t* fLines;
+  size_t fLineCount;
+  size_t fFontCount;
+} sk_shaper_buffer_data_t;
+
 SK_C_API sk_shaper_t* sk_shaper_new_primitive(void);
 SK_C_API void sk_shaper_delete(sk_shaper_t* shaper);
 
 SK_C_API sk_shaper_t* sk_shaper_new_hb_shaper_driven_wrapper(sk_unicode_t* unicode, sk_fontmgr_t* fallback);
 SK_C_API sk_shaper_t* sk_shaper_new_hb_shape_then_wrap(sk_unicode_t* unicode, sk_fontmgr_t* fallback);
+// Like sk_shaper_new_hb_shape_then_wrap, but shapes text word by word and
+// reuses shaped words from `cache`. Words are split at ASCII spaces and run
+// boundaries and shaped without context, and lines only break at spaces.
+// Text with right-to-left runs, features or hard line breaks is shaped by a
+// plain shape-then-wrap shaper instead.
+SK_C_API sk_shaper_t* sk_shaper_new_hb_cached_shape_then_wrap(sk_unicode_t* unicode, sk_fontmgr_t* fallback, sk_shaping_cache_t* cache);
 SK_C_API sk_shaper_t* sk_shaper_new_hb_shape_dont_wrap_or_reorder(sk_unicode_t* unicode, sk_fontmgr_t* fallback);
+// Also purges every sk_shaping_cache_t.
 SK_C_API void sk_shaper_hb_purge_caches(void);
 
 SK_C_API sk_shaper_t* sk_shaper_new_coretext(void);
@@ -116,6 +173,16 @@ SK_C_API void sk_textblob_builder_run_handler_end_point(sk_textblob_builder_run_
 
 SK_C_API void sk_shaper_shape(const sk_shaper_t* shaper, const char* utf8, size_t utf8Bytes, sk_shaper_font_run_iterator_t* fontIterator, sk_shaper_bidi_run_iterator_t* bidiIterator, sk_shaper_script_run_iterator_t* scriptIterator, sk_shaper_language_run_iterator_t* languageIterator, const sk_shaper_feature_t* features, size_t featuresCount, float width, sk_shaper_run_handler_t* handler);
 
+// Shapes `count` texts one after another into `buffer` without calling back
+// per run, replacing its previous contents. The buffer's storage is reused
+// between calls.
+SK_C_API sk_shaper_buffer_t* sk_shaper_buffer_new(void);
+SK_C_API void sk_shaper_buffer_delete(sk_shaper_buffer_t* buffer);
+SK_C_API void sk_shaper_shape_to_buffer(const sk_shaper_t* shaper, const sk_shaper_buffer_text_t texts[], size_t count, sk_shaper_buffer_t* buffer);
+SK_C_API void sk_shaper_buffer_get_data(const sk_shaper_buffer_t* buffer, sk_shaper_buffer_data_t* data);
+// Returns the font of runs with fFontIndex `index`, owned by the buffer.
+SK_C_API const sk_font_t* sk_shaper_buffer_get_font(const sk_shaper_buffer_t* buffer, size_t index);
+
 SK_C_PLUS_PLUS_END_GUARD
 
 #endif
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "wrapper/include/sk_types.h"
+
+SK_C_PLUS_PLUS_BEGIN_GUARD
+
+// A cache of shaped words keyed by the word's text, font (typeface id, size
+// and flags), script, language and bidi level, with LRU eviction once
+// `byte_budget` is exceeded. Used by sk_shaper_new_hb_cached_shape_then_wrap;
+// every cache is purged by sk_shaper_hb_purge_caches. Shapers using the cache
+// hold a reference, so sk_shaping_cache_delete only releases the caller's.
+SK_C_API sk_shaping_cache_t* sk_shaping_cache_new(size_t byte_budget);
+SK_C_API void sk_shaping_cache_delete(sk_shaping_cache_t* cache);
+SK_C_API size_t sk_shaping_cache_get_budget(const sk_shaping_cache_t* cache);
+SK_C_API void sk_shaping_cache_set_budget(sk_shaping_cache_t* cache, size_t byte_budget);
+SK_C_API void sk_shaping_cache_purge(sk_shaping_cache_t* cache);
+SK_C_API void sk_shaping_cache_get_stats(const sk_shaping_cache_t* cache, sk_shaping_cache_stats_t* stats);
+SK_C_API void sk_shaping_cache_reset_stats(sk_shaping_cache_t* cache);
+
+SK_C_PLUS_PLUS_END_GUARD
@@ -46,6 +46,16 @@ SK_C_API int sk_typeface_read_table_tags(const sk_typeface_t* typeface, sk_font_
 SK_C_API size_t sk_typeface_get_table_size(const sk_typeface_t* typeface, sk_font_table_tag_t tag);
 SK_C_API size_t sk_typeface_get_table_data(const sk_typeface_t* typeface, sk_font_table_tag_t tag, size_t offset, size_t length, void* data);
 SK_C_API sk_data_t* sk_typeface_copy_table_data(const sk_typeface_t* typeface, sk_font_table_tag_t tag);
+// Returns the table without copying it when the typeface was created from data
+// or a memory mapped file, and a copy otherwise. Results are kept in a process
+// wide cache, so repeated calls return the same data until it is evicted.
+// `borrowed`, which may be NULL, is set to whether the data points into the
+// typeface's own storage. Returns NULL if there is no such table; the caller
+// unrefs the result.
+SK_C_API sk_data_t* sk_typeface_ref_table_data(const sk_typeface_t* typeface, sk_font_table_tag_t tag, bool* borrowed);
+SK_C_API size_t sk_typeface_get_table_cache_budget(void);
+SK_C_API void sk_typeface_set_table_cache_budget(size_t bytes);
+SK_C_API void sk_typeface_purge_table_cache(void);
 SK_C_API int sk_typeface_get_units_per_em(const sk_typeface_t* typeface);
 SK_C_API bool sk_typeface_get_kerning_pair_adjustments(const sk_typeface_t* typeface, const uint16_t glyphs[], int glyphCount, int32_t adjustments[], int adjustmentsCount);
 SK_C_API sk_localized_strings_t* sk_typeface_create_family_name_iterator(const sk_typeface_t* typeface);
@@ -76,6 +86,23 @@ SK_C_API sk_fontmgr_t* sk_fontmgr_create_core_text(void* ct_font_collection);
 SK_C_API sk_fontmgr_t* sk_fontmgr_create_directwrite(void* factory, void* collection);
 SK_C_API sk_fontmgr_t* sk_fontmgr_create_fontconfig(void* config);
 
+typedef struct {
+  uint32_t fFileCount;
+  uint32_t fFaceCount;
+  uint32_t fFamilyCount;
+  // Whether the stored index was missing or out of date and was rebuilt.
+  bool fRebuilt;
+  uint64_t fNanos;
+} sk_fontmgr_index_info_t;
+
+// Creates a font manager over the font files below `directories`. Their
+// families, styles and character coverage are read from the index stored at
+// `index_path`, which is rebuilt when font files are added or removed or their
+// size or modification time changes. Typefaces are only opened once matched.
+// `index_path` and `info` may be NULL. Returns NULL where FreeType is not
+// available.
+SK_C_API sk_fontmgr_t* sk_fontmgr_create_indexed(const char* const directories[], size_t directoryCount, const char* index_path, sk_fontmgr_index_info_t* info);
+
 // font style
 
 SK_C_API sk_fontstyle_t* sk_fontstyle_new(int weight, int width, sk_font_style_slant_t slant);
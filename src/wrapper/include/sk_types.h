@@ -883,6 +883,38 @@ typedef struct {
   sk_irect_t fFrameRect;
 } sk_codec_frameinfo_t;
 
+// One input of sk_codec_decode_batch. The image is resized to fWidth x
+// fHeight; if one of them is zero it follows the aspect ratio of the encoded
+// image, and if both are zero the encoded size is kept.
+// UNKNOWN_SK_COLORTYPE keeps the color type suggested by the codec.
+typedef struct {
+  sk_data_t* fData;
+  int fWidth;
+  int fHeight;
+  sk_colortype_t fColorType;
+} sk_codec_decode_request_t;
+
+typedef struct {
+  sk_codec_result_t fResult;
+  // Owned by the caller. NULL unless fResult is SUCCESS_SK_CODEC_RESULT or
+  // INCOMPLETE_INPUT_SK_CODEC_RESULT.
+  sk_bitmap_t* fBitmap;
+  // The size the codec decoded at before resizing to the requested size.
+  sk_isize_t fDecodedSize;
+  uint64_t fDecodeNanos;
+  uint64_t fResizeNanos;
+} sk_codec_decode_result_t;
+
+typedef struct sk_decoded_image_cache_t sk_decoded_image_cache_t;
+
+typedef struct {
+  uint64_t fHits;
+  uint64_t fMisses;
+  uint64_t fEvictions;
+  size_t fBytes;
+  size_t fEntryCount;
+} sk_decoded_image_cache_stats_t;
+
 typedef struct sk_svgcanvas_t sk_svgcanvas_t;
 
 typedef enum {
@@ -985,6 +1017,41 @@ typedef struct {
   float fQuality;
 } sk_webpencoder_options_t;
 
+typedef struct {
+  const sk_pixmap_t* fPixmap;
+  // How long the frame is shown, in milliseconds.
+  int fDuration;
+} sk_webpencoder_frame_t;
+
+typedef struct sk_webp_anim_encoder_t sk_webp_anim_encoder_t;
+
+typedef struct sk_row_encoder_t sk_row_encoder_t;
+
+typedef struct {
+  uint32_t fBandCount;
+  uint64_t fRenderNanos;
+  uint64_t fEncodeNanos;
+  uint64_t fTotalNanos;
+  size_t fBandBytes;
+  double fMegapixelsPerSecond;
+} sk_strip_render_stats_t;
+
+typedef enum {
+  MASK_SK_PIXMAP_DIFF_MODE,
+  DELTA_SK_PIXMAP_DIFF_MODE,
+} sk_pixmap_diff_mode_t;
+
+typedef struct {
+  bool fIgnoreAlpha;
+  sk_pixmap_diff_mode_t fDiffMode;
+} sk_pixmap_compare_options_t;
+
+typedef struct {
+  int fMaxDelta;
+  int64_t fDifferentPixels;
+  sk_irect_t fBounds;
+} sk_pixmap_compare_stats_t;
+
 typedef struct sk_rrect_t sk_rrect_t;
 
 typedef enum {
@@ -1119,6 +1186,137 @@ typedef struct {
   sk_canvas_savelayerrec_flags_t fFlags;
 } sk_canvas_savelayerrec_t;
 
+/*
+ * Opcodes understood by sk_canvas_execute_commands. They cover every
+ * sk_canvas_* function that draws or changes the matrix, clip or save stack;
+ * queries have no opcode.
+ *
+ * A command stream starts with a uint32 version word followed by a sequence
+ * of commands. Every command is a uint32 opcode followed by its arguments,
+ * each encoded as a 4 byte word in host byte order:
+ *  - float / int32 / uint32 values are stored as is,
+ *  - enums (sk_clipop_t, sk_blendmode_t, ...) are uint32 values; a value past
+ *    the last one of its enum makes the stream malformed,
+ *  - rects are 4 floats (left, top, right, bottom),
+ *  - matrices are 16 floats in column-major order, and 3x3 matrices are 9
+ *    floats in column-major order,
+ *  - irects are 4 int32 (left, top, right, bottom), points 2 floats (x, y),
+ *    rsxforms 4 floats (scos, ssin, tx, ty) and 4f colors 4 floats (r, g, b,
+ *    a),
+ *  - objects (paints, paths, images, ...) are uint32 indices into the object
+ *    table; optional objects use SK_CANVAS_COMMAND_NO_OBJECT,
+ *  - sampling options are 6 words: maxAniso, useCubic, B, C, filter, mipmap,
+ *  - byte arrays are a uint32 length followed by the bytes, zero-padded to a
+ *    multiple of 4.
+ */
+#define SK_CANVAS_COMMANDS_VERSION 1
+#define SK_CANVAS_COMMAND_NO_OBJECT 0xFFFFFFFF
+
+typedef enum {
+  // (no arguments)
+  SAVE_SK_CANVAS_COMMAND,
+  // flags (1: bounds, 2: paint), [rect bounds], [paint]
+  SAVE_LAYER_SK_CANVAS_COMMAND,
+  // (no arguments)
+  RESTORE_SK_CANVAS_COMMAND,
+  // int32 saveCount
+  RESTORE_TO_COUNT_SK_CANVAS_COMMAND,
+  // float dx, float dy
+  TRANSLATE_SK_CANVAS_COMMAND,
+  // float sx, float sy
+  SCALE_SK_CANVAS_COMMAND,
+  // float degrees
+  ROTATE_SK_CANVAS_COMMAND,
+  // float sx, float sy
+  SKEW_SK_CANVAS_COMMAND,
+  // matrix
+  CONCAT_SK_CANVAS_COMMAND,
+  // matrix
+  SET_MATRIX_SK_CANVAS_COMMAND,
+  // (no arguments)
+  RESET_MATRIX_SK_CANVAS_COMMAND,
+  // rect, sk_clipop_t op, bool doAA
+  CLIP_RECT_SK_CANVAS_COMMAND,
+  // rrect, sk_clipop_t op, bool doAA
+  CLIP_RRECT_SK_CANVAS_COMMAND,
+  // path, sk_clipop_t op, bool doAA
+  CLIP_PATH_SK_CANVAS_COMMAND,
+  // region, sk_clipop_t op
+  CLIP_REGION_SK_CANVAS_COMMAND,
+  // sk_color_t color
+  CLEAR_SK_CANVAS_COMMAND,
+  // sk_color_t color, sk_blendmode_t mode
+  DRAW_COLOR_SK_CANVAS_COMMAND,
+  // paint
+  DRAW_PAINT_SK_CANVAS_COMMAND,
+  // float x, float y, paint
+  DRAW_POINT_SK_CANVAS_COMMAND,
+  // sk_point_mode_t mode, uint32 count, count * (float x, float y), paint
+  DRAW_POINTS_SK_CANVAS_COMMAND,
+  // float x0, float y0, float x1, float y1, paint
+  DRAW_LINE_SK_CANVAS_COMMAND,
+  // rect, paint
+  DRAW_RECT_SK_CANVAS_COMMAND,
+  // rect, paint
+  DRAW_OVAL_SK_CANVAS_COMMAND,
+  // rect, float rx, float ry, paint
+  DRAW_ROUND_RECT_SK_CANVAS_COMMAND,
+  // rrect, paint
+  DRAW_RRECT_SK_CANVAS_COMMAND,
+  // rrect outer, rrect inner, paint
+  DRAW_DRRECT_SK_CANVAS_COMMAND,
+  // float cx, float cy, float radius, paint
+  DRAW_CIRCLE_SK_CANVAS_COMMAND,
+  // rect oval, float startAngle, float sweepAngle, bool useCenter, paint
+  DRAW_ARC_SK_CANVAS_COMMAND,
+  // path, paint
+  DRAW_PATH_SK_CANVAS_COMMAND,
+  // region, paint
+  DRAW_REGION_SK_CANVAS_COMMAND,
+  // image, float x, float y, sampling, [paint]
+  DRAW_IMAGE_SK_CANVAS_COMMAND,
+  // image, bool hasSrc, rect src, rect dst, sampling, [paint]
+  DRAW_IMAGE_RECT_SK_CANVAS_COMMAND,
+  // bytes text, sk_text_encoding_t encoding, float x, float y, font, paint
+  DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND,
+  // textblob, float x, float y, paint
+  DRAW_TEXT_BLOB_SK_CANVAS_COMMAND,
+  // picture, [paint]
+  DRAW_PICTURE_SK_CANVAS_COMMAND,
+  // vertices, sk_blendmode_t mode, paint
+  DRAW_VERTICES_SK_CANVAS_COMMAND,
+  // sk_color4f_t color
+  CLEAR_COLOR4F_SK_CANVAS_COMMAND,
+  // sk_color4f_t color, sk_blendmode_t mode
+  DRAW_COLOR4F_SK_CANVAS_COMMAND,
+  // flags (1: bounds, 2: paint, 4: backdrop), [rect bounds], [paint],
+  // [imagefilter backdrop], sk_canvas_savelayerrec_flags_t layerFlags
+  SAVE_LAYER_REC_SK_CANVAS_COMMAND,
+  // picture, 3x3 matrix, [paint]
+  DRAW_PICTURE_MATRIX_SK_CANVAS_COMMAND,
+  // drawable, bool hasMatrix, [3x3 matrix]
+  DRAW_DRAWABLE_SK_CANVAS_COMMAND,
+  // rect, bytes key (UTF-8, not NUL-terminated), data value
+  DRAW_ANNOTATION_SK_CANVAS_COMMAND,
+  // image, irect center, rect dst, sk_filter_mode_t mode, [paint]
+  DRAW_IMAGE_NINE_SK_CANVAS_COMMAND,
+  // image, uint32 xCount, xCount * int32 xDivs, uint32 yCount,
+  // yCount * int32 yDivs, flags (1: rect types, 2: colors, 4: bounds),
+  // [cells * sk_lattice_recttype_t], [cells * sk_color_t], [irect bounds],
+  // rect dst, sk_filter_mode_t mode, [paint]
+  // where cells is (xCount + 1) * (yCount + 1). Colors require rect types.
+  DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND,
+  // image atlas, uint32 count, count * rsxform, count * rect tex,
+  // flags (1: colors, 2: cull rect), [count * sk_color_t], sk_blendmode_t mode,
+  // sampling, [rect cullRect], [paint]
+  DRAW_ATLAS_SK_CANVAS_COMMAND,
+  // 12 * point cubics, flags (1: colors, 2: texCoords), [4 * sk_color_t],
+  // [4 * point texCoords], sk_blendmode_t mode, paint
+  DRAW_PATCH_SK_CANVAS_COMMAND,
+  // (no arguments)
+  DISCARD_SK_CANVAS_COMMAND,
+} sk_canvas_command_t;
+
 /*
  * Skottie Animation
  */
@@ -1160,6 +1358,16 @@ typedef struct skresources_resource_provider_t skresources_resource_provider_t;
  * SkUnicode types
  */
 typedef struct sk_unicode_t sk_unicode_t;
+typedef struct sk_unicode_analysis_t sk_unicode_analysis_t;
+typedef struct sk_unicode_analysis_cache_t sk_unicode_analysis_cache_t;
+
+typedef struct {
+  uint64_t fHits;
+  uint64_t fMisses;
+  uint64_t fEvictions;
+  size_t fBytes;
+  size_t fEntryCount;
+} sk_unicode_analysis_cache_stats_t;
 
 /*
  * SkShaper types
@@ -1172,7 +1380,17 @@ typedef struct sk_shaper_font_run_iterator_t sk_shaper_font_run_iterator_t;
 typedef struct sk_shaper_bidi_run_iterator_t sk_shaper_bidi_run_iterator_t;
 typedef struct sk_shaper_script_run_iterator_t sk_shaper_script_run_iterator_t;
 typedef struct sk_shaper_language_run_iterator_t sk_shaper_language_run_iterator_t;
+typedef struct sk_shaper_buffer_t sk_shaper_buffer_t;
 typedef struct sk_textblob_builder_run_handler_t sk_textblob_builder_run_handler_t;
+typedef struct sk_shaping_cache_t sk_shaping_cache_t;
+
+typedef struct {
+  uint64_t fHits;
+  uint64_t fMisses;
+  uint64_t fEvictions;
+  size_t fBytes;
+  size_t fEntryCount;
+} sk_shaping_cache_stats_t;
 
 typedef struct {
   uint32_t tag;
@@ -1187,6 +1405,8 @@ typedef struct {
 typedef struct sk_font_collection_t sk_font_collection_t;
 typedef struct sk_paragraph_t sk_paragraph_t;
 typedef struct sk_paragraph_builder_t sk_paragraph_builder_t;
+typedef struct sk_paragraph_editor_t sk_paragraph_editor_t;
+typedef struct sk_paragraph_layout_cache_t sk_paragraph_layout_cache_t;
 typedef struct sk_paragraph_painter_t sk_paragraph_painter_t;
 typedef struct sk_paragraph_style_t sk_paragraph_style_t;
 typedef struct sk_line_metrics_t sk_line_metrics_t;
@@ -1262,6 +1482,39 @@ typedef struct {
   sk_paragraph_text_direction_t direction;
 } sk_paragraph_text_box_t;
 
+// Column-wise destination for sk_paragraph_get_all_line_metrics. Each
+// non-NULL per-line array must hold sk_paragraph_get_line_metrics_count
+// entries; NULL arrays are skipped. The style runs of line i are entries
+// [style_run_offsets[i], style_run_offsets[i + 1]) of the style run arrays,
+// so style_run_offsets holds one entry more than there are lines and the style
+// run arrays hold sk_paragraph_get_style_metrics_count entries.
+typedef struct {
+  uint64_t* start_index;
+  uint64_t* end_index;
+  uint64_t* end_excluding_whitespaces;
+  uint64_t* end_including_newline;
+  uint8_t* hard_break;
+  double* ascent;
+  double* descent;
+  double* unscaled_ascent;
+  double* height;
+  double* width;
+  double* left;
+  double* baseline;
+  uint64_t* line_number;
+  uint64_t* style_run_offsets;
+  uint64_t* style_run_text_starts;
+  sk_fontmetrics_t* style_run_font_metrics;
+} sk_paragraph_line_metrics_buffer_t;
+
+typedef struct {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  size_t bytes;
+  size_t entry_count;
+} sk_paragraph_layout_cache_stats_t;
+
 typedef struct {
   sk_rect_t bounds;
   sk_paragraph_text_range_t cluster_text_range;
@@ -1350,6 +1603,17 @@ typedef struct {
   float baseline_offset;
 } sk_paragraph_placeholder_style_t;
 
+// One run of a flat paragraph description, see sk_paragraph_builder_add_runs.
+typedef struct {
+  // Index of the run's text style, or -1 to keep the style at the top of the
+  // builder's style stack.
+  int32_t style_index;
+  // Index of the placeholder this run adds, or -1 for a text run.
+  int32_t placeholder_index;
+  // Bytes of UTF-8 text in a text run; zero for a placeholder run.
+  uint32_t text_length;
+} sk_paragraph_text_run_t;
+
 typedef struct {
   sk_color_t color;
   sk_point_t offset;
@@ -1411,4 +1675,58 @@ typedef enum {
   SK_IMAGE_RESCALE_MODE_REPEATED_CUBIC,
 } sk_image_rescale_mode_t;
 
+typedef struct sk_async_task_t sk_async_task_t;
+
+typedef enum {
+  PENDING_SK_ASYNC_STATUS,
+  RUNNING_SK_ASYNC_STATUS,
+  COMPLETED_SK_ASYNC_STATUS,
+  CANCELLED_SK_ASYNC_STATUS,
+} sk_async_status_t;
+
+typedef void (*sk_async_work_proc)(sk_async_task_t* task, void* context);
+typedef void (*sk_async_completion_proc)(sk_async_task_t* task, void* context);
+
+typedef struct {
+  uint64_t submitted;
+  uint64_t completed;
+  uint64_t cancelled;
+  int64_t queue_depth;
+  int64_t running;
+  uint64_t total_queue_ns;
+  uint64_t max_queue_ns;
+  uint64_t total_run_ns;
+} sk_async_stats_t;
+
+typedef struct sk_encode_queue_t sk_encode_queue_t;
+
+// The options used are the ones for fFormat, which must be PNG, JPEG or WebP.
+typedef struct {
+  sk_encoded_image_format_t fFormat;
+  sk_pngencoder_options_t fPng;
+  sk_jpegencoder_options_t fJpeg;
+  sk_webpencoder_options_t fWebp;
+} sk_encode_options_t;
+
+typedef struct {
+  // NULL if encoding failed or was cancelled, otherwise owned by the caller.
+  sk_data_t* fData;
+  uint64_t fQueueNanos;
+  uint64_t fEncodeNanos;
+} sk_encode_result_t;
+
+typedef struct {
+  uint64_t fSubmitted;
+  uint64_t fRejected;
+  uint64_t fEncoded;
+  uint64_t fFailed;
+  uint64_t fCancelled;
+  int fInFlight;
+  size_t fEncodedBytes;
+  uint64_t fTotalQueueNanos;
+  uint64_t fMaxQueueNanos;
+  uint64_t fTotalEncodeNanos;
+  uint64_t fMaxEncodeNanos;
+} sk_encode_queue_stats_t;
+
 #endif
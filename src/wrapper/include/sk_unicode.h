@@ -23,6 +23,78 @@ SK_C_API sk_unicode_t* sk_unicode_make_libgrapheme(void);
 SK_C_API bool sk_icu_load_data(const char* data_path);
 SK_C_API bool sk_icu_set_data(void* data);
 
+// Batched analysis
+
+// Bits of the per code unit flags of an sk_unicode_analysis_t. Line and word
+// breaks are set at the code unit that starts the next line or word; the
+// offset one past the end of the text has flags too.
+typedef enum {
+  WHITESPACE_SK_UNICODE_ANALYSIS_FLAGS = 1 << 0,
+  GRAPHEME_START_SK_UNICODE_ANALYSIS_FLAGS = 1 << 1,
+  SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS = 1 << 2,
+  HARD_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS = 1 << 3,
+  WORD_BREAK_SK_UNICODE_ANALYSIS_FLAGS = 1 << 4,
+  CONTROL_SK_UNICODE_ANALYSIS_FLAGS = 1 << 5,
+} sk_unicode_analysis_flags_t;
+
+typedef struct {
+  const char* fUtf8;
+  size_t fUtf8Bytes;
+  // Locale for word breaks, or null for the default locale.
+  const char* fLocale;
+  bool fLeftToRight;
+} sk_unicode_analysis_text_t;
+
+typedef struct {
+  uint32_t fStart;
+  uint32_t fEnd;
+  uint8_t fLevel;
+} sk_unicode_bidi_region_t;
+
+// The results of one text: fUtf8Bytes + 1 flags starting at fFlagOffset and
+// fBidiRegionCount regions starting at fBidiRegionOffset. Offsets in the
+// regions are UTF-8 offsets into the text.
+typedef struct {
+  uint32_t fFlagOffset;
+  uint32_t fBidiRegionOffset;
+  uint32_t fBidiRegionCount;
+  bool fCached;
+} sk_unicode_analysis_text_result_t;
+
+// Pointers into an sk_unicode_analysis_t, valid until it is analyzed into
+// again or deleted.
+typedef struct {
+  const uint8_t* fFlags;
+  size_t fFlagCount;
+  const sk_unicode_bidi_region_t* fBidiRegions;
+  size_t fBidiRegionCount;
+  const sk_unicode_analysis_text_result_t* fTexts;
+  size_t fTextCount;
+} sk_unicode_analysis_data_t;
+
+SK_C_API sk_unicode_analysis_t* sk_unicode_analysis_new(void);
+SK_C_API void sk_unicode_analysis_delete(sk_unicode_analysis_t* analysis);
+SK_C_API void sk_unicode_analysis_get_data(const sk_unicode_analysis_t* analysis, sk_unicode_analysis_data_t* data);
+
+// Computes grapheme, line and word breaks, whitespace, control characters
+// and bidi regions of `count` texts into `analysis`, replacing its previous
+// contents. Texts are analyzed concurrently on the shared worker pool with at
+// most `max_threads` threads including the caller (<= 0 means no limit). Each
+// thread reuses its break iterators across texts and calls. Results are
+// looked up in and added to `cache` if it is not null. Returns false if any
+// text could not be analyzed; its results are then empty.
+SK_C_API bool sk_unicode_analyze(sk_unicode_t* unicode, const sk_unicode_analysis_text_t texts[], size_t count, sk_unicode_analysis_cache_t* cache, int max_threads, sk_unicode_analysis_t* analysis);
+
+// An LRU cache of analysis results keyed by text, locale and direction, with a
+// byte budget. Use a cache with a single sk_unicode_t implementation.
+SK_C_API sk_unicode_analysis_cache_t* sk_unicode_analysis_cache_new(size_t byte_budget);
+SK_C_API void sk_unicode_analysis_cache_delete(sk_unicode_analysis_cache_t* cache);
+SK_C_API size_t sk_unicode_analysis_cache_get_budget(const sk_unicode_analysis_cache_t* cache);
+SK_C_API void sk_unicode_analysis_cache_set_budget(sk_unicode_analysis_cache_t* cache, size_t byte_budget);
+SK_C_API void sk_unicode_analysis_cache_purge(sk_unicode_analysis_cache_t* cache);
+SK_C_API void sk_unicode_analysis_cache_get_stats(const sk_unicode_analysis_cache_t* cache, sk_unicode_analysis_cache_stats_t* stats);
+SK_C_API void sk_unicode_analysis_cache_reset_stats(sk_unicode_analysis_cache_t* cache);
+
 SK_C_PLUS_PLUS_END_GUARD
 
 #endif
@@ -0,0 +1,207 @@
+#include "indexed_font_mgr.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "include/core/SkData.h"
+#include "include/core/SkFontArguments.h"
+#include "include/core/SkStream.h"
+#include "include/core/SkString.h"
+#include "include/core/SkTypeface.h"
+
+namespace {
+
+class IndexedStyleSet : public SkFontStyleSet {
+ public:
+  IndexedStyleSet(sk_sp<IndexedFontMgr> manager, int family)
+      : manager_(std::move(manager)), first_face_(manager_->index().family_first_face(family)), count_(manager_->index().family_face_count(family)) {}
+
+  int count() override { return count_; }
+
+  void getStyle(int index, SkFontStyle* style, SkString* name) override {
+    if (style) {
+      *style = manager_->index().face_style(first_face_ + index);
+    }
+    if (name) {
+      name->reset();
+    }
+  }
+
+  sk_sp<SkTypeface> createTypeface(int index) override {
+    return manager_->face_typeface(first_face_ + index);
+  }
+
+  sk_sp<SkTypeface> matchStyle(const SkFontStyle& pattern) override {
+    return matchStyleCSS3(pattern);
+  }
+
+ private:
+  sk_sp<IndexedFontMgr> manager_;
+  int first_face_;
+  int count_;
+};
+
+constexpr int kBlockShift = 8;
+
+int style_distance(const SkFontStyle& a, const SkFontStyle& b) {
+  return std::abs(a.weight() - b.weight()) + 100 * std::abs(a.width() - b.width()) + (a.slant() == b.slant() ? 0 : 1000);
+}
+
+}  // namespace
+
+IndexedFontMgr::IndexedFontMgr(std::unique_ptr<FontIndex> index, std::unique_ptr<SkFontScanner> scanner)
+    : index_(std::move(index)), scanner_(std::move(scanner)), default_family_(-1), typefaces_(index_->face_count()) {
+  for (const char* name : {"DejaVu Sans", "Noto Sans", "Liberation Sans", "Arial", "Roboto"}) {
+    default_family_ = index_->find_family(name);
+    if (default_family_ >= 0) {
+      break;
+    }
+  }
+  if (default_family_ < 0 && index_->family_count() > 0) {
+    default_family_ = 0;
+  }
+}
+
+IndexedFontMgr::~IndexedFontMgr() = default;
+
+sk_sp<SkTypeface> IndexedFontMgr::face_typeface(int face) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (typefaces_[face]) {
+      return typefaces_[face];
+    }
+  }
+  // Open the file without holding the lock; if another thread opened the same
+  // face meanwhile, its typeface wins.
+  std::unique_ptr<SkStreamAsset> stream = SkStream::MakeFromFile(index_->face_path(face).c_str());
+  if (!stream) {
+    return nullptr;
+  }
+  sk_sp<SkTypeface> typeface = scanner_->MakeFromStream(std::move(stream), SkFontArguments().setCollectionIndex(index_->face_ttc_index(face)));
+  if (!typeface) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!typefaces_[face]) {
+    typefaces_[face] = std::move(typeface);
+  }
+  return typefaces_[face];
+}
+
+const std::vector<int>& IndexedFontMgr::block_faces(uint32_t block) const {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = block_faces_.find(block);
+    if (it != block_faces_.end()) {
+      return it->second;
+    }
+  }
+  // Scan the index without holding the lock; if another thread scanned the
+  // same block meanwhile, its identical list wins.
+  const uint32_t first = block << kBlockShift;
+  const uint32_t last = first + (1u << kBlockShift) - 1;
+  std::vector<int> faces;
+  for (int face = 0; face < index_->face_count(); ++face) {
+    if (index_->face_covers_any(face, first, last)) {
+      faces.push_back(face);
+    }
+  }
+  std::lock_guard<std::mutex> lock(mutex_);
+  return block_faces_.emplace(block, std::move(faces)).first->second;
+}
+
+int IndexedFontMgr::family_for_name(const char familyName[]) const {
+  if (!familyName) {
+    return default_family_;
+  }
+  return index_->find_family(familyName);
+}
+
+int IndexedFontMgr::onCountFamilies() const {
+  return index_->family_count();
+}
+
+void IndexedFontMgr::onGetFamilyName(int index, SkString* familyName) const {
+  if (index < 0 || index >= index_->family_count()) {
+    familyName->reset();
+    return;
+  }
+  const std::string_view name = index_->family_name(index);
+  familyName->set(name.data(), name.size());
+}
+
+sk_sp<SkFontStyleSet> IndexedFontMgr::onCreateStyleSet(int index) const {
+  if (index < 0 || index >= index_->family_count()) {
+    return nullptr;
+  }
+  return sk_make_sp<IndexedStyleSet>(sk_ref_sp(this), index);
+}
+
+sk_sp<SkFontStyleSet> IndexedFontMgr::onMatchFamily(const char familyName[]) const {
+  const int family = family_for_name(familyName);
+  if (family < 0) {
+    return nullptr;
+  }
+  return sk_make_sp<IndexedStyleSet>(sk_ref_sp(this), family);
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onMatchFamilyStyle(const char familyName[], const SkFontStyle& style) const {
+  sk_sp<SkFontStyleSet> set = onMatchFamily(familyName);
+  return set ? set->matchStyle(style) : nullptr;
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onMatchFamilyStyleCharacter(const char familyName[], const SkFontStyle& style, const char* bcp47[], int bcp47Count, SkUnichar character) const {
+  // Try the faces of the requested family first, then all others, each in
+  // order of style distance. The index only records character map ranges, so
+  // every candidate is checked for an actual glyph.
+  if (character < 0) {
+    return nullptr;
+  }
+  const int family = familyName ? index_->find_family(familyName) : -1;
+  std::vector<int> candidates;
+  for (int face : block_faces(static_cast<uint32_t>(character) >> kBlockShift)) {
+    if (index_->face_covers(face, character)) {
+      candidates.push_back(face);
+    }
+  }
+  std::stable_sort(candidates.begin(), candidates.end(), [&](int a, int b) {
+    const bool a_in_family = index_->face_family(a) == family;
+    const bool b_in_family = index_->face_family(b) == family;
+    if (a_in_family != b_in_family) {
+      return a_in_family;
+    }
+    return style_distance(index_->face_style(a), style) < style_distance(index_->face_style(b), style);
+  });
+  for (int face : candidates) {
+    sk_sp<SkTypeface> typeface = face_typeface(face);
+    if (typeface && typeface->unicharToGlyph(character) != 0) {
+      return typeface;
+    }
+  }
+  return nullptr;
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onMakeFromData(sk_sp<SkData> data, int ttcIndex) const {
+  return onMakeFromStreamIndex(std::make_unique<SkMemoryStream>(std::move(data)), ttcIndex);
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset> stream, int ttcIndex) const {
+  return onMakeFromStreamArgs(std::move(stream), SkFontArguments().setCollectionIndex(ttcIndex));
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset> stream, const SkFontArguments& args) const {
+  return scanner_->MakeFromStream(std::move(stream), args);
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onMakeFromFile(const char path[], int ttcIndex) const {
+  std::unique_ptr<SkStreamAsset> stream = SkStream::MakeFromFile(path);
+  return stream ? onMakeFromStreamIndex(std::move(stream), ttcIndex) : nullptr;
+}
+
+sk_sp<SkTypeface> IndexedFontMgr::onLegacyMakeTypeface(const char familyName[], SkFontStyle style) const {
+  sk_sp<SkTypeface> typeface = onMatchFamilyStyle(familyName, style);
+  if (!typeface && familyName) {
+    typeface = onMatchFamilyStyle(nullptr, style);
+  }
+  return typeface;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "include/core/SkFontMgr.h"
+#include "include/core/SkFontScanner.h"
+#include "wrapper/font_index.h"
+
+// A font manager over the faces of a FontIndex. Typefaces are opened with
+// `scanner` the first time they are matched and kept for the lifetime of the
+// manager, so creating the manager does not touch any font file.
+//
+// Character fallback picks, among the faces whose character map covers the
+// character, the one closest to the requested style; the bcp47 tags are not
+// used. The faces covering each block of 256 code points are found the first
+// time a character of the block falls back, so later lookups only consider
+// those faces instead of every indexed one.
+class IndexedFontMgr : public SkFontMgr {
+ public:
+  IndexedFontMgr(std::unique_ptr<FontIndex> index, std::unique_ptr<SkFontScanner> scanner);
+  ~IndexedFontMgr() override;
+
+  const FontIndex& index() const { return *index_; }
+  // Returns the typeface of `face`, opening it if needed, or null if the file
+  // can no longer be read.
+  sk_sp<SkTypeface> face_typeface(int face) const;
+
+ protected:
+  int onCountFamilies() const override;
+  void onGetFamilyName(int index, SkString* familyName) const override;
+  sk_sp<SkFontStyleSet> onCreateStyleSet(int index) const override;
+  sk_sp<SkFontStyleSet> onMatchFamily(const char familyName[]) const override;
+  sk_sp<SkTypeface> onMatchFamilyStyle(const char familyName[], const SkFontStyle& style) const override;
+  sk_sp<SkTypeface> onMatchFamilyStyleCharacter(const char familyName[], const SkFontStyle& style, const char* bcp47[], int bcp47Count, SkUnichar character) const override;
+  sk_sp<SkTypeface> onMakeFromData(sk_sp<SkData> data, int ttcIndex) const override;
+  sk_sp<SkTypeface> onMakeFromStreamIndex(std::unique_ptr<SkStreamAsset> stream, int ttcIndex) const override;
+  sk_sp<SkTypeface> onMakeFromStreamArgs(std::unique_ptr<SkStreamAsset> stream, const SkFontArguments& args) const override;
+  sk_sp<SkTypeface> onMakeFromFile(const char path[], int ttcIndex) const override;
+  sk_sp<SkTypeface> onLegacyMakeTypeface(const char familyName[], SkFontStyle style) const override;
+
+ private:
+  // The named family, or the default family for a null name. -1 if the name
+  // is not indexed.
+  int family_for_name(const char familyName[]) const;
+  // The faces whose character map includes any code point of `block`, in
+  // face order. The vector lives as long as the manager.
+  const std::vector<int>& block_faces(uint32_t block) const;
+
+  std::unique_ptr<FontIndex> index_;
+  std::unique_ptr<SkFontScanner> scanner_;
+  int default_family_;
+
+  mutable std::mutex mutex_;
+  mutable std::vector<sk_sp<SkTypeface>> typefaces_;
+  // Keyed by block. Entries are never removed, so references to them stay
+  // valid without the lock.
+  mutable std::unordered_map<uint32_t, std::vector<int>> block_faces_;
+};
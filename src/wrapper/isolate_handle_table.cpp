@@ -0,0 +1,52 @@
+#include "isolate_handle_table.h"
+
+IsolateHandleTable::Shard& IsolateHandleTable::shard_for(const void* object) {
+  // Allocations are at least 16-byte aligned, so the low bits carry no
+  // information. Fibonacci hashing spreads the rest over the shards.
+  const uint64_t bits = reinterpret_cast<uintptr_t>(object) >> 4;
+  const uint64_t hash = bits * 0x9E3779B97F4A7C15ull;
+  return shards_[hash >> 58];
+}
+
+void IsolateHandleTable::set(const void* object, int64_t handle) {
+  Shard& shard = shard_for(object);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto insert = shard.entries.insert({object, {handle, 1}});
+  if (!insert.second) {
+    insert.first->second.handle = handle;
+    insert.first->second.ref_count++;
+  }
+}
+
+void IsolateHandleTable::ref(const void* object) {
+  Shard& shard = shard_for(object);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.entries.find(object);
+  if (it != shard.entries.end()) {
+    it->second.ref_count++;
+  }
+}
+
+std::optional<int64_t> IsolateHandleTable::get(const void* object) {
+  Shard& shard = shard_for(object);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.entries.find(object);
+  if (it != shard.entries.end()) {
+    return it->second.handle;
+  }
+  return std::nullopt;
+}
+
+std::optional<int64_t> IsolateHandleTable::unref(const void* object) {
+  Shard& shard = shard_for(object);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  auto it = shard.entries.find(object);
+  if (it == shard.entries.end()) {
+    return std::nullopt;
+  }
+  const int64_t handle = it->second.handle;
+  if (--it->second.ref_count == 0) {
+    shard.entries.erase(it);
+  }
+  return handle;
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+
+// Thread-safe map from native objects to the handle of the isolate that owns
+// them, with a reference count per object.
+//
+// Objects are spread over independently locked shards so that threads working
+// on different objects rarely contend, and the handle and reference count live
+// in a single entry so every operation is one lookup under one lock.
+class IsolateHandleTable {
+ public:
+  // Sets the handle for the object and adds a reference to it, creating the
+  // entry with a reference count of one if it does not exist.
+  void set(const void* object, int64_t handle);
+
+  // Adds a reference to the object if it has an entry.
+  void ref(const void* object);
+
+  std::optional<int64_t> get(const void* object);
+
+  // Drops a reference to the object and returns its handle, or nullopt if the
+  // object has no entry. The entry is removed once the last reference is gone.
+  std::optional<int64_t> unref(const void* object);
+
+ private:
+  struct Entry {
+    int64_t handle;
+    int64_t ref_count;
+  };
+
+  // Aligned to avoid false sharing between the locks of neighboring shards.
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::unordered_map<const void*, Entry> entries;
+  };
+
+  static constexpr size_t kShardCount = 64;
+
+  Shard& shard_for(const void* object);
+
+  std::array<Shard, kShardCount> shards_;
+};
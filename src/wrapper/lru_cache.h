@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+struct LruCacheStats {
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t evictions;
+  size_t bytes;
+  size_t entries;
+};
+
+// Map with a byte budget shared by the wrapper's caches. Entries are charged
+// the size given on insert and evicted least recently used first once their
+// total exceeds the budget. Values are returned by copy, so they are usually
+// reference counted and stay valid after eviction. Safe to use from several
+// threads.
+//
+// A key may point into its value, for example at a recipe the value owns; the
+// key is removed from the index before its value is destroyed.
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruCache {
+ public:
+  // The `keep` most recently used entries are never evicted to fit the
+  // budget, so that a value larger than the budget still outlives its insert.
+  explicit LruCache(size_t budget, size_t keep = 0) : budget_(budget), keep_(keep) {}
+
+  LruCache(const LruCache&) = delete;
+  LruCache& operator=(const LruCache&) = delete;
+
+  // Copies the cached value into `value` and marks it most recently used.
+  // Counts a hit or a miss.
+  bool find(const Key& key, Value* value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      ++misses_;
+      return false;
+    }
+    ++hits_;
+    entries_.splice(entries_.begin(), entries_, it->second);
+    *value = it->second->value;
+    return true;
+  }
+
+  // Inserts `value` charged `bytes` and returns it. Concurrent misses on the
+  // same key may both compute a value; the first insert wins and later ones
+  // return the cached value instead.
+  Value insert(Key key, Value value, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto [it, inserted] = index_.emplace(std::move(key), entries_.end());
+    if (!inserted) {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      return it->second->value;
+    }
+    entries_.push_front(Entry{&it->first, std::move(value), bytes});
+    it->second = entries_.begin();
+    bytes_ += bytes;
+    Value result = entries_.front().value;
+    evict_to_budget_locked();
+    return result;
+  }
+
+  // Charges the entry for `key`, if still cached, `bytes` more, for values
+  // that grow after insert. Evicts as needed, possibly the entry itself.
+  void add_bytes(const Key& key, size_t bytes) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it == index_.end()) {
+      return;
+    }
+    it->second->bytes += bytes;
+    bytes_ += bytes;
+    evict_to_budget_locked();
+  }
+
+  // Evicts every entry for which `predicate(key, value)` returns true.
+  template <typename Predicate>
+  void remove_if(Predicate predicate) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (auto it = entries_.begin(); it != entries_.end();) {
+      auto next = std::next(it);
+      if (predicate(*it->key, it->value)) {
+        erase_locked(it);
+      }
+      it = next;
+    }
+  }
+
+  size_t budget() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return budget_;
+  }
+
+  // Evicts entries as needed to fit the new budget.
+  void set_budget(size_t budget) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    budget_ = budget;
+    evict_to_budget_locked();
+  }
+
+  void purge() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    evictions_ += entries_.size();
+    index_.clear();
+    entries_.clear();
+    bytes_ = 0;
+  }
+
+  LruCacheStats stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return {hits_, misses_, evictions_, bytes_, entries_.size()};
+  }
+
+  void reset_stats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    hits_ = 0;
+    misses_ = 0;
+    evictions_ = 0;
+  }
+
+ private:
+  struct Entry {
+    // Points at the key stored in index_.
+    const Key* key;
+    Value value;
+    size_t bytes;
+  };
+
+  using EntryList = std::list<Entry>;
+
+  void erase_locked(typename EntryList::iterator it) {
+    bytes_ -= it->bytes;
+    index_.erase(index_.find(*it->key));
+    entries_.erase(it);
+    ++evictions_;
+  }
+
+  void evict_to_budget_locked() {
+    while (bytes_ > budget_ && entries_.size() > keep_) {
+      erase_locked(std::prev(entries_.end()));
+    }
+  }
+
+  mutable std::mutex mutex_;
+  size_t budget_;
+  const size_t keep_;
+  size_t bytes_ = 0;
+  // Most recently used first.
+  EntryList entries_;
+  std::unordered_map<Key, typename EntryList::iterator, Hash> index_;
+  uint64_t hits_ = 0;
+  uint64_t misses_ = 0;
+  uint64_t evictions_ = 0;
+};
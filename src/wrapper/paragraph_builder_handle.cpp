@@ -0,0 +1,54 @@
+#include "paragraph_builder_handle.h"
+
+ParagraphBuilderHandle::ParagraphBuilderHandle(const skia::textlayout::ParagraphStyle& style, sk_sp<skia::textlayout::FontCollection> font_collection, sk_sp<SkUnicode> unicode, bool record_recipe)
+    : builder_(skia::textlayout::ParagraphBuilder::make(style, font_collection, unicode)),
+      font_collection_(font_collection),
+      font_queries_(ParagraphRecipe::ParagraphStyleFontQueries(style)) {
+  if (record_recipe) {
+    recipe_ = std::make_unique<ParagraphRecipe>(style, std::move(font_collection), std::move(unicode));
+  }
+}
+
+void ParagraphBuilderHandle::push_style(const skia::textlayout::TextStyle& style) {
+  builder_->pushStyle(style);
+  ParagraphRecipe::AddFontQuery(&font_queries_, style.getFontFamilies(), style.getFontStyle());
+  if (recipe_) {
+    recipe_->push_style(style);
+  }
+}
+
+void ParagraphBuilderHandle::pop() {
+  builder_->pop();
+  if (recipe_) {
+    recipe_->pop();
+  }
+}
+
+void ParagraphBuilderHandle::add_text(const char* text, size_t length) {
+  builder_->addText(text, length);
+  if (recipe_) {
+    recipe_->add_text(text, length);
+  }
+}
+
+void ParagraphBuilderHandle::add_placeholder(const skia::textlayout::PlaceholderStyle& placeholder) {
+  builder_->addPlaceholder(placeholder);
+  if (recipe_) {
+    recipe_->add_placeholder(placeholder);
+  }
+}
+
+void ParagraphBuilderHandle::reset() {
+  builder_->Reset();
+  font_queries_ = ParagraphRecipe::ParagraphStyleFontQueries(builder_->getParagraphStyle());
+  if (recipe_) {
+    recipe_->reset();
+  }
+}
+
+ParagraphHandle* ParagraphBuilderHandle::build() {
+  const SkSpan<char> text = builder_->getText();
+  auto* handle = new ParagraphHandle(builder_->Build());
+  handle->set_layout_inputs(font_collection_, font_queries_, std::string(text.data(), text.size()));
+  return handle;
+}
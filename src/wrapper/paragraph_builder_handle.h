@@ -0,0 +1,40 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "modules/skparagraph/include/ParagraphBuilder.h"
+#include "wrapper/paragraph_handle.h"
+#include "wrapper/paragraph_recipe.h"
+
+// The object behind sk_paragraph_builder_t. Forwards to the Skia builder and,
+// when `record_recipe` is set, records the same calls in a ParagraphRecipe,
+// which keys the paragraph layout cache and seeds paragraph editors. Builders
+// that only build directly skip the recording; they only track the font
+// lookups of pushed styles and hand them to the paragraph with its text.
+class ParagraphBuilderHandle {
+ public:
+  ParagraphBuilderHandle(const skia::textlayout::ParagraphStyle& style, sk_sp<skia::textlayout::FontCollection> font_collection, sk_sp<SkUnicode> unicode, bool record_recipe);
+
+  ParagraphBuilderHandle(const ParagraphBuilderHandle&) = delete;
+  ParagraphBuilderHandle& operator=(const ParagraphBuilderHandle&) = delete;
+
+  skia::textlayout::ParagraphBuilder* builder() { return builder_.get(); }
+  const skia::textlayout::ParagraphBuilder* builder() const { return builder_.get(); }
+  // Null unless the builder records a recipe.
+  const ParagraphRecipe* recipe() const { return recipe_.get(); }
+
+  void push_style(const skia::textlayout::TextStyle& style);
+  void pop();
+  void add_text(const char* text, size_t length);
+  void add_placeholder(const skia::textlayout::PlaceholderStyle& placeholder);
+  void reset();
+  // Builds the paragraph. The caller owns the handle.
+  ParagraphHandle* build();
+
+ private:
+  std::unique_ptr<skia::textlayout::ParagraphBuilder> builder_;
+  std::unique_ptr<ParagraphRecipe> recipe_;
+  sk_sp<skia::textlayout::FontCollection> font_collection_;
+  std::vector<ParagraphRecipe::FontQuery> font_queries_;
+};
@@ -0,0 +1,289 @@
+#include "paragraph_editor.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+
+#include "include/core/SkCanvas.h"
+#include "modules/skparagraph/include/ParagraphBuilder.h"
+
+using skia::textlayout::Paragraph;
+using skia::textlayout::TextStyle;
+
+namespace {
+
+constexpr char kObjectReplacementCharacter[] = "\xEF\xBF\xBC";
+constexpr size_t kPlaceholderLength = sizeof(kObjectReplacementCharacter) - 1;
+
+bool IsCodePointBoundary(const std::string& text, size_t offset) {
+  return offset == text.size() || (static_cast<uint8_t>(text[offset]) & 0xC0) != 0x80;
+}
+
+// Skia paragraphs take and return UTF-16 offsets.
+size_t Utf8ToUtf16(const char* text, size_t utf8_offset) {
+  size_t utf16 = 0;
+  for (size_t i = 0; i < utf8_offset; ++i) {
+    const uint8_t byte = static_cast<uint8_t>(text[i]);
+    if ((byte & 0xC0) != 0x80) {
+      // Code points above U+FFFF take four UTF-8 and two UTF-16 code units.
+      utf16 += byte >= 0xF0 ? 2 : 1;
+    }
+  }
+  return utf16;
+}
+
+size_t Utf16ToUtf8(const char* text, size_t length, size_t utf16_offset) {
+  size_t utf16 = 0;
+  size_t i = 0;
+  while (i < length && utf16 < utf16_offset) {
+    const uint8_t byte = static_cast<uint8_t>(text[i]);
+    utf16 += byte >= 0xF0 ? 2 : 1;
+    ++i;
+    while (i < length && (static_cast<uint8_t>(text[i]) & 0xC0) == 0x80) {
+      ++i;
+    }
+  }
+  return i;
+}
+
+}  // namespace
+
+ParagraphEditor::ParagraphEditor(const ParagraphRecipe& recipe)
+    : paragraph_style_(recipe.paragraph_style), font_collection_(recipe.font_collection), unicode_(recipe.unicode), placeholders_(recipe.placeholders) {
+  styles_.reserve(recipe.styles.size() + 1);
+  styles_.push_back(paragraph_style_.getTextStyle());
+  styles_.insert(styles_.end(), recipe.styles.begin(), recipe.styles.end());
+
+  std::vector<size_t> stack = {0};
+  size_t text_start = 0;
+  for (const ParagraphRecipe::Op& op : recipe.ops) {
+    switch (op.kind) {
+      case ParagraphRecipe::OpKind::kPushStyle:
+        stack.push_back(op.value + 1);
+        break;
+      case ParagraphRecipe::OpKind::kPop:
+        if (stack.size() > 1) {
+          stack.pop_back();
+        }
+        break;
+      case ParagraphRecipe::OpKind::kText:
+        append_run(&runs_, {text_.size(), op.value - text_start, stack.back(), -1});
+        text_.append(recipe.text, text_start, op.value - text_start);
+        text_start = op.value;
+        break;
+      case ParagraphRecipe::OpKind::kPlaceholder:
+        append_run(&runs_, {text_.size(), kPlaceholderLength, stack.back(), static_cast<int>(op.value)});
+        text_.append(kObjectReplacementCharacter);
+        break;
+    }
+  }
+  split_blocks(0, text_.size(), true, &blocks_);
+}
+
+bool ParagraphEditor::replace(size_t start, size_t end, const char* text, size_t length) {
+  if (start > end || end > text_.size() || !IsCodePointBoundary(text_, start) || !IsCodePointBoundary(text_, end)) {
+    return false;
+  }
+  const size_t removed = end - start;
+
+  // Inserted text continues the style of what precedes it, or at the very
+  // start, of what follows it.
+  size_t insert_style = 0;
+  if (start > 0) {
+    insert_style = runs_[run_at(start - 1)].style;
+  } else if (!runs_.empty()) {
+    insert_style = runs_.front().style;
+  }
+
+  std::vector<Run> runs;
+  runs.reserve(runs_.size() + 2);
+  bool inserted = false;
+  for (const Run& run : runs_) {
+    const size_t run_end = run.start + run.length;
+    if (run_end <= start) {
+      append_run(&runs, run);
+      continue;
+    }
+    if (run.placeholder < 0 && run.start < start) {
+      append_run(&runs, {run.start, start - run.start, run.style, -1});
+    }
+    if (!inserted) {
+      append_run(&runs, {start, length, insert_style, -1});
+      inserted = true;
+    }
+    // Placeholders overlapping the range lie entirely inside it, since
+    // their inner bytes are not code point boundaries.
+    if (run_end > end) {
+      const size_t keep_from = std::max(run.start, end);
+      append_run(&runs, {keep_from - removed + length, run_end - keep_from, run.style, run.placeholder});
+    }
+  }
+  if (!inserted) {
+    append_run(&runs, {start, length, insert_style, -1});
+  }
+  runs_ = std::move(runs);
+
+  // The edit is confined to the blocks from the one holding `start` through
+  // the one holding `end`, together with the line break that ends the last.
+  const size_t first = block_at(start);
+  const size_t last = block_at(end);
+  const size_t region_start = blocks_[first].start;
+  const bool to_end = last + 1 == blocks_.size();
+  const size_t region_end = to_end ? text_.size() : blocks_[last + 1].start;
+
+  text_.replace(start, removed, text, length);
+
+  std::vector<Block> replacement;
+  split_blocks(region_start, region_end - removed + length, to_end, &replacement);
+  for (size_t i = last + 1; i < blocks_.size(); ++i) {
+    blocks_[i].start = blocks_[i].start - removed + length;
+  }
+  blocks_.erase(blocks_.begin() + first, blocks_.begin() + last + 1);
+  blocks_.insert(blocks_.begin() + first, std::make_move_iterator(replacement.begin()), std::make_move_iterator(replacement.end()));
+  return true;
+}
+
+size_t ParagraphEditor::layout(float width) {
+  const bool relayout_all = width != width_;
+  width_ = width;
+  size_t laid_out = 0;
+  for (Block& block : blocks_) {
+    if (!block.dirty && !relayout_all) {
+      continue;
+    }
+    if (!block.paragraph) {
+      block.paragraph = build_block(block);
+    }
+    block.paragraph->layout(width);
+    block.dirty = false;
+    ++laid_out;
+  }
+  update_metrics();
+  return laid_out;
+}
+
+void ParagraphEditor::paint(SkCanvas* canvas, float x, float y) {
+  for (const Block& block : blocks_) {
+    if (block.paragraph && !block.dirty) {
+      block.paragraph->paint(canvas, x, y + block.top);
+    }
+  }
+}
+
+skia::textlayout::PositionWithAffinity ParagraphEditor::glyph_position_at_coordinate(float dx, float dy) {
+  // The last block starting at or above dy.
+  auto it = std::upper_bound(blocks_.begin(), blocks_.end(), dy, [](float y, const Block& block) { return y < block.top; });
+  const Block& block = it == blocks_.begin() ? blocks_.front() : *std::prev(it);
+  if (!block.paragraph || block.dirty) {
+    return {static_cast<int32_t>(block.start), skia::textlayout::Affinity::kDownstream};
+  }
+  const auto local = block.paragraph->getGlyphPositionAtCoordinate(dx, dy - block.top);
+  const size_t offset = Utf16ToUtf8(text_.data() + block.start, block.length, static_cast<size_t>(std::max(local.position, 0)));
+  return {static_cast<int32_t>(block.start + offset), local.affinity};
+}
+
+std::vector<skia::textlayout::TextBox> ParagraphEditor::rects_for_range(size_t start, size_t end, skia::textlayout::RectHeightStyle height_style, skia::textlayout::RectWidthStyle width_style) {
+  std::vector<skia::textlayout::TextBox> result;
+  end = std::min(end, text_.size());
+  if (start >= end) {
+    return result;
+  }
+  for (size_t i = block_at(start); i < blocks_.size() && blocks_[i].start < end; ++i) {
+    const Block& block = blocks_[i];
+    if (!block.paragraph || block.dirty) {
+      continue;
+    }
+    const size_t local_start = std::max(start, block.start) - block.start;
+    const size_t local_end = std::min(end, block.start + block.length) - block.start;
+    if (local_start >= local_end) {
+      continue;
+    }
+    const char* block_text = text_.data() + block.start;
+    for (skia::textlayout::TextBox box : block.paragraph->getRectsForRange(Utf8ToUtf16(block_text, local_start), Utf8ToUtf16(block_text, local_end), height_style, width_style)) {
+      box.rect.offset(0, block.top);
+      result.push_back(box);
+    }
+  }
+  return result;
+}
+
+void ParagraphEditor::append_run(std::vector<Run>* runs, const Run& run) const {
+  if (run.length == 0) {
+    return;
+  }
+  if (run.placeholder < 0 && !runs->empty()) {
+    Run& previous = runs->back();
+    if (previous.placeholder < 0 && previous.style == run.style) {
+      previous.length += run.length;
+      return;
+    }
+  }
+  runs->push_back(run);
+}
+
+void ParagraphEditor::split_blocks(size_t from, size_t to, bool to_end, std::vector<Block>* blocks) const {
+  size_t block_start = from;
+  for (size_t i = from; i < to; ++i) {
+    if (text_[i] != '\n') {
+      continue;
+    }
+    const size_t content_end = i > block_start && text_[i - 1] == '\r' ? i - 1 : i;
+    blocks->push_back(Block{block_start, content_end - block_start});
+    block_start = i + 1;
+  }
+  if (to_end) {
+    blocks->push_back(Block{block_start, to - block_start});
+  }
+}
+
+size_t ParagraphEditor::block_at(size_t offset) const {
+  auto it = std::upper_bound(blocks_.begin(), blocks_.end(), offset, [](size_t value, const Block& block) { return value < block.start; });
+  return it == blocks_.begin() ? 0 : static_cast<size_t>(std::prev(it) - blocks_.begin());
+}
+
+size_t ParagraphEditor::run_at(size_t offset) const {
+  auto it = std::upper_bound(runs_.begin(), runs_.end(), offset, [](size_t value, const Run& run) { return value < run.start; });
+  return it == runs_.begin() ? 0 : static_cast<size_t>(std::prev(it) - runs_.begin());
+}
+
+std::unique_ptr<Paragraph> ParagraphEditor::build_block(const Block& block) const {
+  const size_t block_end = block.start + block.length;
+  skia::textlayout::ParagraphStyle style = paragraph_style_;
+  if (block.length == 0 && block.start > 0 && !runs_.empty()) {
+    // An empty line takes its height from the style of the line break before
+    // it, as it would inside a single paragraph.
+    style.setTextStyle(styles_[runs_[run_at(block.start - 1)].style]);
+  }
+  auto builder = skia::textlayout::ParagraphBuilder::make(style, font_collection_, unicode_);
+  for (size_t i = runs_.empty() ? 0 : run_at(block.start); i < runs_.size() && runs_[i].start < block_end; ++i) {
+    const Run& run = runs_[i];
+    const size_t from = std::max(run.start, block.start);
+    const size_t to = std::min(run.start + run.length, block_end);
+    if (from >= to) {
+      continue;
+    }
+    builder->pushStyle(styles_[run.style]);
+    if (run.placeholder >= 0) {
+      builder->addPlaceholder(placeholders_[run.placeholder]);
+    } else {
+      builder->addText(text_.data() + from, to - from);
+    }
+    builder->pop();
+  }
+  return builder->Build();
+}
+
+void ParagraphEditor::update_metrics() {
+  float top = 0;
+  longest_line_ = 0;
+  line_count_ = 0;
+  for (Block& block : blocks_) {
+    block.top = top;
+    if (block.paragraph && !block.dirty) {
+      top += block.paragraph->getHeight();
+      longest_line_ = std::max(longest_line_, block.paragraph->getLongestLine());
+      line_count_ += block.paragraph->lineNumber();
+    }
+  }
+  height_ = top;
+}
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "modules/skparagraph/include/DartTypes.h"
+#include "modules/skparagraph/include/FontCollection.h"
+#include "modules/skparagraph/include/Paragraph.h"
+#include "modules/skparagraph/include/ParagraphStyle.h"
+#include "modules/skparagraph/include/TextStyle.h"
+#include "modules/skunicode/include/SkUnicode.h"
+#include "wrapper/paragraph_recipe.h"
+
+class SkCanvas;
+
+// Styled text that is edited in place and laid out incrementally.
+//
+// The text is split at hard line breaks ("\n" or "\r\n") into blocks, each
+// laid out as its own Skia paragraph. An edit rebuilds only the blocks it
+// touches; every other block keeps its shaping and line breaks, so the cost of
+// an edit does not grow with the size of the document. A width change relays
+// out every block but reuses their shaping.
+//
+// Since each block is a separate paragraph, the paragraph style's max lines,
+// ellipsis and text height behavior apply per block.
+//
+// Text offsets are in UTF-8 code units. A placeholder takes the three code
+// units of U+FFFC, as in the text of a paragraph builder.
+class ParagraphEditor {
+ public:
+  explicit ParagraphEditor(const ParagraphRecipe& recipe);
+
+  ParagraphEditor(const ParagraphEditor&) = delete;
+  ParagraphEditor& operator=(const ParagraphEditor&) = delete;
+
+  const std::string& text() const { return text_; }
+
+  // Replaces [start, end) with `length` bytes of `text`. Inserted text takes
+  // the style of the text before `start`. Returns false, changing nothing, if
+  // the range is out of bounds or does not fall on code point boundaries.
+  bool replace(size_t start, size_t end, const char* text, size_t length);
+
+  // Lays out the blocks changed since the last layout, or every block if the
+  // width changed. Returns the number of blocks laid out.
+  size_t layout(float width);
+
+  float height() const { return height_; }
+  float longest_line() const { return longest_line_; }
+  size_t line_count() const { return line_count_; }
+
+  void paint(SkCanvas* canvas, float x, float y);
+  skia::textlayout::PositionWithAffinity glyph_position_at_coordinate(float dx, float dy);
+  std::vector<skia::textlayout::TextBox> rects_for_range(size_t start, size_t end, skia::textlayout::RectHeightStyle height_style, skia::textlayout::RectWidthStyle width_style);
+
+ private:
+  struct Run {
+    size_t start;
+    size_t length;
+    // Index into styles_.
+    size_t style;
+    // Index into placeholders_, or -1 for text.
+    int placeholder;
+  };
+
+  struct Block {
+    size_t start;
+    // Excludes the line break that ends the block.
+    size_t length;
+    std::unique_ptr<skia::textlayout::Paragraph> paragraph;
+    float top = 0;
+    bool dirty = true;
+  };
+
+  void append_run(std::vector<Run>* runs, const Run& run) const;
+  // Appends the blocks of [from, to). `from` must start a block and `to` must
+  // follow a line break, unless `to_end` is set: then `to` is the end of the
+  // text and the possibly empty last block is appended as well.
+  void split_blocks(size_t from, size_t to, bool to_end, std::vector<Block>* blocks) const;
+  size_t block_at(size_t offset) const;
+  size_t run_at(size_t offset) const;
+  std::unique_ptr<skia::textlayout::Paragraph> build_block(const Block& block) const;
+  void update_metrics();
+
+  skia::textlayout::ParagraphStyle paragraph_style_;
+  sk_sp<skia::textlayout::FontCollection> font_collection_;
+  sk_sp<SkUnicode> unicode_;
+  std::string text_;
+  // styles_[0] is the paragraph's default text style.
+  std::vector<skia::textlayout::TextStyle> styles_;
+  std::vector<skia::textlayout::PlaceholderStyle> placeholders_;
+  // Cover the text in order without gaps.
+  std::vector<Run> runs_;
+  std::vector<Block> blocks_;
+  float width_ = 0;
+  float height_ = 0;
+  float longest_line_ = 0;
+  size_t line_count_ = 0;
+};
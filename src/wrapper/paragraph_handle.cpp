@@ -0,0 +1,104 @@
+#include "paragraph_handle.h"
+
+void ParagraphHandle::set_layout_inputs(sk_sp<skia::textlayout::FontCollection> font_collection, std::vector<ParagraphRecipe::FontQuery> font_queries, std::string text) {
+  font_collection_ = std::move(font_collection);
+  font_queries_ = std::move(font_queries);
+  text_ = std::move(text);
+}
+
+void ParagraphHandle::layout(float width) {
+  if (shared_recipe_) {
+    if (width == shared_width_) {
+      return;
+    }
+    detach();
+  }
+  paragraph_->layout(width);
+  invalidate();
+}
+
+void ParagraphHandle::mark_dirty() {
+  if (shared_recipe_) {
+    detach();
+  } else {
+    paragraph_->markDirty();
+  }
+  invalidate();
+}
+
+void ParagraphHandle::prepare_concurrent_layout() {
+  if (shared_recipe_) {
+    ParagraphRecipe::PrefetchTypefaces(shared_recipe_->font_collection.get(), shared_recipe_->font_queries());
+  } else {
+    ParagraphRecipe::PrefetchTypefaces(font_collection_.get(), font_queries_);
+  }
+}
+
+size_t ParagraphHandle::text_size() const {
+  return text().size();
+}
+
+std::string_view ParagraphHandle::text() const {
+  if (shared_recipe_) {
+    return shared_recipe_->text;
+  }
+  return text_;
+}
+
+const std::vector<skia::textlayout::LineMetrics>& ParagraphHandle::line_metrics() {
+  if (!line_metrics_valid_) {
+    line_metrics_.clear();
+    paragraph_->getLineMetrics(line_metrics_);
+    style_metrics_count_ = 0;
+    for (const auto& line : line_metrics_) {
+      style_metrics_count_ += line.fLineMetrics.size();
+    }
+    line_metrics_valid_ = true;
+  }
+  return line_metrics_;
+}
+
+size_t ParagraphHandle::style_metrics_count() {
+  line_metrics();
+  return style_metrics_count_;
+}
+
+void ParagraphHandle::set_hit_test_index_enabled(bool enabled) {
+  hit_test_index_enabled_ = enabled;
+  if (!enabled) {
+    hit_test_index_.reset();
+  }
+}
+
+skia::textlayout::PositionWithAffinity ParagraphHandle::glyph_position_at_coordinate(float dx, float dy) {
+  if (!hit_test_index_enabled_) {
+    return paragraph_->getGlyphPositionAtCoordinate(dx, dy);
+  }
+  return hit_test_index().glyph_position_at_coordinate(dx, dy);
+}
+
+bool ParagraphHandle::closest_glyph_cluster_at(float dx, float dy, skia::textlayout::Paragraph::GlyphClusterInfo* info) {
+  if (!hit_test_index_enabled_) {
+    return paragraph_->getClosestGlyphClusterAt(dx, dy, info);
+  }
+  return hit_test_index().closest_glyph_cluster_at(dx, dy, info);
+}
+
+const ParagraphHitTestIndex& ParagraphHandle::hit_test_index() {
+  if (!hit_test_index_) {
+    hit_test_index_ = std::make_unique<ParagraphHitTestIndex>(paragraph_.get(), line_metrics(), text());
+  }
+  return *hit_test_index_;
+}
+
+void ParagraphHandle::invalidate() {
+  line_metrics_valid_ = false;
+  line_metrics_.clear();
+  hit_test_index_.reset();
+}
+
+void ParagraphHandle::detach() {
+  paragraph_ = shared_recipe_->build();
+  set_layout_inputs(shared_recipe_->font_collection, shared_recipe_->font_queries(), shared_recipe_->text);
+  shared_recipe_.reset();
+}
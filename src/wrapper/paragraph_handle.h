@@ -0,0 +1,78 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "modules/skparagraph/include/Metrics.h"
+#include "modules/skparagraph/include/Paragraph.h"
+#include "wrapper/paragraph_hit_test_index.h"
+#include "wrapper/paragraph_recipe.h"
+
+// The object behind sk_paragraph_t. Owns the Skia paragraph together with
+// state the wrapper derives from its layout, which is dropped whenever the
+// layout may change.
+//
+// A paragraph handed out by the layout cache shares its Skia paragraph with
+// the cache entry. Such a handle keeps the recipe it was built from and, the
+// first time it would change the shared layout, builds a private paragraph
+// instead.
+class ParagraphHandle {
+ public:
+  explicit ParagraphHandle(std::unique_ptr<skia::textlayout::Paragraph> paragraph) : paragraph_(std::move(paragraph)) {}
+  ParagraphHandle(std::shared_ptr<skia::textlayout::Paragraph> shared, std::shared_ptr<const ParagraphRecipe> recipe, float width)
+      : paragraph_(std::move(shared)), shared_recipe_(std::move(recipe)), shared_width_(width) {}
+
+  ParagraphHandle(const ParagraphHandle&) = delete;
+  ParagraphHandle& operator=(const ParagraphHandle&) = delete;
+
+  skia::textlayout::Paragraph* paragraph() { return paragraph_.get(); }
+  const skia::textlayout::Paragraph* paragraph() const { return paragraph_.get(); }
+  bool is_shared() const { return shared_recipe_ != nullptr; }
+
+  // Records what prepare_concurrent_layout and the hit-test index need for a
+  // paragraph built directly from a builder.
+  void set_layout_inputs(sk_sp<skia::textlayout::FontCollection> font_collection, std::vector<ParagraphRecipe::FontQuery> font_queries, std::string text);
+
+  void layout(float width);
+  void mark_dirty();
+
+  // Fills the font collection caches that layout writes to, after which
+  // paragraphs sharing the collection can be laid out on several threads.
+  void prepare_concurrent_layout();
+  // Size of the paragraph text in UTF-8 code units.
+  size_t text_size() const;
+
+  // Metrics of every line of the current layout. Computed on first use after
+  // each layout instead of on every query.
+  const std::vector<skia::textlayout::LineMetrics>& line_metrics();
+  // Total number of style runs over all lines.
+  size_t style_metrics_count();
+
+  // When enabled, coordinate queries are answered from a ParagraphHitTestIndex
+  // built on first use after each layout.
+  void set_hit_test_index_enabled(bool enabled);
+  bool hit_test_index_enabled() const { return hit_test_index_enabled_; }
+  skia::textlayout::PositionWithAffinity glyph_position_at_coordinate(float dx, float dy);
+  bool closest_glyph_cluster_at(float dx, float dy, skia::textlayout::Paragraph::GlyphClusterInfo* info);
+
+ private:
+  void invalidate();
+  void detach();
+  // The paragraph text in UTF-8.
+  std::string_view text() const;
+  const ParagraphHitTestIndex& hit_test_index();
+
+  std::shared_ptr<skia::textlayout::Paragraph> paragraph_;
+  std::shared_ptr<const ParagraphRecipe> shared_recipe_;
+  float shared_width_ = 0;
+  sk_sp<skia::textlayout::FontCollection> font_collection_;
+  std::vector<ParagraphRecipe::FontQuery> font_queries_;
+  std::string text_;
+  bool line_metrics_valid_ = false;
+  std::vector<skia::textlayout::LineMetrics> line_metrics_;
+  size_t style_metrics_count_ = 0;
+  bool hit_test_index_enabled_ = false;
+  std::unique_ptr<ParagraphHitTestIndex> hit_test_index_;
+};
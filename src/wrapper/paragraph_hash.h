@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+#include "modules/skparagraph/include/ParagraphStyle.h"
+#include "modules/skparagraph/include/TextStyle.h"
+
+// FNV-1a style hashes of the paragraph style objects, shared by the public
+// *_get_hash functions and the paragraph layout cache keys.
+constexpr uint64_t kParagraphHashSeed = 1469598103934665603ull;
+
+void HashMix(uint64_t* hash, uint64_t value);
+void HashMixFloat(uint64_t* hash, float value);
+
+int64_t TextStyleHash(const skia::textlayout::TextStyle& value);
+int64_t StrutStyleHash(const skia::textlayout::StrutStyle& value);
+int64_t ParagraphStyleHash(const skia::textlayout::ParagraphStyle& value);
@@ -0,0 +1,160 @@
+#include "paragraph_hit_test_index.h"
+
+#include <algorithm>
+#include <iterator>
+
+using skia::textlayout::Affinity;
+using skia::textlayout::Paragraph;
+using skia::textlayout::PositionWithAffinity;
+using skia::textlayout::TextDirection;
+
+namespace {
+
+uint32_t NextCodePoint(std::string_view text, uint32_t offset) {
+  uint32_t next = std::min<uint32_t>(offset + 1, static_cast<uint32_t>(text.size()));
+  while (next < text.size() && (static_cast<uint8_t>(text[next]) & 0xC0) == 0x80) {
+    ++next;
+  }
+  return next;
+}
+
+}  // namespace
+
+ParagraphHitTestIndex::ParagraphHitTestIndex(Paragraph* paragraph, const std::vector<skia::textlayout::LineMetrics>& line_metrics, std::string_view text) {
+  // Lines are stacked without gaps, so each one spans from the bottom of the
+  // previous line for its height.
+  lines_.reserve(line_metrics.size());
+  float top = 0;
+  for (const auto& metrics : line_metrics) {
+    const float bottom = top + static_cast<float>(metrics.fHeight);
+    lines_.push_back({top, bottom, static_cast<uint32_t>(metrics.fStartIndex), 0, 0});
+    top = bottom;
+  }
+
+  std::vector<std::vector<Cluster>> line_clusters(lines_.size());
+  std::vector<uint32_t> boundaries;
+  paragraph->visit([&](int line_number, const Paragraph::VisitorInfo* info) {
+    if (info == nullptr || info->count <= 0 || line_number < 0 || static_cast<size_t>(line_number) >= lines_.size()) {
+      return;
+    }
+    // utf8Starts holds one entry per glyph plus the end of the run. Glyphs
+    // are in visual order, so the text offsets decrease in a right-to-left
+    // run.
+    const uint32_t* starts = info->utf8Starts;
+    const bool rtl = starts[0] > starts[info->count - 1];
+    boundaries.assign(starts, starts + info->count + 1);
+    std::sort(boundaries.begin(), boundaries.end());
+
+    std::vector<Cluster>& clusters = line_clusters[line_number];
+    int glyph = 0;
+    while (glyph < info->count) {
+      const uint32_t start = starts[glyph];
+      int next = glyph + 1;
+      while (next < info->count && starts[next] == start) {
+        ++next;
+      }
+      auto end = std::upper_bound(boundaries.begin(), boundaries.end(), start);
+      const float left = info->origin.fX + info->positions[glyph].fX;
+      const float right = info->origin.fX + (next < info->count ? info->positions[next].fX : info->advanceX);
+      clusters.push_back({std::min(left, right), std::max(left, right), start, end != boundaries.end() ? *end : NextCodePoint(text, start), 0, 0, rtl});
+      glyph = next;
+    }
+  });
+
+  size_t cluster_count = 0;
+  for (const auto& clusters : line_clusters) {
+    cluster_count += clusters.size();
+  }
+  clusters_.reserve(cluster_count);
+  for (size_t i = 0; i < lines_.size(); ++i) {
+    std::vector<Cluster>& clusters = line_clusters[i];
+    std::sort(clusters.begin(), clusters.end(), [](const Cluster& a, const Cluster& b) { return a.left < b.left; });
+    lines_[i].cluster_begin = clusters_.size();
+    clusters_.insert(clusters_.end(), clusters.begin(), clusters.end());
+    lines_[i].cluster_end = clusters_.size();
+  }
+
+  // Map every UTF-8 offset the index reports to UTF-16 in a single pass over
+  // the text.
+  std::vector<uint32_t> offsets;
+  offsets.reserve(clusters_.size() * 2 + lines_.size());
+  for (const Cluster& cluster : clusters_) {
+    offsets.push_back(cluster.start);
+    offsets.push_back(cluster.end);
+  }
+  for (const Line& line : lines_) {
+    offsets.push_back(line.start16);
+  }
+  std::sort(offsets.begin(), offsets.end());
+  offsets.erase(std::unique(offsets.begin(), offsets.end()), offsets.end());
+  std::vector<uint32_t> offsets16(offsets.size());
+  uint32_t utf8 = 0;
+  uint32_t utf16 = 0;
+  for (size_t i = 0; i < offsets.size(); ++i) {
+    while (utf8 < offsets[i] && utf8 < text.size()) {
+      const uint8_t byte = static_cast<uint8_t>(text[utf8]);
+      if ((byte & 0xC0) != 0x80) {
+        // Code points above U+FFFF take four UTF-8 and two UTF-16 code units.
+        utf16 += byte >= 0xF0 ? 2 : 1;
+      }
+      ++utf8;
+    }
+    offsets16[i] = utf16;
+  }
+  auto to_utf16 = [&](uint32_t offset) { return offsets16[std::lower_bound(offsets.begin(), offsets.end(), offset) - offsets.begin()]; };
+  for (Cluster& cluster : clusters_) {
+    cluster.start16 = to_utf16(cluster.start);
+    cluster.end16 = to_utf16(cluster.end);
+  }
+  for (Line& line : lines_) {
+    line.start16 = to_utf16(line.start16);
+  }
+}
+
+ParagraphHitTestIndex::Hit ParagraphHitTestIndex::hit(float dx, float dy) const {
+  if (lines_.empty()) {
+    return {nullptr, nullptr, false};
+  }
+  // The first line whose bottom is below dy, or the last line.
+  auto line = std::upper_bound(lines_.begin(), lines_.end(), dy, [](float y, const Line& l) { return y < l.bottom; });
+  if (line == lines_.end()) {
+    line = std::prev(lines_.end());
+  }
+  if (line->cluster_begin == line->cluster_end) {
+    return {&*line, nullptr, false};
+  }
+  const auto first = clusters_.begin() + line->cluster_begin;
+  const auto last = clusters_.begin() + line->cluster_end;
+  auto cluster = std::upper_bound(first, last, dx, [](float x, const Cluster& c) { return x < c.right; });
+  if (cluster == last) {
+    return {&*line, &*std::prev(last), true};
+  }
+  const bool trailing = dx >= cluster->left && dx >= (cluster->left + cluster->right) / 2;
+  return {&*line, &*cluster, trailing};
+}
+
+PositionWithAffinity ParagraphHitTestIndex::glyph_position_at_coordinate(float dx, float dy) const {
+  const Hit result = hit(dx, dy);
+  if (result.cluster == nullptr) {
+    return {result.line ? static_cast<int32_t>(result.line->start16) : 0, Affinity::kDownstream};
+  }
+  const Cluster& cluster = *result.cluster;
+  // The visual right edge of a cluster is its logical end in a left-to-right
+  // run and its logical start in a right-to-left one.
+  if (result.trailing != cluster.rtl) {
+    return {static_cast<int32_t>(cluster.end16), Affinity::kUpstream};
+  }
+  return {static_cast<int32_t>(cluster.start16), Affinity::kDownstream};
+}
+
+bool ParagraphHitTestIndex::closest_glyph_cluster_at(float dx, float dy, Paragraph::GlyphClusterInfo* info) const {
+  const Hit result = hit(dx, dy);
+  if (result.cluster == nullptr) {
+    return false;
+  }
+  const Cluster& cluster = *result.cluster;
+  info->fBounds = SkRect::MakeLTRB(cluster.left, result.line->top, cluster.right, result.line->bottom);
+  info->fClusterTextRange = {cluster.start, cluster.end};
+  info->fGlyphClusterPosition = cluster.rtl ? TextDirection::kRtl : TextDirection::kLtr;
+  return true;
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "modules/skparagraph/include/DartTypes.h"
+#include "modules/skparagraph/include/Metrics.h"
+#include "modules/skparagraph/include/Paragraph.h"
+
+// Answers coordinate queries against a laid out paragraph by binary search
+// instead of walking every line and run. Lines are indexed by their vertical
+// extent and hold the glyph clusters drawn on them sorted by x.
+//
+// The index is built from the glyphs Paragraph::visit reports, so trailing
+// whitespace at a soft line break and placeholders are not hit targets: a
+// coordinate over them resolves to the nearest drawn cluster.
+class ParagraphHitTestIndex {
+ public:
+  // `text` is the paragraph's UTF-8 text, used to map cluster offsets to the
+  // UTF-16 offsets Skia reports.
+  ParagraphHitTestIndex(skia::textlayout::Paragraph* paragraph, const std::vector<skia::textlayout::LineMetrics>& line_metrics, std::string_view text);
+
+  ParagraphHitTestIndex(const ParagraphHitTestIndex&) = delete;
+  ParagraphHitTestIndex& operator=(const ParagraphHitTestIndex&) = delete;
+
+  // Same contract as Paragraph::getGlyphPositionAtCoordinate.
+  skia::textlayout::PositionWithAffinity glyph_position_at_coordinate(float dx, float dy) const;
+  // Same contract as Paragraph::getClosestGlyphClusterAt, except that the
+  // bounds span the height of the cluster's line.
+  bool closest_glyph_cluster_at(float dx, float dy, skia::textlayout::Paragraph::GlyphClusterInfo* info) const;
+
+ private:
+  struct Cluster {
+    float left;
+    float right;
+    // UTF-8 and UTF-16 text ranges.
+    uint32_t start;
+    uint32_t end;
+    uint32_t start16;
+    uint32_t end16;
+    bool rtl;
+  };
+  struct Line {
+    float top;
+    float bottom;
+    // UTF-16 offset returned for a line without clusters.
+    uint32_t start16;
+    // Range of the line's clusters in clusters_.
+    size_t cluster_begin;
+    size_t cluster_end;
+  };
+  struct Hit {
+    const Line* line;
+    const Cluster* cluster;
+    // Whether the coordinate is past the middle of the cluster in visual
+    // order, or before or after the whole line.
+    bool trailing;
+  };
+
+  Hit hit(float dx, float dy) const;
+
+  std::vector<Line> lines_;
+  std::vector<Cluster> clusters_;
+};
@@ -0,0 +1,66 @@
+#include "paragraph_layout_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+namespace {
+
+std::mutex& RegistryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<ParagraphLayoutCache*>& Registry() {
+  static std::vector<ParagraphLayoutCache*> caches;
+  return caches;
+}
+
+}  // namespace
+
+ParagraphLayoutCache::ParagraphLayoutCache(size_t budget) : cache_(budget) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  Registry().push_back(this);
+}
+
+ParagraphLayoutCache::~ParagraphLayoutCache() {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  auto& caches = Registry();
+  caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+}
+
+size_t ParagraphLayoutCache::KeyHash::operator()(const Key& key) const {
+  uint32_t width_bits = 0;
+  std::memcpy(&width_bits, &key.width, sizeof(width_bits));
+  return static_cast<size_t>(key.recipe->hash() * 31 + width_bits);
+}
+
+ParagraphHandle* ParagraphLayoutCache::get(const ParagraphRecipe& recipe, float width) {
+  Layout layout;
+  if (cache_.find(Key{&recipe, width}, &layout)) {
+    return new ParagraphHandle(std::move(layout.paragraph), std::move(layout.recipe), width);
+  }
+
+  // Shaping happens outside the cache's lock, so concurrent misses on the
+  // same key may both lay out; the first insert wins. A layout larger than the
+  // whole budget is evicted right away; the caller still gets the paragraph.
+  auto owned_recipe = std::make_shared<const ParagraphRecipe>(recipe);
+  std::shared_ptr<skia::textlayout::Paragraph> paragraph = owned_recipe->build();
+  paragraph->layout(width);
+  const size_t bytes = owned_recipe->estimated_layout_bytes();
+  const Key key{owned_recipe.get(), width};
+  layout = cache_.insert(key, Layout{std::move(owned_recipe), std::move(paragraph)}, bytes);
+  return new ParagraphHandle(std::move(layout.paragraph), std::move(layout.recipe), width);
+}
+
+void ParagraphLayoutCache::purge(const skia::textlayout::FontCollection* font_collection) {
+  cache_.remove_if([font_collection](const Key&, const Layout& layout) { return layout.recipe->font_collection.get() == font_collection; });
+}
+
+void ParagraphLayoutCache::PurgeAll(const skia::textlayout::FontCollection* font_collection) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  for (ParagraphLayoutCache* cache : Registry()) {
+    cache->purge(font_collection);
+  }
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "modules/skparagraph/include/FontCollection.h"
+#include "modules/skparagraph/include/Paragraph.h"
+#include "wrapper/lru_cache.h"
+#include "wrapper/paragraph_handle.h"
+#include "wrapper/paragraph_recipe.h"
+
+// LRU cache of laid out paragraphs keyed by their builder recipe (text, style
+// runs, placeholders, paragraph style, font collection and unicode instance)
+// and the layout width. A hit skips shaping and line breaking entirely: the
+// returned paragraph shares the cached layout until it is laid out again at a
+// different width or marked dirty.
+//
+// Paragraphs returned by one cache may share Skia objects, so they must not
+// be used from several threads at once. The byte budget is checked against
+// ParagraphRecipe::estimated_layout_bytes.
+class ParagraphLayoutCache {
+ public:
+  using Stats = LruCacheStats;
+
+  explicit ParagraphLayoutCache(size_t budget);
+  ~ParagraphLayoutCache();
+
+  ParagraphLayoutCache(const ParagraphLayoutCache&) = delete;
+  ParagraphLayoutCache& operator=(const ParagraphLayoutCache&) = delete;
+
+  // Returns a new handle laid out at `width`, sharing the cached layout of an
+  // equal recipe or building and inserting one. The caller owns the handle.
+  ParagraphHandle* get(const ParagraphRecipe& recipe, float width);
+
+  size_t budget() const { return cache_.budget(); }
+  // Evicts entries as needed to fit the new budget.
+  void set_budget(size_t budget) { cache_.set_budget(budget); }
+  void purge() { cache_.purge(); }
+  // Evicts every entry shaped with `font_collection`.
+  void purge(const skia::textlayout::FontCollection* font_collection);
+
+  Stats stats() const { return cache_.stats(); }
+  void reset_stats() { cache_.reset_stats(); }
+
+  // Evicts entries shaped with `font_collection` from every live cache; called
+  // when the collection's font caches are cleared.
+  static void PurgeAll(const skia::textlayout::FontCollection* font_collection);
+
+ private:
+  struct Key {
+    // Points at the recipe owned by the cached layout, or at the caller's
+    // recipe during a lookup.
+    const ParagraphRecipe* recipe;
+    float width;
+
+    bool operator==(const Key& other) const { return width == other.width && *recipe == *other.recipe; }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Layout {
+    std::shared_ptr<const ParagraphRecipe> recipe;
+    std::shared_ptr<skia::textlayout::Paragraph> paragraph;
+  };
+
+  LruCache<Key, Layout, KeyHash> cache_;
+};
@@ -0,0 +1,167 @@
+#include "paragraph_recipe.h"
+
+#include <algorithm>
+
+#include "modules/skparagraph/include/ParagraphBuilder.h"
+#include "src/core/SkChecksum.h"
+#include "wrapper/paragraph_hash.h"
+
+using skia::textlayout::PlaceholderStyle;
+using skia::textlayout::TextStyle;
+
+ParagraphRecipe::ParagraphRecipe(const skia::textlayout::ParagraphStyle& style, sk_sp<skia::textlayout::FontCollection> font_collection, sk_sp<SkUnicode> unicode)
+    : paragraph_style(style), font_collection(std::move(font_collection)), unicode(std::move(unicode)) {}
+
+void ParagraphRecipe::push_style(const TextStyle& style) {
+  ops.push_back({OpKind::kPushStyle, styles.size()});
+  styles.push_back(style);
+  hash_valid_ = false;
+}
+
+void ParagraphRecipe::pop() {
+  ops.push_back({OpKind::kPop, 0});
+  hash_valid_ = false;
+}
+
+void ParagraphRecipe::add_text(const char* data, size_t length) {
+  text.append(data, length);
+  ops.push_back({OpKind::kText, text.size()});
+  hash_valid_ = false;
+}
+
+void ParagraphRecipe::add_placeholder(const PlaceholderStyle& placeholder) {
+  ops.push_back({OpKind::kPlaceholder, placeholders.size()});
+  placeholders.push_back(placeholder);
+  hash_valid_ = false;
+}
+
+void ParagraphRecipe::reset() {
+  text.clear();
+  styles.clear();
+  placeholders.clear();
+  ops.clear();
+  hash_valid_ = false;
+}
+
+uint64_t ParagraphRecipe::hash() const {
+  if (hash_valid_) {
+    return hash_;
+  }
+  uint64_t hash = kParagraphHashSeed;
+  HashMix(&hash, static_cast<uint64_t>(ParagraphStyleHash(paragraph_style)));
+  HashMix(&hash, reinterpret_cast<uintptr_t>(font_collection.get()));
+  HashMix(&hash, reinterpret_cast<uintptr_t>(unicode.get()));
+  HashMix(&hash, SkChecksum::Hash64(text.data(), text.size()));
+  for (const Op& op : ops) {
+    HashMix(&hash, static_cast<uint64_t>(op.kind));
+    switch (op.kind) {
+      case OpKind::kPushStyle:
+        HashMix(&hash, static_cast<uint64_t>(TextStyleHash(styles[op.value])));
+        break;
+      case OpKind::kText:
+        HashMix(&hash, op.value);
+        break;
+      case OpKind::kPlaceholder: {
+        const PlaceholderStyle& placeholder = placeholders[op.value];
+        HashMixFloat(&hash, placeholder.fWidth);
+        HashMixFloat(&hash, placeholder.fHeight);
+        HashMix(&hash, static_cast<uint64_t>(placeholder.fAlignment));
+        break;
+      }
+      case OpKind::kPop:
+        break;
+    }
+  }
+  hash_ = hash;
+  hash_valid_ = true;
+  return hash_;
+}
+
+bool ParagraphRecipe::operator==(const ParagraphRecipe& other) const {
+  if (hash() != other.hash() || font_collection != other.font_collection || unicode != other.unicode || ops != other.ops ||
+      text != other.text || styles.size() != other.styles.size() || placeholders.size() != other.placeholders.size() ||
+      !(paragraph_style == other.paragraph_style)) {
+    return false;
+  }
+  for (size_t i = 0; i < styles.size(); ++i) {
+    // The explicit typeface is compared separately from the style values.
+    if (!styles[i].equals(other.styles[i]) || styles[i].getTypeface() != other.styles[i].getTypeface()) {
+      return false;
+    }
+  }
+  for (size_t i = 0; i < placeholders.size(); ++i) {
+    if (!placeholders[i].equals(other.placeholders[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::unique_ptr<skia::textlayout::Paragraph> ParagraphRecipe::build() const {
+  auto builder = skia::textlayout::ParagraphBuilder::make(paragraph_style, font_collection, unicode);
+  size_t text_start = 0;
+  for (const Op& op : ops) {
+    switch (op.kind) {
+      case OpKind::kPushStyle:
+        builder->pushStyle(styles[op.value]);
+        break;
+      case OpKind::kPop:
+        builder->pop();
+        break;
+      case OpKind::kText:
+        builder->addText(text.data() + text_start, op.value - text_start);
+        text_start = op.value;
+        break;
+      case OpKind::kPlaceholder:
+        builder->addPlaceholder(placeholders[op.value]);
+        break;
+    }
+  }
+  return builder->Build();
+}
+
+std::vector<ParagraphRecipe::FontQuery> ParagraphRecipe::font_queries() const {
+  std::vector<FontQuery> queries = ParagraphStyleFontQueries(paragraph_style);
+  for (const TextStyle& style : styles) {
+    AddFontQuery(&queries, style.getFontFamilies(), style.getFontStyle());
+  }
+  return queries;
+}
+
+std::vector<ParagraphRecipe::FontQuery> ParagraphRecipe::ParagraphStyleFontQueries(const skia::textlayout::ParagraphStyle& style) {
+  std::vector<FontQuery> queries;
+  const TextStyle& default_style = style.getTextStyle();
+  AddFontQuery(&queries, default_style.getFontFamilies(), default_style.getFontStyle());
+  const skia::textlayout::StrutStyle& strut = style.getStrutStyle();
+  if (strut.getStrutEnabled()) {
+    AddFontQuery(&queries, strut.getFontFamilies(), strut.getFontStyle());
+  }
+  return queries;
+}
+
+void ParagraphRecipe::AddFontQuery(std::vector<FontQuery>* queries, const std::vector<SkString>& families, SkFontStyle style) {
+  FontQuery query{families, style};
+  if (std::find(queries->begin(), queries->end(), query) == queries->end()) {
+    queries->push_back(std::move(query));
+  }
+}
+
+void ParagraphRecipe::PrefetchTypefaces(skia::textlayout::FontCollection* font_collection, const std::vector<FontQuery>& queries) {
+  if (!font_collection) {
+    return;
+  }
+  // The wrapper never sets font arguments, so these match the cache keys of
+  // the lookups made during shaping.
+  for (const FontQuery& query : queries) {
+    font_collection->findTypefaces(query.families, query.style);
+  }
+}
+
+size_t ParagraphRecipe::estimated_layout_bytes() const {
+  // Per UTF-8 code unit: glyph ids, positions, offsets, cluster and code unit
+  // properties held by the shaped runs and lines.
+  constexpr size_t kBytesPerCodeUnit = 64;
+  constexpr size_t kFixedBytes = 4096;
+  return kFixedBytes + sizeof(*this) + text.size() * (kBytesPerCodeUnit + 1) + styles.size() * sizeof(TextStyle) +
+         placeholders.size() * sizeof(PlaceholderStyle) + ops.size() * sizeof(Op);
+}
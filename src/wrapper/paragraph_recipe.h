@@ -0,0 +1,89 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/core/SkFontStyle.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkString.h"
+#include "modules/skparagraph/include/FontCollection.h"
+#include "modules/skparagraph/include/Paragraph.h"
+#include "modules/skparagraph/include/ParagraphStyle.h"
+#include "modules/skparagraph/include/TextStyle.h"
+#include "modules/skunicode/include/SkUnicode.h"
+
+// The inputs given to a paragraph builder, in order. Two recipes that compare
+// equal build paragraphs with the same layout, so a recipe can key a layout
+// cache and can rebuild a paragraph whose layout is shared.
+struct ParagraphRecipe {
+  enum class OpKind : uint8_t { kPushStyle, kPop, kText, kPlaceholder };
+
+  struct Op {
+    OpKind kind;
+    // kPushStyle: index into styles. kText: end offset into text.
+    // kPlaceholder: index into placeholders.
+    size_t value;
+
+    bool operator==(const Op& other) const { return kind == other.kind && value == other.value; }
+  };
+
+  // A typeface lookup that laying out the recipe makes through the font
+  // collection.
+  struct FontQuery {
+    std::vector<SkString> families;
+    SkFontStyle style;
+
+    bool operator==(const FontQuery& other) const { return style == other.style && families == other.families; }
+  };
+
+  ParagraphRecipe(const skia::textlayout::ParagraphStyle& style, sk_sp<skia::textlayout::FontCollection> font_collection, sk_sp<SkUnicode> unicode);
+
+  void push_style(const skia::textlayout::TextStyle& style);
+  void pop();
+  void add_text(const char* text, size_t length);
+  void add_placeholder(const skia::textlayout::PlaceholderStyle& placeholder);
+  // Forgets every op; the paragraph style, font collection and unicode stay.
+  void reset();
+
+  // Hash of everything operator== compares. Computed on demand and cached
+  // until the next op.
+  uint64_t hash() const;
+  bool operator==(const ParagraphRecipe& other) const;
+
+  // The distinct lookups of the paragraph's default text style, its strut
+  // and every pushed style.
+  std::vector<FontQuery> font_queries() const;
+
+  // The distinct lookups of `style`'s default text style and strut.
+  static std::vector<FontQuery> ParagraphStyleFontQueries(const skia::textlayout::ParagraphStyle& style);
+  // Appends the lookup to `queries` unless it is already there.
+  static void AddFontQuery(std::vector<FontQuery>* queries, const std::vector<SkString>& families, SkFontStyle style);
+
+  // Replays the ops into a new builder.
+  std::unique_ptr<skia::textlayout::Paragraph> build() const;
+
+  // Rough heap footprint of a laid out paragraph built from this recipe,
+  // used for cache budgets. Skia does not report the real size.
+  size_t estimated_layout_bytes() const;
+
+  // Makes `queries` through `font_collection` so that its typeface cache
+  // holds their results. FontCollection fills that cache without locking;
+  // once it is filled, layouts that share the collection only read it and can
+  // run concurrently.
+  static void PrefetchTypefaces(skia::textlayout::FontCollection* font_collection, const std::vector<FontQuery>& queries);
+
+  skia::textlayout::ParagraphStyle paragraph_style;
+  sk_sp<skia::textlayout::FontCollection> font_collection;
+  sk_sp<SkUnicode> unicode;
+  std::string text;
+  std::vector<skia::textlayout::TextStyle> styles;
+  std::vector<skia::textlayout::PlaceholderStyle> placeholders;
+  std::vector<Op> ops;
+
+ private:
+  mutable uint64_t hash_ = 0;
+  mutable bool hash_valid_ = false;
+};
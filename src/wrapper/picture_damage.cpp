@@ -0,0 +1,570 @@
+#include "picture_damage.h"
+
+#include <algorithm>
+#include <atomic>
+#include <optional>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "include/core/SkBlender.h"
+#include "include/core/SkColorFilter.h"
+#include "include/core/SkImage.h"
+#include "include/core/SkImageFilter.h"
+#include "include/core/SkMaskFilter.h"
+#include "include/core/SkMesh.h"
+#include "include/core/SkPaint.h"
+#include "include/core/SkPath.h"
+#include "include/core/SkPathEffect.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkRRect.h"
+#include "include/core/SkShader.h"
+#include "include/core/SkTextBlob.h"
+#include "include/core/SkVertices.h"
+#include "include/utils/SkNoDrawCanvas.h"
+
+namespace {
+
+// 64-bit FNV-1a. Collisions only cause ops to be matched that should not be,
+// which at 64 bits is not a practical concern for a per-frame diff.
+class Hasher {
+ public:
+  void bytes(const void* data, size_t length) {
+    const uint8_t* p = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < length; ++i) {
+      hash_ = (hash_ ^ p[i]) * 0x100000001b3ull;
+    }
+  }
+
+  template <typename T>
+  void add(const T& value) {
+    static_assert(std::is_trivially_copyable<T>::value, "hash fields individually");
+    bytes(&value, sizeof(T));
+  }
+
+  template <typename T>
+  void add_array(const T* values, size_t count) {
+    add(count);
+    if (values) {
+      bytes(values, sizeof(T) * count);
+    }
+  }
+
+  void add_paint(const SkPaint& paint) {
+    add(paint.getColor4f());
+    add(paint.getStyle());
+    add(paint.getStrokeWidth());
+    add(paint.getStrokeMiter());
+    add(paint.getStrokeCap());
+    add(paint.getStrokeJoin());
+    add(paint.isAntiAlias());
+    add(paint.isDither());
+    // Effects are immutable, so identity implies equality.
+    add(paint.getShader());
+    add(paint.getColorFilter());
+    add(paint.getBlender());
+    add(paint.getPathEffect());
+    add(paint.getMaskFilter());
+    add(paint.getImageFilter());
+  }
+
+  void add_sampling(const SkSamplingOptions& sampling) {
+    add(sampling.maxAniso);
+    add(sampling.useCubic);
+    add(sampling.cubic.B);
+    add(sampling.cubic.C);
+    add(sampling.filter);
+    add(sampling.mipmap);
+  }
+
+  void add_rrect(const SkRRect& rrect) {
+    char buffer[SkRRect::kSizeInMemory];
+    rrect.writeToMemory(buffer);
+    bytes(buffer, sizeof(buffer));
+  }
+
+  void add_path(const SkPath& path) {
+    add(path.getGenerationID());
+    add(path.getFillType());
+  }
+
+  uint64_t value() const { return hash_; }
+
+ private:
+  uint64_t hash_ = 0xcbf29ce484222325ull;
+};
+
+enum class OpKind : uint32_t {
+  kSaveLayer,
+  kPaint,
+  kBehind,
+  kPoints,
+  kRect,
+  kRegion,
+  kOval,
+  kArc,
+  kRRect,
+  kDRRect,
+  kPath,
+  kImage,
+  kImageRect,
+  kImageLattice,
+  kAtlas,
+  kVertices,
+  kPatch,
+  kTextBlob,
+  kEdgeAAQuad,
+  kEdgeAAImageSet,
+  kOpaque,
+};
+
+struct Op {
+  uint64_t key;
+  SkIRect bounds;
+
+  bool operator==(const Op& other) const { return key == other.key && bounds == other.bounds; }
+};
+
+struct OpHash {
+  size_t operator()(const Op& op) const {
+    Hasher hasher;
+    hasher.add(op.key);
+    hasher.add(op.bounds);
+    return static_cast<size_t>(hasher.value());
+  }
+};
+
+// Canvas that records the device bounds and a content key of every draw
+// instead of rasterizing it. Nested pictures and drawables are expanded by
+// SkCanvas before they reach the overrides below.
+class OpCollector final : public SkNoDrawCanvas {
+ public:
+  explicit OpCollector(const SkIRect& bounds) : SkNoDrawCanvas(bounds) { states_.push_back({}); }
+
+  std::vector<Op>& ops() { return ops_; }
+
+ protected:
+  void willSave() override {
+    states_.push_back(states_.back());
+    SkNoDrawCanvas::willSave();
+  }
+
+  SaveLayerStrategy getSaveLayerStrategy(const SaveLayerRec& rec) override {
+    Hasher hasher;
+    hasher.add(rec.fSaveLayerFlags);
+    hasher.add(rec.fBackdrop);
+    if (rec.fBounds) {
+      hasher.add(*rec.fBounds);
+    }
+    if (rec.fPaint) {
+      hasher.add_paint(*rec.fPaint);
+    }
+    // The layer is composited on restore, but recording it here keeps it
+    // ordered before the ops drawn into it.
+    add_op(OpKind::kSaveLayer, hasher, rec.fBounds, rec.fPaint);
+
+    State state = states_.back();
+    // Image filters and backdrops can move pixels around, so any change
+    // inside such a layer may affect the whole layer.
+    if (rec.fBackdrop || (rec.fPaint && rec.fPaint->getImageFilter())) {
+      state.spread = this->getDeviceClipBounds();
+    }
+    states_.push_back(state);
+    return SkNoDrawCanvas::getSaveLayerStrategy(rec);
+  }
+
+  void willRestore() override {
+    if (states_.size() > 1) {
+      states_.pop_back();
+    }
+    SkNoDrawCanvas::willRestore();
+  }
+
+  void onClipRect(const SkRect& rect, SkClipOp op, ClipEdgeStyle style) override {
+    Hasher hasher = clip_hasher(1, op, style);
+    hasher.add(rect);
+    states_.back().clip = hasher.value();
+    SkNoDrawCanvas::onClipRect(rect, op, style);
+  }
+
+  void onClipRRect(const SkRRect& rrect, SkClipOp op, ClipEdgeStyle style) override {
+    Hasher hasher = clip_hasher(2, op, style);
+    hasher.add_rrect(rrect);
+    states_.back().clip = hasher.value();
+    SkNoDrawCanvas::onClipRRect(rrect, op, style);
+  }
+
+  void onClipPath(const SkPath& path, SkClipOp op, ClipEdgeStyle style) override {
+    Hasher hasher = clip_hasher(3, op, style);
+    hasher.add_path(path);
+    states_.back().clip = hasher.value();
+    SkNoDrawCanvas::onClipPath(path, op, style);
+  }
+
+  void onClipShader(sk_sp<SkShader> shader, SkClipOp op) override {
+    Hasher hasher = clip_hasher(4, op, kHard_ClipEdgeStyle);
+    hasher.add(shader.get());
+    states_.back().clip = hasher.value();
+    SkNoDrawCanvas::onClipShader(std::move(shader), op);
+  }
+
+  void onClipRegion(const SkRegion& region, SkClipOp op) override {
+    Hasher hasher = clip_hasher(5, op, kHard_ClipEdgeStyle);
+    add_region(hasher, region);
+    states_.back().clip = hasher.value();
+    SkNoDrawCanvas::onClipRegion(region, op);
+  }
+
+  void onResetClip() override {
+    states_.back().clip = 0;
+    SkNoDrawCanvas::onResetClip();
+  }
+
+  void onDrawPaint(const SkPaint& paint) override {
+    Hasher hasher;
+    add_op(OpKind::kPaint, hasher, nullptr, &paint);
+  }
+
+  void onDrawBehind(const SkPaint& paint) override {
+    Hasher hasher;
+    add_op(OpKind::kBehind, hasher, nullptr, &paint);
+  }
+
+  void onDrawPoints(PointMode mode, size_t count, const SkPoint points[], const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add(mode);
+    hasher.add_array(points, count);
+    SkRect bounds;
+    bounds.setBounds(points, static_cast<int>(count));
+    // Points and lines are always stroked, regardless of the paint style.
+    SkPaint stroke(paint);
+    stroke.setStyle(SkPaint::kStroke_Style);
+    add_op(OpKind::kPoints, hasher, &bounds, &stroke);
+  }
+
+  void onDrawRect(const SkRect& rect, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add(rect);
+    add_op(OpKind::kRect, hasher, &rect, &paint);
+  }
+
+  void onDrawRegion(const SkRegion& region, const SkPaint& paint) override {
+    Hasher hasher;
+    add_region(hasher, region);
+    const SkRect bounds = SkRect::Make(region.getBounds());
+    add_op(OpKind::kRegion, hasher, &bounds, &paint);
+  }
+
+  void onDrawOval(const SkRect& oval, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add(oval);
+    add_op(OpKind::kOval, hasher, &oval, &paint);
+  }
+
+  void onDrawArc(const SkRect& oval, SkScalar startAngle, SkScalar sweepAngle, bool useCenter, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add(oval);
+    hasher.add(startAngle);
+    hasher.add(sweepAngle);
+    hasher.add(useCenter);
+    add_op(OpKind::kArc, hasher, &oval, &paint);
+  }
+
+  void onDrawRRect(const SkRRect& rrect, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add_rrect(rrect);
+    add_op(OpKind::kRRect, hasher, &rrect.getBounds(), &paint);
+  }
+
+  void onDrawDRRect(const SkRRect& outer, const SkRRect& inner, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add_rrect(outer);
+    hasher.add_rrect(inner);
+    add_op(OpKind::kDRRect, hasher, &outer.getBounds(), &paint);
+  }
+
+  void onDrawPath(const SkPath& path, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add_path(path);
+    // Inverse fills cover everything outside the path.
+    add_op(OpKind::kPath, hasher, path.isInverseFillType() ? nullptr : &path.getBounds(), &paint);
+  }
+
+  void onDrawImage2(const SkImage* image, SkScalar x, SkScalar y, const SkSamplingOptions& sampling, const SkPaint* paint) override {
+    Hasher hasher;
+    hasher.add(image->uniqueID());
+    hasher.add(x);
+    hasher.add(y);
+    hasher.add_sampling(sampling);
+    const SkRect bounds = SkRect::MakeXYWH(x, y, image->width(), image->height());
+    add_op(OpKind::kImage, hasher, &bounds, paint);
+  }
+
+  void onDrawImageRect2(const SkImage* image, const SkRect& src, const SkRect& dst, const SkSamplingOptions& sampling, const SkPaint* paint, SrcRectConstraint constraint) override {
+    Hasher hasher;
+    hasher.add(image->uniqueID());
+    hasher.add(src);
+    hasher.add(dst);
+    hasher.add_sampling(sampling);
+    hasher.add(constraint);
+    add_op(OpKind::kImageRect, hasher, &dst, paint);
+  }
+
+  void onDrawImageLattice2(const SkImage* image, const Lattice& lattice, const SkRect& dst, SkFilterMode filter, const SkPaint* paint) override {
+    Hasher hasher;
+    hasher.add(image->uniqueID());
+    hasher.add(dst);
+    hasher.add(filter);
+    hasher.add_array(lattice.fXDivs, lattice.fXCount);
+    hasher.add_array(lattice.fYDivs, lattice.fYCount);
+    const size_t cells = static_cast<size_t>(lattice.fXCount + 1) * (lattice.fYCount + 1);
+    hasher.add_array(lattice.fRectTypes, lattice.fRectTypes ? cells : 0);
+    hasher.add_array(lattice.fColors, lattice.fColors ? cells : 0);
+    if (lattice.fBounds) {
+      hasher.add(*lattice.fBounds);
+    }
+    add_op(OpKind::kImageLattice, hasher, &dst, paint);
+  }
+
+  void onDrawAtlas2(const SkImage* atlas, const SkRSXform xforms[], const SkRect tex[], const SkColor colors[], int count, SkBlendMode mode, const SkSamplingOptions& sampling, const SkRect* cull, const SkPaint* paint) override {
+    Hasher hasher;
+    hasher.add(atlas->uniqueID());
+    hasher.add_array(xforms, count);
+    hasher.add_array(tex, count);
+    hasher.add_array(colors, colors ? count : 0);
+    hasher.add(mode);
+    hasher.add_sampling(sampling);
+    add_op(OpKind::kAtlas, hasher, cull, paint);
+  }
+
+  void onDrawVerticesObject(const SkVertices* vertices, SkBlendMode mode, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add(vertices->uniqueID());
+    hasher.add(mode);
+    add_op(OpKind::kVertices, hasher, &vertices->bounds(), &paint);
+  }
+
+  void onDrawPatch(const SkPoint cubics[12], const SkColor colors[4], const SkPoint texCoords[4], SkBlendMode mode, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add_array(cubics, 12);
+    hasher.add_array(colors, colors ? 4 : 0);
+    hasher.add_array(texCoords, texCoords ? 4 : 0);
+    hasher.add(mode);
+    // A Bézier patch lies within the convex hull of its control points.
+    SkRect bounds;
+    bounds.setBounds(cubics, 12);
+    add_op(OpKind::kPatch, hasher, &bounds, &paint);
+  }
+
+  void onDrawTextBlob(const SkTextBlob* blob, SkScalar x, SkScalar y, const SkPaint& paint) override {
+    Hasher hasher;
+    hasher.add(blob->uniqueID());
+    hasher.add(x);
+    hasher.add(y);
+    const SkRect bounds = blob->bounds().makeOffset(x, y);
+    add_op(OpKind::kTextBlob, hasher, &bounds, &paint);
+  }
+
+  void onDrawEdgeAAQuad(const SkRect& rect, const SkPoint clip[4], QuadAAFlags aa, const SkColor4f& color, SkBlendMode mode) override {
+    Hasher hasher;
+    hasher.add(rect);
+    hasher.add_array(clip, clip ? 4 : 0);
+    hasher.add(aa);
+    hasher.add(color);
+    hasher.add(mode);
+    add_op(OpKind::kEdgeAAQuad, hasher, &rect, nullptr);
+  }
+
+  void onDrawEdgeAAImageSet2(const ImageSetEntry set[], int count, const SkPoint dstClips[], const SkMatrix preViewMatrices[], const SkSamplingOptions& sampling, const SkPaint* paint, SrcRectConstraint constraint) override {
+    Hasher hasher;
+    int clip_count = 0;
+    int matrix_count = 0;
+    for (int i = 0; i < count; ++i) {
+      hasher.add(set[i].fImage->uniqueID());
+      hasher.add(set[i].fSrcRect);
+      hasher.add(set[i].fDstRect);
+      hasher.add(set[i].fMatrixIndex);
+      hasher.add(set[i].fAlpha);
+      hasher.add(set[i].fAAFlags);
+      hasher.add(set[i].fHasClip);
+      clip_count += set[i].fHasClip ? 4 : 0;
+      matrix_count = std::max(matrix_count, set[i].fMatrixIndex + 1);
+    }
+    hasher.add_array(dstClips, dstClips ? clip_count : 0);
+    for (int i = 0; i < matrix_count; ++i) {
+      SkScalar values[9];
+      preViewMatrices[i].get9(values);
+      hasher.add(values);
+    }
+    hasher.add_sampling(sampling);
+    hasher.add(constraint);
+    add_op(OpKind::kEdgeAAImageSet, hasher, nullptr, paint);
+  }
+
+  // Ops whose inputs can not be fully identified are always treated as
+  // changed.
+  void onDrawShadowRec(const SkPath&, const SkDrawShadowRec&) override {
+    add_opaque_op(nullptr);
+  }
+
+  void onDrawMesh(const SkMesh& mesh, sk_sp<SkBlender>, const SkPaint&) override {
+    add_opaque_op(&mesh.bounds());
+  }
+
+  void onDrawSlug(const sktext::gpu::Slug*, const SkPaint&) override {
+    add_opaque_op(nullptr);
+  }
+
+ private:
+  struct State {
+    uint64_t clip = 0;
+    std::optional<SkIRect> spread;
+  };
+
+  Hasher clip_hasher(int kind, SkClipOp op, ClipEdgeStyle style) {
+    Hasher hasher;
+    hasher.add(states_.back().clip);
+    hasher.add(kind);
+    hasher.add(op);
+    hasher.add(style);
+    add_matrix(hasher);
+    return hasher;
+  }
+
+  void add_matrix(Hasher& hasher) {
+    const SkM44 matrix = this->getLocalToDevice();
+    SkScalar values[16];
+    matrix.getColMajor(values);
+    hasher.add(values);
+  }
+
+  static void add_region(Hasher& hasher, const SkRegion& region) {
+    std::vector<uint8_t> buffer(region.writeToMemory(nullptr));
+    region.writeToMemory(buffer.data());
+    hasher.bytes(buffer.data(), buffer.size());
+  }
+
+  SkIRect device_bounds(const SkRect* local, const SkPaint* paint) {
+    SkIRect bounds = this->getDeviceClipBounds();
+    if (local && (!paint || paint->canComputeFastBounds())) {
+      SkRect storage;
+      const SkRect& outset = paint ? paint->computeFastBounds(*local, &storage) : *local;
+      // Outset by a pixel to cover anti-aliasing.
+      const SkIRect mapped = this->getTotalMatrix().mapRect(outset).roundOut().makeOutset(1, 1);
+      if (!bounds.intersect(mapped)) {
+        return SkIRect::MakeEmpty();
+      }
+    }
+    return bounds;
+  }
+
+  void add_op(OpKind kind, Hasher& hasher, const SkRect* local, const SkPaint* paint) {
+    SkIRect bounds = device_bounds(local, paint);
+    if (bounds.isEmpty()) {
+      return;
+    }
+    const State& state = states_.back();
+    if (state.spread) {
+      bounds = *state.spread;
+    }
+    hasher.add(kind);
+    if (paint) {
+      hasher.add_paint(*paint);
+    }
+    hasher.add(state.clip);
+    add_matrix(hasher);
+    ops_.push_back({hasher.value(), bounds});
+  }
+
+  void add_opaque_op(const SkRect* local) {
+    // Give each opaque op a distinct key so that it never matches anything.
+    static std::atomic<uint64_t> next_id{0};
+    Hasher hasher;
+    hasher.add(next_id.fetch_add(1, std::memory_order_relaxed));
+    add_op(OpKind::kOpaque, hasher, local, nullptr);
+  }
+
+  std::vector<State> states_;
+  std::vector<Op> ops_;
+};
+
+std::vector<Op> collect_ops(const SkPicture& picture, const SkMatrix& matrix, const SkIRect& device_bounds) {
+  OpCollector collector(device_bounds);
+  collector.concat(matrix);
+  picture.playback(&collector);
+  return std::move(collector.ops());
+}
+
+}  // namespace
+
+SkRegion compute_picture_damage(const SkPicture* previous, const SkPicture& current, const SkMatrix& matrix, const SkIRect& device_bounds) {
+  if (!previous) {
+    return SkRegion(device_bounds);
+  }
+  if (previous == &current) {
+    return SkRegion();
+  }
+
+  const std::vector<Op> before = collect_ops(*previous, matrix, device_bounds);
+  const std::vector<Op> after = collect_ops(current, matrix, device_bounds);
+
+  // Skip the common prefix and suffix; in the typical frame-to-frame case
+  // that leaves only a handful of ops to compare.
+  size_t prefix = 0;
+  while (prefix < before.size() && prefix < after.size() && before[prefix] == after[prefix]) {
+    ++prefix;
+  }
+  size_t suffix = 0;
+  while (suffix < before.size() - prefix && suffix < after.size() - prefix && before[before.size() - 1 - suffix] == after[after.size() - 1 - suffix]) {
+    ++suffix;
+  }
+  const size_t before_end = before.size() - suffix;
+  const size_t after_end = after.size() - suffix;
+
+  // Greedily match the remaining ops while preserving their relative order.
+  // A pixel is only left undamaged if every op touching it is matched, and
+  // matched ops keep their order, so its sequence of draws is unchanged.
+  struct Candidates {
+    std::vector<size_t> indices;
+    size_t next = 0;
+  };
+  std::unordered_map<Op, Candidates, OpHash> candidates;
+  for (size_t i = prefix; i < before_end; ++i) {
+    candidates[before[i]].indices.push_back(i);
+  }
+
+  std::vector<bool> matched(before.size(), false);
+  std::vector<SkIRect> damage;
+  size_t last_match = prefix;
+  for (size_t i = prefix; i < after_end; ++i) {
+    bool found = false;
+    auto it = candidates.find(after[i]);
+    if (it != candidates.end()) {
+      Candidates& c = it->second;
+      while (c.next < c.indices.size() && c.indices[c.next] < last_match) {
+        ++c.next;
+      }
+      if (c.next < c.indices.size()) {
+        last_match = c.indices[c.next++];
+        matched[last_match] = true;
+        ++last_match;
+        found = true;
+      }
+    }
+    if (!found) {
+      damage.push_back(after[i].bounds);
+    }
+  }
+  for (size_t i = prefix; i < before_end; ++i) {
+    if (!matched[i]) {
+      damage.push_back(before[i].bounds);
+    }
+  }
+
+  SkRegion region;
+  if (!damage.empty()) {
+    region.setRects(damage.data(), static_cast<int>(damage.size()));
+    region.op(device_bounds, SkRegion::kIntersect_Op);
+  }
+  return region;
+}
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "include/core/SkMatrix.h"
+#include "include/core/SkRect.h"
+#include "include/core/SkRegion.h"
+
+class SkPicture;
+
+// Computes the device-space area in which playing `current` back with `matrix`
+// into a canvas of `device_bounds` can produce different pixels than playing
+// back `previous`. Both pictures are flattened into lists of draw ops, each
+// keyed by its op type, geometry, paint, total matrix, clip and the ids of
+// the images, text blobs, paths and vertices it references. Ops are then
+// matched in order and the device bounds of every unmatched op on either side
+// are damaged.
+//
+// The result is conservative: equivalent content recorded with different
+// objects (for example, a shader recreated every frame) is reported as damage.
+// If `previous` is null, all of `device_bounds` is damaged.
+//
+// Repainting only the damage matches a full repaint only if `current` paints
+// the damaged area opaquely, for example by starting with a clear or an
+// opaque background. Where it draws translucently or not at all, a clipped
+// repaint blends over, or keeps, the stale pixels of `previous` instead of
+// the surface's initial contents.
+SkRegion compute_picture_damage(const SkPicture* previous, const SkPicture& current, const SkMatrix& matrix, const SkIRect& device_bounds);
@@ -0,0 +1,74 @@
+#include "pixel_convert.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+#include "include/core/SkImageInfo.h"
+#include "include/core/SkPixmap.h"
+#include "src/core/SkSwizzlePriv.h"
+#include "worker_pool.h"
+
+namespace {
+
+template <typename Fn>
+void run_chunks(size_t chunk_count, int max_threads, const Fn& fn) {
+  if (chunk_count <= 1 || max_threads == 1) {
+    for (size_t chunk = 0; chunk < chunk_count; ++chunk) {
+      fn(chunk);
+    }
+    return;
+  }
+  WorkerPool::shared().parallel_for(chunk_count, max_threads, fn);
+}
+
+void convert(const uint32_t* src, int count, uint32_t* dst, int max_threads, SkOpts::Swizzle_8888_u32 swizzle) {
+  if (count <= 0) {
+    return;
+  }
+  const size_t chunk_count = (static_cast<size_t>(count) + kParallelConvertPixels - 1) / kParallelConvertPixels;
+  run_chunks(chunk_count, max_threads, [&](size_t chunk) {
+    const int begin = static_cast<int>(chunk) * kParallelConvertPixels;
+    swizzle(dst + begin, src + begin, std::min(kParallelConvertPixels, count - begin));
+  });
+}
+
+}  // namespace
+
+// SkColor is a little endian ARGB word, so in memory it is BGRA. SkPMColor
+// has the same layout when it is BGRA, and with RGBA red and blue swap as well.
+void PremultiplyColors(const SkColor* src, int count, SkPMColor* dst, int max_threads, SkColorType pm_color_type) {
+  SkASSERT(pm_color_type == kBGRA_8888_SkColorType || pm_color_type == kRGBA_8888_SkColorType);
+  convert(src, count, dst, max_threads, pm_color_type == kBGRA_8888_SkColorType ? SkOpts::RGBA_to_rgbA : SkOpts::RGBA_to_bgrA);
+}
+
+void UnpremultiplyColors(const SkPMColor* src, int count, SkColor* dst, int max_threads, SkColorType pm_color_type) {
+  SkASSERT(pm_color_type == kBGRA_8888_SkColorType || pm_color_type == kRGBA_8888_SkColorType);
+  convert(src, count, dst, max_threads, pm_color_type == kBGRA_8888_SkColorType ? SkOpts::rgbA_to_RGBA : SkOpts::rgbA_to_BGRA);
+}
+
+bool ReadPixelColors(const SkPixmap& pixmap, SkColor* dst, int max_threads) {
+  if (!pixmap.addr() || pixmap.colorType() == kUnknown_SkColorType) {
+    return false;
+  }
+  const int width = pixmap.width();
+  const int height = pixmap.height();
+  if (width <= 0 || height <= 0) {
+    return true;
+  }
+  // Without a color space on either side readPixels converts only the pixel
+  // format, which takes the same SkOpts paths for 8888 sources.
+  const int rows_per_chunk = std::max(1, kParallelConvertPixels / width);
+  const size_t chunk_count = (height + rows_per_chunk - 1) / rows_per_chunk;
+  std::atomic<bool> read(true);
+  run_chunks(chunk_count, max_threads, [&](size_t chunk) {
+    const int top = static_cast<int>(chunk) * rows_per_chunk;
+    const int rows = std::min(rows_per_chunk, height - top);
+    SkPixmap band;
+    const SkImageInfo info = SkImageInfo::Make(width, rows, kBGRA_8888_SkColorType, kUnpremul_SkAlphaType);
+    if (!pixmap.extractSubset(&band, SkIRect::MakeXYWH(0, top, width, rows)) || !band.readPixels(info, dst + static_cast<size_t>(top) * width, info.minRowBytes())) {
+      read = false;
+    }
+  });
+  return read;
+}
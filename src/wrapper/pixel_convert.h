@@ -0,0 +1,30 @@
+#pragma once
+
+#include "include/core/SkColor.h"
+#include "include/core/SkImageInfo.h"
+
+class SkPixmap;
+
+// Bulk conversions behind the C API's color array functions.
+//
+// Colors are converted with Skia's SkOpts swizzlers, which pick SSSE3, AVX2
+// or NEON kernels for the running CPU. Buffers of more than
+// kParallelConvertPixels pixels are split into chunks of that size that run on
+// the shared worker pool, using at most `max_threads` threads including the
+// caller; 0 means no limit and 1 converts on the calling thread only.
+//
+// The kernels round differently from SkPreMultiplyColor and
+// SkUnPreMultiply::PMColorToColor, so a channel may differ from the scalar
+// result by one. `pm_color_type` is the byte order of the SkPMColors,
+// kBGRA_8888_SkColorType or kRGBA_8888_SkColorType; it defaults to N32 and is
+// only set otherwise to test the swizzles of other platforms.
+constexpr int kParallelConvertPixels = 1 << 18;
+
+void PremultiplyColors(const SkColor* src, int count, SkPMColor* dst, int max_threads = 0, SkColorType pm_color_type = kN32_SkColorType);
+void UnpremultiplyColors(const SkPMColor* src, int count, SkColor* dst, int max_threads = 0, SkColorType pm_color_type = kN32_SkColorType);
+
+// Writes the pixels of `pixmap` to `dst` as unpremultiplied SkColors, row
+// after row, ignoring the color space like SkBitmap::getColor. Results may
+// differ from getColor by one in the last bit of a channel. Returns false for
+// a pixmap without pixels or with an unknown color type.
+bool ReadPixelColors(const SkPixmap& pixmap, SkColor* dst, int max_threads = 0);
@@ -0,0 +1,133 @@
+#include "pixmap_compare.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "include/core/SkPixmap.h"
+#include "src/base/SkVx.h"
+
+namespace {
+
+constexpr int kPixelsPerVector = 8;
+
+using U8x32 = skvx::Vec<4 * kPixelsPerVector, uint8_t>;
+using U32x8 = skvx::Vec<kPixelsPerVector, uint32_t>;
+
+bool is_comparable(SkColorType color_type) {
+  switch (color_type) {
+    case kRGBA_8888_SkColorType:
+    case kBGRA_8888_SkColorType:
+    case kRGB_888x_SkColorType:
+    case kSRGBA_8888_SkColorType:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// The largest channel delta of each of the pixels at `a` and `b`.
+// `channel_mask` clears the channels that are not compared.
+U32x8 pixel_deltas(const uint8_t* a, const uint8_t* b, uint32_t channel_mask) {
+  const U8x32 va = U8x32::Load(a);
+  const U8x32 vb = U8x32::Load(b);
+  const U32x8 d = skvx::bit_pun<U32x8>(skvx::max(va, vb) - skvx::min(va, vb)) & channel_mask;
+  return skvx::max(skvx::max(d & 0xff, (d >> 8) & 0xff), skvx::max((d >> 16) & 0xff, d >> 24));
+}
+
+uint32_t pixel_delta(const uint8_t* a, const uint8_t* b, uint32_t channel_mask) {
+  uint32_t delta = 0;
+  for (int channel = 0; channel < 4; ++channel) {
+    if (channel_mask & (0xffu << (8 * channel))) {
+      delta = std::max<uint32_t>(delta, a[channel] > b[channel] ? a[channel] - b[channel] : b[channel] - a[channel]);
+    }
+  }
+  return delta;
+}
+
+uint8_t diff_value(uint32_t delta, uint32_t tolerance, PixmapDiffMode mode) {
+  if (mode == PixmapDiffMode::kDelta) {
+    return static_cast<uint8_t>(delta);
+  }
+  return delta > tolerance ? 0xff : 0;
+}
+
+}  // namespace
+
+bool ComparePixmaps(const SkPixmap& a, const SkPixmap& b, int tolerance, const PixmapCompareOptions& options, const SkPixmap* diff, PixmapCompareStats* stats) {
+  if (!a.addr() || !b.addr() || a.dimensions() != b.dimensions() || a.colorType() != b.colorType() || !is_comparable(a.colorType()) || tolerance < 0) {
+    return false;
+  }
+  if (diff && (!diff->addr() || diff->dimensions() != a.dimensions() || (diff->colorType() != kAlpha_8_SkColorType && diff->colorType() != kGray_8_SkColorType))) {
+    return false;
+  }
+
+  // Channels are bytes in memory, so the last one, alpha or padding, is the
+  // high byte of a little endian pixel.
+  const uint32_t channel_mask = options.ignore_alpha || a.colorType() == kRGB_888x_SkColorType ? 0x00ffffff : 0xffffffff;
+  const uint32_t threshold = static_cast<uint32_t>(std::min(tolerance, 255));
+  const int width = a.width();
+
+  U32x8 max_deltas(0);
+  uint32_t max_delta = 0;
+  int64_t different_pixels = 0;
+  int left = width, top = -1, right = -1, bottom = -1;
+
+  for (int y = 0; y < a.height(); ++y) {
+    const auto* row_a = static_cast<const uint8_t*>(a.addr(0, y));
+    const auto* row_b = static_cast<const uint8_t*>(b.addr(0, y));
+    uint8_t* row_diff = diff ? diff->writable_addr8(0, y) : nullptr;
+    int row_left = width, row_right = -1;
+    auto note_difference = [&](int x) {
+      row_left = std::min(row_left, x);
+      row_right = std::max(row_right, x);
+      ++different_pixels;
+    };
+
+    int x = 0;
+    for (; x + kPixelsPerVector <= width; x += kPixelsPerVector) {
+      const U32x8 deltas = pixel_deltas(row_a + 4 * x, row_b + 4 * x, channel_mask);
+      max_deltas = skvx::max(max_deltas, deltas);
+      const auto differs = deltas > threshold;
+      if (row_diff) {
+        const U32x8 values = options.diff_mode == PixmapDiffMode::kDelta ? deltas : skvx::if_then_else(differs, U32x8(0xff), U32x8(0));
+        skvx::cast<uint8_t>(values).store(row_diff + x);
+      }
+      if (skvx::any(differs)) {
+        for (int i = 0; i < kPixelsPerVector; ++i) {
+          if (deltas[i] > threshold) {
+            note_difference(x + i);
+          }
+        }
+      }
+    }
+    for (; x < width; ++x) {
+      const uint32_t delta = pixel_delta(row_a + 4 * x, row_b + 4 * x, channel_mask);
+      max_delta = std::max(max_delta, delta);
+      if (row_diff) {
+        row_diff[x] = diff_value(delta, threshold, options.diff_mode);
+      }
+      if (delta > threshold) {
+        note_difference(x);
+      }
+    }
+
+    if (row_right >= 0) {
+      left = std::min(left, row_left);
+      right = std::max(right, row_right);
+      if (top < 0) {
+        top = y;
+      }
+      bottom = y;
+    }
+  }
+
+  if (stats) {
+    for (int i = 0; i < kPixelsPerVector; ++i) {
+      max_delta = std::max(max_delta, max_deltas[i]);
+    }
+    stats->max_delta = static_cast<int>(max_delta);
+    stats->different_pixels = different_pixels;
+    stats->bounds = top < 0 ? SkIRect::MakeEmpty() : SkIRect::MakeLTRB(left, top, right + 1, bottom + 1);
+  }
+  return true;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <cstdint>
+
+#include "include/core/SkRect.h"
+
+class SkPixmap;
+
+enum class PixmapDiffMode {
+  // 255 where a pixel differs by more than the tolerance, 0 elsewhere.
+  kMask,
+  // The largest channel delta of each pixel.
+  kDelta,
+};
+
+struct PixmapCompareOptions {
+  bool ignore_alpha = false;
+  PixmapDiffMode diff_mode = PixmapDiffMode::kMask;
+};
+
+struct PixmapCompareStats {
+  int max_delta = 0;
+  int64_t different_pixels = 0;
+  // The smallest rectangle holding every differing pixel, empty if none.
+  SkIRect bounds = SkIRect::MakeEmpty();
+};
+
+// Compares two pixmaps of the same size and the same 32-bit color type with
+// 8-bit channels, channel by channel as stored. A pixel differs if any of its
+// channels differs by more than `tolerance`. The padding channel of
+// kRGB_888x is ignored.
+//
+// Eight pixels are compared at a time with skvx, which lowers to SSE, AVX2 or
+// NEON depending on the target, and only vectors holding a differing pixel
+// are looked at pixel by pixel.
+//
+// If `diff` is not null it must be a kAlpha_8 or kGray_8 pixmap of the same
+// size, which receives a visualization of the differences. Returns false,
+// writing nothing, if the pixmaps cannot be compared.
+bool ComparePixmaps(const SkPixmap& a, const SkPixmap& b, int tolerance, const PixmapCompareOptions& options, const SkPixmap* diff, PixmapCompareStats* stats);
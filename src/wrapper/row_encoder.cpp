@@ -0,0 +1,265 @@
+#include "row_encoder.h"
+
+#include <algorithm>
+#include <csetjmp>
+#include <cstdio>
+
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkStream.h"
+#include "png.h"
+
+extern "C" {
+#include "jpeglib.h"
+}
+
+RowEncoder::RowEncoder(const SkImageInfo& info, const SkImageInfo& row_info)
+    : info_(info), row_info_(row_info), row_(row_info.minRowBytes()) {}
+
+RowEncoder::~RowEncoder() = default;
+
+bool RowEncoder::write_rows(const SkPixmap& rows) {
+  if (failed_ || finished_ || !rows.addr() || rows.width() != info_.width() || rows.height() > info_.height() - rows_written_) {
+    return false;
+  }
+  for (int y = 0; y < rows.height(); ++y) {
+    const SkPixmap row(rows.info().makeWH(rows.width(), 1), rows.addr(0, y), rows.rowBytes());
+    if (!row.readPixels(row_info_, row_.data(), row_.size()) || !on_write_row(row_.data())) {
+      failed_ = true;
+      return false;
+    }
+    ++rows_written_;
+  }
+  return true;
+}
+
+bool RowEncoder::finish() {
+  if (failed_ || finished_ || rows_written_ != info_.height()) {
+    return false;
+  }
+  finished_ = true;
+  if (!on_finish()) {
+    failed_ = true;
+    return false;
+  }
+  return true;
+}
+
+namespace {
+
+// Both libraries report errors by calling back, which must not return, so
+// every call into them is guarded by a setjmp. The guarded functions keep no
+// objects with destructors on the stack.
+
+void png_error_fn(png_structp png, png_const_charp) {
+  png_longjmp(png, 1);
+}
+
+void png_warning_fn(png_structp, png_const_charp) {}
+
+void png_write_fn(png_structp png, png_bytep data, size_t length) {
+  if (!static_cast<SkWStream*>(png_get_io_ptr(png))->write(data, length)) {
+    png_error(png, "write failed");
+  }
+}
+
+void png_flush_fn(png_structp png) {
+  static_cast<SkWStream*>(png_get_io_ptr(png))->flush();
+}
+
+class PngRowEncoder final : public RowEncoder {
+ public:
+  PngRowEncoder(const SkImageInfo& info, png_structp png, png_infop png_info)
+      : RowEncoder(info, SkImageInfo::Make(info.width(), 1, kRGBA_8888_SkColorType, kUnpremul_SkAlphaType, SkColorSpace::MakeSRGB())),
+        png_(png),
+        png_info_(png_info) {}
+
+  ~PngRowEncoder() override { png_destroy_write_struct(&png_, &png_info_); }
+
+  bool start(SkWStream* dst, const SkPngEncoder::Options& options) {
+    if (setjmp(png_jmpbuf(png_))) {
+      return false;
+    }
+    png_set_write_fn(png_, dst, png_write_fn, png_flush_fn);
+    // Opaque images are written without the alpha channel, which libpng
+    // strips from the RGBA rows as filler.
+    const bool opaque = info().isOpaque();
+    png_set_IHDR(png_, png_info_, info().width(), info().height(), 8, opaque ? PNG_COLOR_TYPE_RGB : PNG_COLOR_TYPE_RGB_ALPHA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_BASE, PNG_FILTER_TYPE_BASE);
+    png_set_filter(png_, PNG_FILTER_TYPE_BASE, static_cast<int>(options.fFilterFlags));
+    png_set_compression_level(png_, std::clamp(options.fZLibLevel, 0, 9));
+    png_write_info(png_, png_info_);
+    if (opaque) {
+      png_set_filler(png_, 0, PNG_FILLER_AFTER);
+    }
+    return true;
+  }
+
+ private:
+  bool on_write_row(const void* row) override {
+    if (setjmp(png_jmpbuf(png_))) {
+      return false;
+    }
+    png_write_row(png_, static_cast<png_const_bytep>(row));
+    return true;
+  }
+
+  bool on_finish() override {
+    if (setjmp(png_jmpbuf(png_))) {
+      return false;
+    }
+    png_write_end(png_, png_info_);
+    png_write_flush(png_);
+    return true;
+  }
+
+  png_structp png_;
+  png_infop png_info_;
+};
+
+struct JpegErrorManager : jpeg_error_mgr {
+  jmp_buf jump;
+};
+
+void jpeg_error_exit(j_common_ptr cinfo) {
+  longjmp(static_cast<JpegErrorManager*>(cinfo->err)->jump, 1);
+}
+
+void jpeg_output_message(j_common_ptr) {}
+
+struct JpegDestination : jpeg_destination_mgr {
+  static constexpr size_t kBufferSize = 4096;
+
+  SkWStream* stream;
+  JOCTET buffer[kBufferSize];
+};
+
+void jpeg_init_destination(j_compress_ptr cinfo) {
+  auto* dst = static_cast<JpegDestination*>(cinfo->dest);
+  dst->next_output_byte = dst->buffer;
+  dst->free_in_buffer = JpegDestination::kBufferSize;
+}
+
+boolean jpeg_empty_output_buffer(j_compress_ptr cinfo) {
+  // Called when the buffer is full; free_in_buffer is not meaningful here.
+  auto* dst = static_cast<JpegDestination*>(cinfo->dest);
+  if (!dst->stream->write(dst->buffer, JpegDestination::kBufferSize)) {
+    cinfo->err->error_exit(reinterpret_cast<j_common_ptr>(cinfo));
+  }
+  dst->next_output_byte = dst->buffer;
+  dst->free_in_buffer = JpegDestination::kBufferSize;
+  return TRUE;
+}
+
+void jpeg_term_destination(j_compress_ptr cinfo) {
+  auto* dst = static_cast<JpegDestination*>(cinfo->dest);
+  const size_t size = JpegDestination::kBufferSize - dst->free_in_buffer;
+  if (size > 0 && !dst->stream->write(dst->buffer, size)) {
+    cinfo->err->error_exit(reinterpret_cast<j_common_ptr>(cinfo));
+  }
+  dst->stream->flush();
+}
+
+class JpegRowEncoder final : public RowEncoder {
+ public:
+  // Blending on black is what premultiplying does to the color channels,
+  // which libjpeg then reads ignoring alpha.
+  JpegRowEncoder(const SkImageInfo& info, const SkJpegEncoder::Options& options)
+      : RowEncoder(info, SkImageInfo::Make(info.width(), 1, kRGBA_8888_SkColorType, options.fAlphaOption == SkJpegEncoder::AlphaOption::kBlendOnBlack ? kPremul_SkAlphaType : kUnpremul_SkAlphaType, SkColorSpace::MakeSRGB())) {}
+
+  ~JpegRowEncoder() override { jpeg_destroy_compress(&cinfo_); }
+
+  bool start(SkWStream* dst, const SkJpegEncoder::Options& options) {
+    cinfo_.err = jpeg_std_error(&error_);
+    error_.error_exit = jpeg_error_exit;
+    error_.output_message = jpeg_output_message;
+    if (setjmp(error_.jump)) {
+      return false;
+    }
+    jpeg_create_compress(&cinfo_);
+    destination_.stream = dst;
+    destination_.init_destination = jpeg_init_destination;
+    destination_.empty_output_buffer = jpeg_empty_output_buffer;
+    destination_.term_destination = jpeg_term_destination;
+    cinfo_.dest = &destination_;
+
+    cinfo_.image_width = info().width();
+    cinfo_.image_height = info().height();
+    cinfo_.input_components = 4;
+    cinfo_.in_color_space = JCS_EXT_RGBA;
+    jpeg_set_defaults(&cinfo_);
+    jpeg_set_quality(&cinfo_, std::clamp(options.fQuality, 0, 100), TRUE);
+    // The luma component's sampling factors set the chroma subsampling.
+    switch (options.fDownsample) {
+      case SkJpegEncoder::Downsample::k420:
+        cinfo_.comp_info[0].h_samp_factor = 2;
+        cinfo_.comp_info[0].v_samp_factor = 2;
+        break;
+      case SkJpegEncoder::Downsample::k422:
+        cinfo_.comp_info[0].h_samp_factor = 2;
+        cinfo_.comp_info[0].v_samp_factor = 1;
+        break;
+      case SkJpegEncoder::Downsample::k444:
+        cinfo_.comp_info[0].h_samp_factor = 1;
+        cinfo_.comp_info[0].v_samp_factor = 1;
+        break;
+    }
+    jpeg_start_compress(&cinfo_, TRUE);
+    return true;
+  }
+
+ private:
+  bool on_write_row(const void* row) override {
+    if (setjmp(error_.jump)) {
+      return false;
+    }
+    JSAMPROW rows[] = {const_cast<JSAMPLE*>(static_cast<const JSAMPLE*>(row))};
+    jpeg_write_scanlines(&cinfo_, rows, 1);
+    return true;
+  }
+
+  bool on_finish() override {
+    if (setjmp(error_.jump)) {
+      return false;
+    }
+    jpeg_finish_compress(&cinfo_);
+    return true;
+  }
+
+  // Zeroed so that destroying an encoder that failed to start is safe.
+  jpeg_compress_struct cinfo_ = {};
+  JpegErrorManager error_ = {};
+  JpegDestination destination_ = {};
+};
+
+}  // namespace
+
+std::unique_ptr<RowEncoder> RowEncoder::MakePng(SkWStream* dst, const SkImageInfo& info, const SkPngEncoder::Options& options) {
+  if (!dst || info.isEmpty()) {
+    return nullptr;
+  }
+  png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, nullptr, png_error_fn, png_warning_fn);
+  if (!png) {
+    return nullptr;
+  }
+  png_infop png_info = png_create_info_struct(png);
+  if (!png_info) {
+    png_destroy_write_struct(&png, nullptr);
+    return nullptr;
+  }
+  auto encoder = std::make_unique<PngRowEncoder>(info, png, png_info);
+  if (!encoder->start(dst, options)) {
+    return nullptr;
+  }
+  return encoder;
+}
+
+std::unique_ptr<RowEncoder> RowEncoder::MakeJpeg(SkWStream* dst, const SkImageInfo& info, const SkJpegEncoder::Options& options) {
+  if (!dst || info.isEmpty()) {
+    return nullptr;
+  }
+  auto encoder = std::make_unique<JpegRowEncoder>(info, options);
+  if (!encoder->start(dst, options)) {
+    return nullptr;
+  }
+  return encoder;
+}
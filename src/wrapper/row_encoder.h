@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "include/core/SkImageInfo.h"
+#include "include/encode/SkJpegEncoder.h"
+#include "include/encode/SkPngEncoder.h"
+
+class SkPixmap;
+class SkWStream;
+
+// Encodes an image to a stream a few rows at a time, keeping a single row of
+// converted pixels, so an image never has to be held in memory as a whole.
+//
+// SkPngEncoder and SkJpegEncoder read their rows from one pixmap spanning the
+// whole image, so PNG is written with libpng and JPEG with libjpeg-turbo
+// directly, honoring the same options. Images are written as 8-bit sRGB
+// without an embedded color profile; JPEG XMP metadata and origin are not
+// written.
+class RowEncoder {
+ public:
+  // Returns null if `info` is empty or the encoder cannot start the image.
+  static std::unique_ptr<RowEncoder> MakePng(SkWStream* dst, const SkImageInfo& info, const SkPngEncoder::Options& options);
+  static std::unique_ptr<RowEncoder> MakeJpeg(SkWStream* dst, const SkImageInfo& info, const SkJpegEncoder::Options& options);
+
+  virtual ~RowEncoder();
+
+  RowEncoder(const RowEncoder&) = delete;
+  RowEncoder& operator=(const RowEncoder&) = delete;
+
+  const SkImageInfo& info() const { return info_; }
+  int rows_written() const { return rows_written_; }
+
+  // Encodes the next rows of the image from `rows`, which must be as wide as
+  // the image and is converted from its color and alpha type. Fails if it
+  // has more rows than remain, or once an earlier call has failed.
+  bool write_rows(const SkPixmap& rows);
+
+  // Completes the image. Fails unless every row has been written.
+  bool finish();
+
+ protected:
+  // `row_info` describes one row in the pixel format the encoder consumes.
+  RowEncoder(const SkImageInfo& info, const SkImageInfo& row_info);
+
+  virtual bool on_write_row(const void* row) = 0;
+  virtual bool on_finish() = 0;
+
+ private:
+  SkImageInfo info_;
+  SkImageInfo row_info_;
+  std::vector<uint8_t> row_;
+  int rows_written_ = 0;
+  bool failed_ = false;
+  bool finished_ = false;
+};
@@ -4,9 +4,12 @@
 
 std::atomic_bool RunLoop::initialized_ = false;
 
-std::unordered_map<const void*, int64_t> RunLoop::object_to_handle_;
-std::unordered_map<const void*, int64_t> RunLoop::object_ref_count_;
-std::mutex RunLoop::object_to_handle_mutex_;
+IsolateHandleTable RunLoop::isolate_handles_;
+
+std::unordered_map<int64_t, RunLoop::DestroyBatch*> RunLoop::pending_destroys_;
+std::unordered_set<int64_t> RunLoop::shut_down_isolates_;
+std::deque<int64_t> RunLoop::shut_down_order_;
+std::mutex RunLoop::pending_destroys_mutex_;
 
 void RunLoop::initialize(void* dart_api_dl_data) {
   if (!initialized_.exchange(true)) {
@@ -35,52 +38,113 @@ bool RunLoop::schedule(int64_t handle, void (*callback)(void*), void* callback_d
 }
 
 void RunLoop::set_isolate_handle_(const void* object, int64_t handle) {
-  std::lock_guard<std::mutex> lock(object_to_handle_mutex_);
-  object_to_handle_[object] = handle;
-
-  auto insert = object_ref_count_.insert({object, 1});
-  if (!insert.second) {
-    insert.first->second++;
-  }
+  isolate_handles_.set(object, handle);
 }
 
 void RunLoop::ref_isolate_handle_(const void* object) {
-  std::lock_guard<std::mutex> lock(object_to_handle_mutex_);
-  auto it = object_ref_count_.find(object);
-  if (it != object_ref_count_.end()) {
-    it->second++;
-  }
+  isolate_handles_.ref(object);
 }
 
 std::optional<int64_t> RunLoop::get_isolate_handle_(const void* object) {
-  std::lock_guard<std::mutex> lock(object_to_handle_mutex_);
-  auto it = object_to_handle_.find(object);
-  if (it != object_to_handle_.end()) {
-    return it->second;
-  }
-  return std::nullopt;
+  return isolate_handles_.get(object);
 }
 
 bool RunLoop::destroy_(const void* object, void (*destroyer)(const void*)) {
-  std::optional<int64_t> handle;
-  {
-    std::lock_guard<std::mutex> lock(object_to_handle_mutex_);
-    auto it = object_to_handle_.find(object);
-    if (it != object_to_handle_.end()) {
-      handle = it->second;
-      auto ref_it = object_ref_count_.find(object);
-      --ref_it->second;
-      bool last_ref = ref_it->second == 0;
-      if (last_ref) {
-        object_ref_count_.erase(ref_it);
-        object_to_handle_.erase(it);
-      }
-    }
-  }
+  std::optional<int64_t> handle = isolate_handles_.unref(object);
   if (handle) {
-    return schedule(*handle, reinterpret_cast<void (*)(void*)>(destroyer), const_cast<void*>(object));
+    return enqueue_destroy_(*handle, object, destroyer);
   } else {
     destroyer(object);
     return true;
   }
+}
+
+bool RunLoop::enqueue_destroy_(int64_t isolate_handle, const void* object, void (*destroyer)(const void*)) {
+  DestroyBatch* new_batch = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(pending_destroys_mutex_);
+    if (shut_down_isolates_.count(isolate_handle)) {
+      return false;
+    }
+    DestroyBatch*& batch = pending_destroys_[isolate_handle];
+    if (!batch) {
+      batch = new_batch = new DestroyBatch{isolate_handle, {}};
+    }
+    batch->destroys.push_back({object, destroyer});
+  }
+
+  if (!new_batch || schedule(isolate_handle, &RunLoop::run_destroy_batch_, new_batch)) {
+    return true;
+  }
+
+  // The isolate is gone. As with an individual message that failed to post,
+  // the queued objects can not be destroyed safely and are leaked.
+  {
+    std::lock_guard<std::mutex> lock(pending_destroys_mutex_);
+    pending_destroys_.erase(isolate_handle);
+  }
+  delete new_batch;
+  return false;
+}
+
+void RunLoop::run_destroy_batch_(void* data) {
+  DestroyBatch* batch = static_cast<DestroyBatch*>(data);
+  std::vector<PendingDestroy> destroys;
+  {
+    std::lock_guard<std::mutex> lock(pending_destroys_mutex_);
+    pending_destroys_.erase(batch->isolate_handle);
+    destroys.swap(batch->destroys);
+  }
+  delete batch;
+  run_destroys_(destroys);
+}
+
+void RunLoop::flush(int64_t isolate_handle) {
+  std::vector<PendingDestroy> destroys;
+  {
+    std::lock_guard<std::mutex> lock(pending_destroys_mutex_);
+    auto it = pending_destroys_.find(isolate_handle);
+    if (it == pending_destroys_.end()) {
+      return;
+    }
+    // The batch stays registered until its message arrives, so destroyers
+    // queued from now on are picked up by that message.
+    destroys.swap(it->second->destroys);
+  }
+  run_destroys_(destroys);
+}
+
+void RunLoop::run_destroys_(const std::vector<PendingDestroy>& destroys) {
+  for (const PendingDestroy& pending : destroys) {
+    pending.destroyer(pending.object);
+  }
+}
+
+size_t RunLoop::pending_destroy_count(int64_t isolate_handle) {
+  std::lock_guard<std::mutex> lock(pending_destroys_mutex_);
+  auto it = pending_destroys_.find(isolate_handle);
+  return it == pending_destroys_.end() ? 0 : it->second->destroys.size();
+}
+
+void RunLoop::shutdown(int64_t isolate_handle) {
+  DestroyBatch* batch = nullptr;
+  {
+    std::lock_guard<std::mutex> lock(pending_destroys_mutex_);
+    if (shut_down_isolates_.insert(isolate_handle).second) {
+      shut_down_order_.push_back(isolate_handle);
+      if (shut_down_order_.size() > kMaxShutDownIsolates) {
+        shut_down_isolates_.erase(shut_down_order_.front());
+        shut_down_order_.pop_front();
+      }
+    }
+    auto it = pending_destroys_.find(isolate_handle);
+    if (it != pending_destroys_.end()) {
+      batch = it->second;
+      pending_destroys_.erase(it);
+    }
+  }
+  // The message carrying the batch will never be handled. Its objects belong
+  // to the isolate's GPU context, which may already be gone, so they are
+  // leaked like those whose message failed to post.
+  delete batch;
 }
\ No newline at end of file
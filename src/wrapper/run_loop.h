@@ -1,9 +1,14 @@
 #pragma once
 
 #include <atomic>
+#include <deque>
 #include <mutex>
 #include <optional>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "isolate_handle_table.h"
 
 class RunLoop {
  public:
@@ -45,20 +50,60 @@ class RunLoop {
 
   // If the object has a registered isolate handle, schedules the destroyer to be
   // called on that isolate. Otherwise calls the destroyer directly.
+  // Destroyers scheduled for the same isolate are queued and run as a single
+  // batch: the first one posts a message to the isolate and every destroyer
+  // queued before that message is handled runs with it.
   template <typename T>
   static bool destroy(const T* object, void (*destroyer)(const T*)) {
     return destroy_(object, reinterpret_cast<void (*)(const void*)>(destroyer));
   }
 
+  // Runs all destroyers queued for the isolate immediately instead of waiting
+  // for the isolate to handle the pending message.
+  // Must be called on the isolate with the given handle.
+  static void flush(int64_t isolate_handle);
+
+  // Returns the number of destroyers queued for the isolate.
+  static size_t pending_destroy_count(int64_t isolate_handle);
+
+  // Called when the isolate shuts down. Its queued destroyers can no longer
+  // run, so the batch is dropped and the objects leaked; destroy returns
+  // false for objects of the isolate from then on.
+  static void shutdown(int64_t isolate_handle);
+
  private:
   static void set_isolate_handle_(const void* object, int64_t handle);
   static void ref_isolate_handle_(const void* object);
   static std::optional<int64_t> get_isolate_handle_(const void* object);
   static bool destroy_(const void* object, void (*destroyer)(const void*));
 
+  struct PendingDestroy {
+    const void* object;
+    void (*destroyer)(const void*);
+  };
+
+  // Destroyers queued for one isolate. A batch is in pending_destroys_ from
+  // the moment its message is posted until the isolate handles it.
+  struct DestroyBatch {
+    int64_t isolate_handle;
+    std::vector<PendingDestroy> destroys;
+  };
+
+  static bool enqueue_destroy_(int64_t isolate_handle, const void* object, void (*destroyer)(const void*));
+  static void run_destroy_batch_(void* batch);
+  static void run_destroys_(const std::vector<PendingDestroy>& destroys);
+
   static std::atomic_bool initialized_;
 
-  static std::unordered_map<const void*, int64_t> object_to_handle_;
-  static std::unordered_map<const void*, int64_t> object_ref_count_;
-  static std::mutex object_to_handle_mutex_;
+  static IsolateHandleTable isolate_handles_;
+
+  static std::unordered_map<int64_t, DestroyBatch*> pending_destroys_;
+  // Shut down isolates, whose port may still accept messages that will never
+  // be handled. Once the port is closed, posting fails and enqueue_destroy_
+  // gives up on its own, so only the most recent kMaxShutDownIsolates are
+  // remembered, oldest first in shut_down_order_.
+  static constexpr size_t kMaxShutDownIsolates = 64;
+  static std::unordered_set<int64_t> shut_down_isolates_;
+  static std::deque<int64_t> shut_down_order_;
+  static std::mutex pending_destroys_mutex_;
 };
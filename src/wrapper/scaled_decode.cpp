@@ -0,0 +1,89 @@
+#include "scaled_decode.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSamplingOptions.h"
+
+namespace {
+
+uint64_t nanos_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+SkISize resolve_decode_size(SkISize encoded, int width, int height) {
+  if (width <= 0 && height <= 0) {
+    return encoded;
+  }
+  if (width <= 0) {
+    width = std::max(1, static_cast<int>(std::lround(static_cast<double>(encoded.width()) * height / encoded.height())));
+  } else if (height <= 0) {
+    height = std::max(1, static_cast<int>(std::lround(static_cast<double>(encoded.height()) * width / encoded.width())));
+  }
+  return SkISize::Make(width, height);
+}
+
+ScaledDecode decode_scaled(sk_sp<SkData> data, int width, int height, SkColorType color_type, sk_sp<SkColorSpace> color_space, SkBitmap* bitmap) {
+  ScaledDecode decode;
+  const auto decode_start = std::chrono::steady_clock::now();
+  std::unique_ptr<SkCodec> codec = data ? SkCodec::MakeFromData(std::move(data)) : nullptr;
+  if (!codec) {
+    decode.decode_ns = nanos_since(decode_start);
+    return decode;
+  }
+
+  SkImageInfo info = codec->getInfo();
+  if (color_type != kUnknown_SkColorType) {
+    info = info.makeColorType(color_type);
+  }
+  if (color_space) {
+    info = info.makeColorSpace(std::move(color_space));
+  }
+  // Resampling is only correct on premultiplied pixels.
+  if (info.alphaType() == kUnpremul_SkAlphaType) {
+    info = info.makeAlphaType(kPremul_SkAlphaType);
+  }
+  const SkISize target = resolve_decode_size(info.dimensions(), width, height);
+
+  SkISize decoded = info.dimensions();
+  if (target.width() < decoded.width() || target.height() < decoded.height()) {
+    const float scale = std::max(static_cast<float>(target.width()) / decoded.width(), static_cast<float>(target.height()) / decoded.height());
+    const SkISize scaled = codec->getScaledDimensions(scale);
+    // Never pick a native scale that would have to be upsampled again.
+    if (scaled.width() >= target.width() && scaled.height() >= target.height()) {
+      decoded = scaled;
+    }
+  }
+  decode.decoded_size = decoded;
+
+  SkBitmap decoded_bitmap;
+  if (!decoded_bitmap.tryAllocPixels(info.makeDimensions(decoded))) {
+    decode.result = SkCodec::kInternalError;
+    decode.decode_ns = nanos_since(decode_start);
+    return decode;
+  }
+  decode.result = codec->getPixels(decoded_bitmap.pixmap());
+  decode.decode_ns = nanos_since(decode_start);
+  if (decode.result != SkCodec::kSuccess && decode.result != SkCodec::kIncompleteInput) {
+    return decode;
+  }
+
+  if (decoded != target) {
+    const auto resize_start = std::chrono::steady_clock::now();
+    SkBitmap resized;
+    if (!resized.tryAllocPixels(info.makeDimensions(target)) ||
+        !decoded_bitmap.pixmap().scalePixels(resized.pixmap(), SkSamplingOptions(SkCubicResampler::Mitchell()))) {
+      decode.result = SkCodec::kInternalError;
+      return decode;
+    }
+    decoded_bitmap = std::move(resized);
+    decode.resize_ns = nanos_since(resize_start);
+  }
+  decoded_bitmap.setImmutable();
+  *bitmap = std::move(decoded_bitmap);
+  return decode;
+}
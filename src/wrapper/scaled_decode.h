@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+
+#include "include/codec/SkCodec.h"
+#include "include/core/SkBitmap.h"
+#include "include/core/SkColorSpace.h"
+#include "include/core/SkData.h"
+#include "include/core/SkSize.h"
+
+struct ScaledDecode {
+  SkCodec::Result result = SkCodec::kInvalidInput;
+  // The size the codec decoded at before resizing to the requested size.
+  SkISize decoded_size = SkISize::MakeEmpty();
+  uint64_t decode_ns = 0;
+  uint64_t resize_ns = 0;
+};
+
+// Resolves a requested size against the encoded one: a zero dimension follows
+// the aspect ratio of the encoded image, and if both are zero the encoded size
+// is kept.
+SkISize resolve_decode_size(SkISize encoded, int width, int height);
+
+// Decodes `data` into `bitmap` at the requested size (see
+// resolve_decode_size). When that is smaller than the encoded image, the
+// codec decodes at the smallest natively supported size that still covers it
+// and the result is resampled from there. kUnknown_SkColorType and a null
+// color space keep what the codec suggests. The bitmap is premultiplied and
+// immutable, and is only set if decoding (at least partially) succeeded.
+ScaledDecode decode_scaled(sk_sp<SkData> data, int width, int height, SkColorType color_type, sk_sp<SkColorSpace> color_space, SkBitmap* bitmap);
@@ -0,0 +1,87 @@
+#include "shaper_buffer.h"
+
+#include <algorithm>
+
+#include "include/core/SkFontMetrics.h"
+
+// Lays lines out like SkTextBlobBuilderRunHandler, writing glyphs straight
+// into the buffer's arrays.
+class ShaperBuffer::Handler final : public SkShaper::RunHandler {
+ public:
+  Handler(ShaperBuffer* buffer, uint32_t text_index) : buffer_(buffer), text_index_(text_index) {}
+
+  void beginLine() override {
+    line_ = {text_index_, static_cast<uint32_t>(buffer_->runs_.size()), 0, top_, top_, top_, 0};
+    max_ascent_ = 0;
+    max_descent_ = 0;
+    max_leading_ = 0;
+    x_ = 0;
+  }
+
+  void runInfo(const RunInfo& info) override {
+    SkFontMetrics metrics;
+    info.fFont.getMetrics(&metrics);
+    max_ascent_ = std::max(max_ascent_, -metrics.fAscent);
+    max_descent_ = std::max(max_descent_, metrics.fDescent);
+    max_leading_ = std::max(max_leading_, metrics.fLeading);
+  }
+
+  void commitRunInfo() override { line_.fBaseline = top_ + max_ascent_; }
+
+  Buffer runBuffer(const RunInfo& info) override {
+    const size_t offset = buffer_->glyphs_.size();
+    const size_t count = offset + info.glyphCount;
+    buffer_->glyphs_.resize(count);
+    buffer_->positions_.resize(count);
+    buffer_->clusters_.resize(count);
+    buffer_->runs_.push_back({static_cast<uint32_t>(offset), static_cast<uint32_t>(info.glyphCount), static_cast<uint32_t>(info.utf8Range.begin()), static_cast<uint32_t>(info.utf8Range.end()), buffer_->font_index(info.fFont), info.fAdvance.fX, info.fBidiLevel});
+    // Without an offsets array the shaper folds glyph offsets into positions.
+    return {buffer_->glyphs_.data() + offset, buffer_->positions_.data() + offset, nullptr, buffer_->clusters_.data() + offset, {x_, line_.fBaseline}};
+  }
+
+  void commitRunBuffer(const RunInfo& info) override { x_ += info.fAdvance.fX; }
+
+  void commitLine() override {
+    line_.fRunCount = static_cast<uint32_t>(buffer_->runs_.size()) - line_.fRunOffset;
+    line_.fBottom = line_.fBaseline + max_descent_ + max_leading_;
+    line_.fWidth = x_;
+    buffer_->lines_.push_back(line_);
+    top_ = line_.fBottom;
+  }
+
+ private:
+  ShaperBuffer* buffer_;
+  uint32_t text_index_;
+  sk_shaper_buffer_line_t line_ = {};
+  float top_ = 0;
+  float max_ascent_ = 0;
+  float max_descent_ = 0;
+  float max_leading_ = 0;
+  float x_ = 0;
+};
+
+void ShaperBuffer::clear() {
+  glyphs_.clear();
+  positions_.clear();
+  clusters_.clear();
+  runs_.clear();
+  lines_.clear();
+  fonts_.clear();
+}
+
+void ShaperBuffer::shape(const SkShaper& shaper, uint32_t text_index, const char* utf8, size_t length, const SkFont& font, bool left_to_right, float width) {
+  Handler handler(this, text_index);
+  shaper.shape(utf8, length, font, left_to_right, width, &handler);
+}
+
+uint32_t ShaperBuffer::font_index(const SkFont& font) {
+  // Runs of a batch use few distinct fonts, and consecutive runs usually
+  // share one, so search from the most recently added.
+  for (size_t i = fonts_.size(); i > 0; --i) {
+    if (fonts_[i - 1] == font) {
+      return static_cast<uint32_t>(i - 1);
+    }
+  }
+  fonts_.push_back(font);
+  return static_cast<uint32_t>(fonts_.size() - 1);
+}
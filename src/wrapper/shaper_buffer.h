@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "include/core/SkFont.h"
+#include "include/core/SkPoint.h"
+#include "modules/skshaper/include/SkShaper.h"
+#include "wrapper/include/sk_shaper.h"
+
+// Flat results of shaping a batch of texts: the glyph ids, positions and
+// clusters of every glyph in shared arrays, indexed by run and line records.
+// clear() keeps the allocations, so a buffer that is reused for every batch
+// stops allocating once it has grown to fit the largest one.
+class ShaperBuffer {
+ public:
+  void clear();
+  // Shapes one text and appends its lines, recording `text_index` in them.
+  void shape(const SkShaper& shaper, uint32_t text_index, const char* utf8, size_t length, const SkFont& font, bool left_to_right, float width);
+
+  const std::vector<SkGlyphID>& glyphs() const { return glyphs_; }
+  const std::vector<SkPoint>& positions() const { return positions_; }
+  const std::vector<uint32_t>& clusters() const { return clusters_; }
+  const std::vector<sk_shaper_buffer_run_t>& runs() const { return runs_; }
+  const std::vector<sk_shaper_buffer_line_t>& lines() const { return lines_; }
+  const std::vector<SkFont>& fonts() const { return fonts_; }
+
+ private:
+  class Handler;
+
+  uint32_t font_index(const SkFont& font);
+
+  std::vector<SkGlyphID> glyphs_;
+  std::vector<SkPoint> positions_;
+  std::vector<uint32_t> clusters_;
+  std::vector<sk_shaper_buffer_run_t> runs_;
+  std::vector<sk_shaper_buffer_line_t> lines_;
+  // Distinct fonts of the runs, usually one per text plus fallbacks.
+  std::vector<SkFont> fonts_;
+};
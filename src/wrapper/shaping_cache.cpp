@@ -0,0 +1,92 @@
+#include "shaping_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <string_view>
+
+#include "include/core/SkTypeface.h"
+
+namespace {
+
+std::mutex& RegistryMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<ShapingCache*>& Registry() {
+  static std::vector<ShapingCache*> caches;
+  return caches;
+}
+
+void Mix(size_t* hash, size_t value) {
+  *hash ^= value + static_cast<size_t>(0x9e3779b97f4a7c15ull) + (*hash << 6) + (*hash >> 2);
+}
+
+uint32_t FloatBits(float value) {
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+uint32_t FontFlags(const SkFont& font) {
+  return static_cast<uint32_t>(font.isForceAutoHinting()) | static_cast<uint32_t>(font.isEmbeddedBitmaps()) << 1 | static_cast<uint32_t>(font.isSubpixel()) << 2 | static_cast<uint32_t>(font.isLinearMetrics()) << 3 | static_cast<uint32_t>(font.isEmbolden()) << 4 | static_cast<uint32_t>(font.isBaselineSnap()) << 5 | static_cast<uint32_t>(font.getEdging()) << 8 | static_cast<uint32_t>(font.getHinting()) << 12;
+}
+
+size_t WordBytes(const ShapingCache::Key& key, const ShapingCache::Word& word) {
+  const size_t glyphs = word.glyphs.size();
+  return sizeof(ShapingCache::Key) + key.text.size() + key.language.size() + sizeof(ShapingCache::Word) + glyphs * (sizeof(SkGlyphID) + 2 * sizeof(SkPoint) + sizeof(uint32_t));
+}
+
+}  // namespace
+
+bool ShapingCache::Key::operator==(const Key& other) const {
+  return typeface_id == other.typeface_id && FloatBits(size) == FloatBits(other.size) && FloatBits(scale_x) == FloatBits(other.scale_x) && FloatBits(skew_x) == FloatBits(other.skew_x) && font_flags == other.font_flags && script == other.script && bidi_level == other.bidi_level && text == other.text && language == other.language;
+}
+
+size_t ShapingCache::KeyHash::operator()(const Key& key) const {
+  size_t hash = std::hash<std::string_view>()(key.text);
+  Mix(&hash, key.typeface_id);
+  Mix(&hash, FloatBits(key.size));
+  Mix(&hash, FloatBits(key.scale_x));
+  Mix(&hash, FloatBits(key.skew_x));
+  Mix(&hash, key.font_flags);
+  Mix(&hash, key.script);
+  Mix(&hash, std::hash<std::string_view>()(key.language));
+  Mix(&hash, key.bidi_level);
+  return hash;
+}
+
+ShapingCache::ShapingCache(size_t budget) : cache_(budget) {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  Registry().push_back(this);
+}
+
+ShapingCache::~ShapingCache() {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  auto& caches = Registry();
+  caches.erase(std::remove(caches.begin(), caches.end(), this), caches.end());
+}
+
+ShapingCache::Key ShapingCache::MakeKey(const char* utf8, size_t length, const SkFont& font, uint32_t script, const char* language, uint8_t bidi_level) {
+  return {std::string(utf8, length), font.getTypeface() ? font.getTypeface()->uniqueID() : 0, font.getSize(), font.getScaleX(), font.getSkewX(), FontFlags(font), script, language ? language : "", bidi_level};
+}
+
+std::shared_ptr<const ShapingCache::Word> ShapingCache::find(const Key& key) {
+  std::shared_ptr<const Word> word;
+  cache_.find(key, &word);
+  return word;
+}
+
+void ShapingCache::insert(const Key& key, std::shared_ptr<const Word> word) {
+  const size_t bytes = WordBytes(key, *word);
+  cache_.insert(key, std::move(word), bytes);
+}
+
+void ShapingCache::PurgeAll() {
+  std::lock_guard<std::mutex> lock(RegistryMutex());
+  for (ShapingCache* cache : Registry()) {
+    cache->purge();
+  }
+}
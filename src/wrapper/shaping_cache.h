@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "include/core/SkFont.h"
+#include "include/core/SkPoint.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTypes.h"
+#include "wrapper/lru_cache.h"
+
+// LRU cache of shaping results for single words, keyed by the word's UTF-8
+// text, the font (typeface id, size, scale, skew, edging, hinting and flags),
+// the script, the language and the bidi level. Used by CachingShaper; entries
+// are evicted least recently used first once their estimated size exceeds the
+// byte budget. Safe to use from several threads. Each CachingShaper holds a
+// reference, so the cache lives until its last shaper is deleted.
+class ShapingCache : public SkNVRefCnt<ShapingCache> {
+ public:
+  struct Key {
+    std::string text;
+    SkTypefaceID typeface_id;
+    float size;
+    float scale_x;
+    float skew_x;
+    uint32_t font_flags;
+    uint32_t script;
+    std::string language;
+    uint8_t bidi_level;
+
+    bool operator==(const Key& other) const;
+  };
+
+  // Glyphs of one shaped word. Positions and offsets are relative to the
+  // start of the word and clusters are UTF-8 offsets into it.
+  struct Word {
+    std::vector<SkGlyphID> glyphs;
+    std::vector<SkPoint> positions;
+    std::vector<SkPoint> offsets;
+    std::vector<uint32_t> clusters;
+    SkVector advance;
+  };
+
+  using Stats = LruCacheStats;
+
+  explicit ShapingCache(size_t budget);
+  ~ShapingCache();
+
+  ShapingCache(const ShapingCache&) = delete;
+  ShapingCache& operator=(const ShapingCache&) = delete;
+
+  static Key MakeKey(const char* utf8, size_t length, const SkFont& font, uint32_t script, const char* language, uint8_t bidi_level);
+
+  // Returns the cached word or null, counting a hit or a miss.
+  std::shared_ptr<const Word> find(const Key& key);
+  void insert(const Key& key, std::shared_ptr<const Word> word);
+
+  size_t budget() const { return cache_.budget(); }
+  // Evicts entries as needed to fit the new budget.
+  void set_budget(size_t budget) { cache_.set_budget(budget); }
+  void purge() { cache_.purge(); }
+
+  Stats stats() const { return cache_.stats(); }
+  void reset_stats() { cache_.reset_stats(); }
+
+  // Purges every live cache; called by sk_shaper_hb_purge_caches.
+  static void PurgeAll();
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  LruCache<Key, std::shared_ptr<const Word>, KeyHash> cache_;
+};
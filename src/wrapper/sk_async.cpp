@@ -0,0 +1,53 @@
+#include "wrapper/include/sk_async.h"
+
+#include "async_task.h"
+#include "worker_pool.h"
+#include "wrapper/sk_types_priv.h"
+
+sk_async_task_t* sk_async_submit(int64_t isolate_handle, sk_async_work_proc work, sk_async_completion_proc completion, void* context) {
+  AsyncTask::Callback work_callback;
+  if (work) {
+    work_callback = [work, context](AsyncTask& task) { work(ToAsyncTask(&task), context); };
+  }
+  AsyncTask::Callback completion_callback;
+  if (completion) {
+    completion_callback = [completion, context](AsyncTask& task) { completion(ToAsyncTask(&task), context); };
+  }
+  return ToAsyncTask(AsyncTask::submit(isolate_handle, std::move(work_callback), std::move(completion_callback)));
+}
+
+bool sk_async_cancel(sk_async_task_t* task) {
+  return AsAsyncTask(task)->cancel();
+}
+
+bool sk_async_is_cancel_requested(const sk_async_task_t* task) {
+  return AsAsyncTask(task)->cancel_requested();
+}
+
+sk_async_status_t sk_async_get_status(const sk_async_task_t* task) {
+  return static_cast<sk_async_status_t>(AsAsyncTask(task)->status());
+}
+
+void sk_async_task_unref(sk_async_task_t* task) {
+  AsAsyncTask(task)->unref();
+}
+
+int sk_async_get_thread_count(void) {
+  return WorkerPool::shared().thread_count();
+}
+
+void sk_async_get_stats(sk_async_stats_t* stats) {
+  AsyncTask::Stats s = AsyncTask::stats();
+  stats->submitted = s.submitted;
+  stats->completed = s.completed;
+  stats->cancelled = s.cancelled;
+  stats->queue_depth = s.queue_depth;
+  stats->running = s.running;
+  stats->total_queue_ns = s.total_queue_ns;
+  stats->max_queue_ns = s.max_queue_ns;
+  stats->total_run_ns = s.total_run_ns;
+}
+
+void sk_async_reset_stats(void) {
+  AsyncTask::reset_stats();
+}
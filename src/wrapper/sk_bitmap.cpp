@@ -12,6 +12,7 @@
 #include "include/core/SkBitmap.h"
 #include "include/core/SkImageInfo.h"
 #include "include/core/SkShader.h"
+#include "wrapper/pixel_convert.h"
 #include "wrapper/sk_types_priv.h"
 
 void sk_bitmap_delete(sk_bitmap_t* cbitmap) {
@@ -98,6 +99,9 @@ bool sk_bitmap_ready_to_draw(sk_bitmap_t* cbitmap) {
 
 void sk_bitmap_get_pixel_colors(sk_bitmap_t* cbitmap, sk_color_t* colors) {
   SkBitmap* bmp = AsBitmap(cbitmap);
+  if (ReadPixelColors(bmp->pixmap(), colors)) {
+    return;
+  }
   int w = bmp->width();
   int h = bmp->height();
   for (int y = 0; y < h; y++) {
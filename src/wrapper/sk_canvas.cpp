@@ -9,9 +9,13 @@
 
 #include "wrapper/include/sk_canvas.h"
 
+#include <cstring>
+#include <vector>
+
 #include "include/core/SkAnnotation.h"
 #include "include/core/SkCanvas.h"
 #include "include/core/SkOverdrawCanvas.h"
+#include "include/core/SkString.h"
 #include "include/core/SkSurface.h"
 #include "include/utils/SkNWayCanvas.h"
 #include "include/utils/SkNoDrawCanvas.h"
@@ -317,3 +321,696 @@ gr_recording_context_t* sk_canvas_get_recording_context(sk_canvas_t* canvas) {
 sk_surface_t* sk_canvas_get_surface(sk_canvas_t* canvas) {
   return ToSurface(SkSafeRef(AsCanvas(canvas)->getSurface()));
 }
+
+namespace {
+
+class CommandReader {
+ public:
+  CommandReader(const uint8_t* data, size_t length, const void* const* objects, size_t object_count)
+      : data_(data), length_(length), objects_(objects), object_count_(object_count) {}
+
+  bool done() const {
+    return offset_ >= length_;
+  }
+
+  bool ok() const {
+    return ok_;
+  }
+
+  uint32_t u32() {
+    uint32_t value = 0;
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  int32_t i32() {
+    int32_t value = 0;
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  float f32() {
+    float value = 0;
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  bool boolean() {
+    return u32() != 0;
+  }
+
+  // Reads an enum value, marking the stream malformed if it is past `last`.
+  template <typename E>
+  E enum_value(E last) {
+    const uint32_t value = u32();
+    if (value > static_cast<uint32_t>(last)) {
+      ok_ = false;
+      return static_cast<E>(0);
+    }
+    return static_cast<E>(value);
+  }
+
+  SkRect rect() {
+    SkRect value = SkRect::MakeEmpty();
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  SkM44 matrix() {
+    SkScalar values[16] = {};
+    read(values, sizeof(values));
+    return SkM44::ColMajor(values);
+  }
+
+  SkIRect irect() {
+    SkIRect value = SkIRect::MakeEmpty();
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  SkColor4f color4f() {
+    SkColor4f value = SkColors::kTransparent;
+    read(&value, sizeof(value));
+    return value;
+  }
+
+  SkMatrix matrix33() {
+    SkScalar v[9] = {};
+    read(v, sizeof(v));
+    // Column-major, like Dart's Matrix3.
+    // clang-format off
+    return SkMatrix::MakeAll(
+        v[0], v[3], v[6],
+        v[1], v[4], v[7],
+        v[2], v[5], v[8]);
+    // clang-format on
+  }
+
+  SkSamplingOptions sampling() {
+    const int maxAniso = i32();
+    const bool useCubic = boolean();
+    const float b = f32();
+    const float c = f32();
+    const SkFilterMode filter = enum_value(SkFilterMode::kLast);
+    const SkMipmapMode mipmap = enum_value(SkMipmapMode::kLast);
+    if (maxAniso > 0) {
+      return SkSamplingOptions::Aniso(maxAniso);
+    }
+    if (useCubic) {
+      return SkSamplingOptions(SkCubicResampler{b, c});
+    }
+    return SkSamplingOptions(filter, mipmap);
+  }
+
+  // Returns a pointer into the stream for `count` elements of T, or nullptr.
+  template <typename T>
+  const T* array(size_t count) {
+    if (!ok_ || count > length_ / sizeof(T)) {
+      ok_ = false;
+      return nullptr;
+    }
+    // Arrays are zero-padded so that the next word stays 4 byte aligned.
+    const size_t size = (count * sizeof(T) + 3) & ~static_cast<size_t>(3);
+    if (size > length_ - offset_) {
+      ok_ = false;
+      return nullptr;
+    }
+    const T* result = reinterpret_cast<const T*>(data_ + offset_);
+    offset_ += size;
+    return result;
+  }
+
+  template <typename T>
+  const T* object() {
+    const uint32_t index = u32();
+    if (!ok_ || index >= object_count_ || objects_[index] == nullptr) {
+      ok_ = false;
+      return nullptr;
+    }
+    return static_cast<const T*>(objects_[index]);
+  }
+
+  template <typename T>
+  const T* optional_object() {
+    const uint32_t index = u32();
+    if (index == SK_CANVAS_COMMAND_NO_OBJECT) {
+      return nullptr;
+    }
+    if (!ok_ || index >= object_count_ || objects_[index] == nullptr) {
+      ok_ = false;
+      return nullptr;
+    }
+    return static_cast<const T*>(objects_[index]);
+  }
+
+ private:
+  void read(void* dst, size_t size) {
+    if (!ok_ || size > length_ - offset_) {
+      ok_ = false;
+      return;
+    }
+    memcpy(dst, data_ + offset_, size);
+    offset_ += size;
+  }
+
+  const uint8_t* data_;
+  size_t length_;
+  size_t offset_ = 0;
+  const void* const* objects_;
+  size_t object_count_;
+  bool ok_ = true;
+};
+
+}  // namespace
+
+bool sk_canvas_execute_commands(sk_canvas_t* ccanvas, const uint8_t* ops, size_t length, const void* const objects[], size_t object_count) {
+  SkCanvas* canvas = AsCanvas(ccanvas);
+  CommandReader reader(ops, length, objects, object_count);
+  if (reader.u32() != SK_CANVAS_COMMANDS_VERSION || !reader.ok()) {
+    return false;
+  }
+
+  // Every command decodes all of its arguments before touching the canvas, so
+  // a truncated or malformed command is never partially executed.
+  while (!reader.done()) {
+    const uint32_t opcode = reader.u32();
+    if (!reader.ok()) {
+      return false;
+    }
+    switch ((sk_canvas_command_t)opcode) {
+      case SAVE_SK_CANVAS_COMMAND: {
+        canvas->save();
+        break;
+      }
+      case SAVE_LAYER_SK_CANVAS_COMMAND: {
+        const uint32_t flags = reader.u32();
+        if (flags & ~3u) {
+          return false;
+        }
+        const SkRect bounds = (flags & 1) ? reader.rect() : SkRect::MakeEmpty();
+        const SkPaint* paint = (flags & 2) ? AsPaint(reader.object<sk_paint_t>()) : nullptr;
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->saveLayer((flags & 1) ? &bounds : nullptr, paint);
+        break;
+      }
+      case RESTORE_SK_CANVAS_COMMAND: {
+        canvas->restore();
+        break;
+      }
+      case RESTORE_TO_COUNT_SK_CANVAS_COMMAND: {
+        const int32_t count = reader.i32();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->restoreToCount(count);
+        break;
+      }
+      case TRANSLATE_SK_CANVAS_COMMAND: {
+        const float dx = reader.f32();
+        const float dy = reader.f32();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->translate(dx, dy);
+        break;
+      }
+      case SCALE_SK_CANVAS_COMMAND: {
+        const float sx = reader.f32();
+        const float sy = reader.f32();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->scale(sx, sy);
+        break;
+      }
+      case ROTATE_SK_CANVAS_COMMAND: {
+        const float degrees = reader.f32();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->rotate(degrees);
+        break;
+      }
+      case SKEW_SK_CANVAS_COMMAND: {
+        const float sx = reader.f32();
+        const float sy = reader.f32();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->skew(sx, sy);
+        break;
+      }
+      case CONCAT_SK_CANVAS_COMMAND: {
+        const SkM44 matrix = reader.matrix();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->concat(matrix);
+        break;
+      }
+      case SET_MATRIX_SK_CANVAS_COMMAND: {
+        const SkM44 matrix = reader.matrix();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->setMatrix(matrix);
+        break;
+      }
+      case RESET_MATRIX_SK_CANVAS_COMMAND: {
+        canvas->resetMatrix();
+        break;
+      }
+      case CLIP_RECT_SK_CANVAS_COMMAND: {
+        const SkRect rect = reader.rect();
+        const SkClipOp op = reader.enum_value(SkClipOp::kMax_EnumValue);
+        const bool doAA = reader.boolean();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->clipRect(rect, op, doAA);
+        break;
+      }
+      case CLIP_RRECT_SK_CANVAS_COMMAND: {
+        const sk_rrect_t* rrect = reader.object<sk_rrect_t>();
+        const SkClipOp op = reader.enum_value(SkClipOp::kMax_EnumValue);
+        const bool doAA = reader.boolean();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->clipRRect(*AsRRect(rrect), op, doAA);
+        break;
+      }
+      case CLIP_PATH_SK_CANVAS_COMMAND: {
+        const sk_path_t* path = reader.object<sk_path_t>();
+        const SkClipOp op = reader.enum_value(SkClipOp::kMax_EnumValue);
+        const bool doAA = reader.boolean();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->clipPath(*AsPath(path), op, doAA);
+        break;
+      }
+      case CLIP_REGION_SK_CANVAS_COMMAND: {
+        const sk_region_t* region = reader.object<sk_region_t>();
+        const SkClipOp op = reader.enum_value(SkClipOp::kMax_EnumValue);
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->clipRegion(*AsRegion(region), op);
+        break;
+      }
+      case CLEAR_SK_CANVAS_COMMAND: {
+        const sk_color_t color = reader.u32();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->clear(color);
+        break;
+      }
+      case DRAW_COLOR_SK_CANVAS_COMMAND: {
+        const sk_color_t color = reader.u32();
+        const SkBlendMode mode = reader.enum_value(SkBlendMode::kLastMode);
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawColor(color, mode);
+        break;
+      }
+      case DRAW_PAINT_SK_CANVAS_COMMAND: {
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPaint(*AsPaint(paint));
+        break;
+      }
+      case DRAW_POINT_SK_CANVAS_COMMAND: {
+        const float x = reader.f32();
+        const float y = reader.f32();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPoint(x, y, *AsPaint(paint));
+        break;
+      }
+      case DRAW_POINTS_SK_CANVAS_COMMAND: {
+        const SkCanvas::PointMode mode = reader.enum_value(SkCanvas::kPolygon_PointMode);
+        const uint32_t count = reader.u32();
+        const sk_point_t* points = reader.array<sk_point_t>(count);
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPoints(mode, {AsPoint(points), count}, *AsPaint(paint));
+        break;
+      }
+      case DRAW_LINE_SK_CANVAS_COMMAND: {
+        const float x0 = reader.f32();
+        const float y0 = reader.f32();
+        const float x1 = reader.f32();
+        const float y1 = reader.f32();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawLine(x0, y0, x1, y1, *AsPaint(paint));
+        break;
+      }
+      case DRAW_RECT_SK_CANVAS_COMMAND: {
+        const SkRect rect = reader.rect();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawRect(rect, *AsPaint(paint));
+        break;
+      }
+      case DRAW_OVAL_SK_CANVAS_COMMAND: {
+        const SkRect rect = reader.rect();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawOval(rect, *AsPaint(paint));
+        break;
+      }
+      case DRAW_ROUND_RECT_SK_CANVAS_COMMAND: {
+        const SkRect rect = reader.rect();
+        const float rx = reader.f32();
+        const float ry = reader.f32();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawRoundRect(rect, rx, ry, *AsPaint(paint));
+        break;
+      }
+      case DRAW_RRECT_SK_CANVAS_COMMAND: {
+        const sk_rrect_t* rrect = reader.object<sk_rrect_t>();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawRRect(*AsRRect(rrect), *AsPaint(paint));
+        break;
+      }
+      case DRAW_DRRECT_SK_CANVAS_COMMAND: {
+        const sk_rrect_t* outer = reader.object<sk_rrect_t>();
+        const sk_rrect_t* inner = reader.object<sk_rrect_t>();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawDRRect(*AsRRect(outer), *AsRRect(inner), *AsPaint(paint));
+        break;
+      }
+      case DRAW_CIRCLE_SK_CANVAS_COMMAND: {
+        const float cx = reader.f32();
+        const float cy = reader.f32();
+        const float radius = reader.f32();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawCircle(cx, cy, radius, *AsPaint(paint));
+        break;
+      }
+      case DRAW_ARC_SK_CANVAS_COMMAND: {
+        const SkRect oval = reader.rect();
+        const float startAngle = reader.f32();
+        const float sweepAngle = reader.f32();
+        const bool useCenter = reader.boolean();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawArc(oval, startAngle, sweepAngle, useCenter, *AsPaint(paint));
+        break;
+      }
+      case DRAW_PATH_SK_CANVAS_COMMAND: {
+        const sk_path_t* path = reader.object<sk_path_t>();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPath(*AsPath(path), *AsPaint(paint));
+        break;
+      }
+      case DRAW_REGION_SK_CANVAS_COMMAND: {
+        const sk_region_t* region = reader.object<sk_region_t>();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawRegion(*AsRegion(region), *AsPaint(paint));
+        break;
+      }
+      case DRAW_IMAGE_SK_CANVAS_COMMAND: {
+        const sk_image_t* image = reader.object<sk_image_t>();
+        const float x = reader.f32();
+        const float y = reader.f32();
+        const SkSamplingOptions sampling = reader.sampling();
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawImage(AsImage(image), x, y, sampling, AsPaint(paint));
+        break;
+      }
+      case DRAW_IMAGE_RECT_SK_CANVAS_COMMAND: {
+        const sk_image_t* image = reader.object<sk_image_t>();
+        const bool hasSrc = reader.boolean();
+        const SkRect src = reader.rect();
+        const SkRect dst = reader.rect();
+        const SkSamplingOptions sampling = reader.sampling();
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        if (hasSrc) {
+          canvas->drawImageRect(AsImage(image), src, dst, sampling, AsPaint(paint), SkCanvas::SrcRectConstraint::kFast_SrcRectConstraint);
+        } else {
+          canvas->drawImageRect(AsImage(image), dst, sampling, AsPaint(paint));
+        }
+        break;
+      }
+      case DRAW_SIMPLE_TEXT_SK_CANVAS_COMMAND: {
+        const uint32_t byteLength = reader.u32();
+        const uint8_t* text = reader.array<uint8_t>(byteLength);
+        const SkTextEncoding encoding = reader.enum_value(SkTextEncoding::kGlyphID);
+        const float x = reader.f32();
+        const float y = reader.f32();
+        const sk_font_t* font = reader.object<sk_font_t>();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawSimpleText(text, byteLength, encoding, x, y, *AsFont(font), *AsPaint(paint));
+        break;
+      }
+      case DRAW_TEXT_BLOB_SK_CANVAS_COMMAND: {
+        const sk_textblob_t* blob = reader.object<sk_textblob_t>();
+        const float x = reader.f32();
+        const float y = reader.f32();
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawTextBlob(AsTextBlob(blob), x, y, *AsPaint(paint));
+        break;
+      }
+      case DRAW_PICTURE_SK_CANVAS_COMMAND: {
+        const sk_picture_t* picture = reader.object<sk_picture_t>();
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPicture(AsPicture(picture), nullptr, AsPaint(paint));
+        break;
+      }
+      case DRAW_VERTICES_SK_CANVAS_COMMAND: {
+        const sk_vertices_t* vertices = reader.object<sk_vertices_t>();
+        const SkBlendMode mode = reader.enum_value(SkBlendMode::kLastMode);
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawVertices(AsVertices(vertices), mode, *AsPaint(paint));
+        break;
+      }
+      case CLEAR_COLOR4F_SK_CANVAS_COMMAND: {
+        const SkColor4f color = reader.color4f();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->clear(color);
+        break;
+      }
+      case DRAW_COLOR4F_SK_CANVAS_COMMAND: {
+        const SkColor4f color = reader.color4f();
+        const SkBlendMode mode = reader.enum_value(SkBlendMode::kLastMode);
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawColor(color, mode);
+        break;
+      }
+      case SAVE_LAYER_REC_SK_CANVAS_COMMAND: {
+        const uint32_t flags = reader.u32();
+        if (flags & ~7u) {
+          return false;
+        }
+        const SkRect bounds = (flags & 1) ? reader.rect() : SkRect::MakeEmpty();
+        const SkPaint* paint = (flags & 2) ? AsPaint(reader.object<sk_paint_t>()) : nullptr;
+        const SkImageFilter* backdrop = (flags & 4) ? AsImageFilter(reader.object<sk_imagefilter_t>()) : nullptr;
+        const uint32_t layerFlags = reader.u32();
+        constexpr uint32_t kKnownLayerFlags = PRESERVE_LCD_TEXT_SK_CANVAS_SAVELAYERREC_FLAGS | INITIALIZE_WITH_PREVIOUS_SK_CANVAS_SAVELAYERREC_FLAGS | F16_COLOR_TYPE_SK_CANVAS_SAVELAYERREC_FLAGS;
+        if (!reader.ok() || (layerFlags & ~kKnownLayerFlags)) {
+          return false;
+        }
+        canvas->saveLayer(SkCanvas::SaveLayerRec((flags & 1) ? &bounds : nullptr, paint, backdrop, (SkCanvas::SaveLayerFlags)layerFlags));
+        break;
+      }
+      case DRAW_PICTURE_MATRIX_SK_CANVAS_COMMAND: {
+        const sk_picture_t* picture = reader.object<sk_picture_t>();
+        const SkMatrix matrix = reader.matrix33();
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPicture(AsPicture(picture), &matrix, AsPaint(paint));
+        break;
+      }
+      case DRAW_DRAWABLE_SK_CANVAS_COMMAND: {
+        const sk_drawable_t* drawable = reader.object<sk_drawable_t>();
+        const bool hasMatrix = reader.boolean();
+        const SkMatrix matrix = hasMatrix ? reader.matrix33() : SkMatrix::I();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawDrawable(const_cast<SkDrawable*>(AsDrawable(drawable)), hasMatrix ? &matrix : nullptr);
+        break;
+      }
+      case DRAW_ANNOTATION_SK_CANVAS_COMMAND: {
+        const SkRect rect = reader.rect();
+        const uint32_t keyLength = reader.u32();
+        const char* key = reader.array<char>(keyLength);
+        const sk_data_t* value = reader.object<sk_data_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawAnnotation(rect, SkString(key, keyLength).c_str(), const_cast<SkData*>(AsData(value)));
+        break;
+      }
+      case DRAW_IMAGE_NINE_SK_CANVAS_COMMAND: {
+        const sk_image_t* image = reader.object<sk_image_t>();
+        const SkIRect center = reader.irect();
+        const SkRect dst = reader.rect();
+        const SkFilterMode filter = reader.enum_value(SkFilterMode::kLast);
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawImageNine(AsImage(image), center, dst, filter, AsPaint(paint));
+        break;
+      }
+      case DRAW_IMAGE_LATTICE_SK_CANVAS_COMMAND: {
+        const sk_image_t* image = reader.object<sk_image_t>();
+        const uint32_t xCount = reader.u32();
+        const int32_t* xDivs = reader.array<int32_t>(xCount);
+        const uint32_t yCount = reader.u32();
+        const int32_t* yDivs = reader.array<int32_t>(yCount);
+        const uint32_t flags = reader.u32();
+        // Colors are only read for fixed color cells, so they need rect types.
+        if (!reader.ok() || (flags & ~7u) || (flags & 3) == 2) {
+          return false;
+        }
+        // Both counts fit in the stream, so this cannot overflow.
+        const size_t cells = (static_cast<size_t>(xCount) + 1) * (static_cast<size_t>(yCount) + 1);
+        std::vector<SkCanvas::Lattice::RectType> rectTypes;
+        bool hasFixedColor = false;
+        if (flags & 1) {
+          const uint32_t* types = reader.array<uint32_t>(cells);
+          if (!reader.ok()) {
+            return false;
+          }
+          rectTypes.resize(cells);
+          for (size_t i = 0; i < cells; ++i) {
+            if (types[i] > SkCanvas::Lattice::kFixedColor) {
+              return false;
+            }
+            rectTypes[i] = static_cast<SkCanvas::Lattice::RectType>(types[i]);
+            hasFixedColor |= rectTypes[i] == SkCanvas::Lattice::kFixedColor;
+          }
+        }
+        const SkColor* colors = (flags & 2) ? reader.array<SkColor>(cells) : nullptr;
+        const SkIRect bounds = (flags & 4) ? reader.irect() : SkIRect::MakeEmpty();
+        const SkRect dst = reader.rect();
+        const SkFilterMode filter = reader.enum_value(SkFilterMode::kLast);
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok() || (hasFixedColor && !colors)) {
+          return false;
+        }
+        SkCanvas::Lattice lattice;
+        lattice.fXDivs = xDivs;
+        lattice.fYDivs = yDivs;
+        lattice.fRectTypes = (flags & 1) ? rectTypes.data() : nullptr;
+        lattice.fXCount = static_cast<int>(xCount);
+        lattice.fYCount = static_cast<int>(yCount);
+        lattice.fBounds = (flags & 4) ? &bounds : nullptr;
+        lattice.fColors = colors;
+        canvas->drawImageLattice(AsImage(image), lattice, dst, filter, AsPaint(paint));
+        break;
+      }
+      case DRAW_ATLAS_SK_CANVAS_COMMAND: {
+        const sk_image_t* atlas = reader.object<sk_image_t>();
+        const uint32_t count = reader.u32();
+        const SkRSXform* xforms = reader.array<SkRSXform>(count);
+        const SkRect* tex = reader.array<SkRect>(count);
+        const uint32_t flags = reader.u32();
+        if (flags & ~3u) {
+          return false;
+        }
+        const SkColor* colors = (flags & 1) ? reader.array<SkColor>(count) : nullptr;
+        const SkBlendMode mode = reader.enum_value(SkBlendMode::kLastMode);
+        const SkSamplingOptions sampling = reader.sampling();
+        const SkRect cullRect = (flags & 2) ? reader.rect() : SkRect::MakeEmpty();
+        const sk_paint_t* paint = reader.optional_object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawAtlas(AsImage(atlas), {xforms, count}, {tex, count}, {colors, colors ? count : 0}, mode, sampling, (flags & 2) ? &cullRect : nullptr, AsPaint(paint));
+        break;
+      }
+      case DRAW_PATCH_SK_CANVAS_COMMAND: {
+        const SkPoint* cubics = reader.array<SkPoint>(12);
+        const uint32_t flags = reader.u32();
+        if (flags & ~3u) {
+          return false;
+        }
+        const SkColor* colors = (flags & 1) ? reader.array<SkColor>(4) : nullptr;
+        const SkPoint* texCoords = (flags & 2) ? reader.array<SkPoint>(4) : nullptr;
+        const SkBlendMode mode = reader.enum_value(SkBlendMode::kLastMode);
+        const sk_paint_t* paint = reader.object<sk_paint_t>();
+        if (!reader.ok()) {
+          return false;
+        }
+        canvas->drawPatch(cubics, colors, texCoords, mode, *AsPaint(paint));
+        break;
+      }
+      case DISCARD_SK_CANVAS_COMMAND: {
+        canvas->discard();
+        break;
+      }
+      default:
+        return false;
+    }
+    if (!reader.ok()) {
+      return false;
+    }
+  }
+  return true;
+}
@@ -9,9 +9,15 @@
 
 #include "wrapper/include/sk_codec.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "include/codec/SkCodec.h"
+#include "include/core/SkBitmap.h"
 #include "include/core/SkStream.h"
+#include "wrapper/scaled_decode.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/worker_pool.h"
 
 size_t sk_codec_min_buffered_bytes_needed(void) {
   return SkCodec::MinBufferedBytesNeeded();
@@ -114,3 +120,31 @@ sk_image_t* sk_codecs_deferred_image(sk_codec_t* codec, const sk_alphatype_t* al
   sk_sp<SkImage> image = SkCodecs::DeferredImage(std::move(skcodec), alpha);
   return ToImage(image.release());
 }
+
+namespace {
+
+void decode_one(const sk_codec_decode_request_t& request, sk_codec_decode_result_t* result) {
+  auto bitmap = std::make_unique<SkBitmap>();
+  const ScaledDecode decode = decode_scaled(sk_ref_sp(AsData(request.fData)), request.fWidth, request.fHeight, static_cast<SkColorType>(request.fColorType), nullptr, bitmap.get());
+  result->fResult = static_cast<sk_codec_result_t>(decode.result);
+  result->fBitmap = bitmap->drawsNothing() ? nullptr : ToBitmap(bitmap.release());
+  result->fDecodedSize = ToISize(decode.decoded_size);
+  result->fDecodeNanos = decode.decode_ns;
+  result->fResizeNanos = decode.resize_ns;
+}
+
+}  // namespace
+
+void sk_codec_decode_batch(const sk_codec_decode_request_t requests[], sk_codec_decode_result_t results[], size_t count, int max_threads) {
+  // Start with the largest inputs so a big image picked up last does not
+  // leave the other threads idle at the end of the batch.
+  std::vector<size_t> order(count);
+  std::iota(order.begin(), order.end(), 0);
+  auto encoded_size = [&](size_t i) { return requests[i].fData ? AsData(requests[i].fData)->size() : 0; };
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return encoded_size(a) > encoded_size(b); });
+
+  WorkerPool::shared().parallel_for(count, max_threads, [&](size_t index) {
+    const size_t i = order[index];
+    decode_one(requests[i], &results[i]);
+  });
+}
@@ -0,0 +1,41 @@
+#include "wrapper/include/sk_decoded_image_cache.h"
+
+#include "wrapper/decoded_image_cache.h"
+#include "wrapper/sk_types_priv.h"
+
+sk_decoded_image_cache_t* sk_decoded_image_cache_new(size_t byte_budget) {
+  return ToDecodedImageCache(new DecodedImageCache(byte_budget));
+}
+
+void sk_decoded_image_cache_delete(sk_decoded_image_cache_t* cache) {
+  delete AsDecodedImageCache(cache);
+}
+
+sk_image_t* sk_decoded_image_cache_get(sk_decoded_image_cache_t* cache, const sk_data_t* data, int width, int height, sk_colortype_t color_type, const sk_colorspace_t* color_space) {
+  return ToImage(AsDecodedImageCache(cache)->get(sk_ref_sp(AsData(data)), width, height, static_cast<SkColorType>(color_type), sk_ref_sp(AsColorSpace(color_space))).release());
+}
+
+size_t sk_decoded_image_cache_get_budget(const sk_decoded_image_cache_t* cache) {
+  return AsDecodedImageCache(cache)->budget();
+}
+
+void sk_decoded_image_cache_set_budget(sk_decoded_image_cache_t* cache, size_t byte_budget) {
+  AsDecodedImageCache(cache)->set_budget(byte_budget);
+}
+
+void sk_decoded_image_cache_purge(sk_decoded_image_cache_t* cache) {
+  AsDecodedImageCache(cache)->purge();
+}
+
+void sk_decoded_image_cache_get_stats(const sk_decoded_image_cache_t* cache, sk_decoded_image_cache_stats_t* stats) {
+  DecodedImageCache::Stats s = AsDecodedImageCache(cache)->stats();
+  stats->fHits = s.hits;
+  stats->fMisses = s.misses;
+  stats->fEvictions = s.evictions;
+  stats->fBytes = s.bytes;
+  stats->fEntryCount = s.entries;
+}
+
+void sk_decoded_image_cache_reset_stats(sk_decoded_image_cache_t* cache) {
+  AsDecodedImageCache(cache)->reset_stats();
+}
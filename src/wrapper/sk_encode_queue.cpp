@@ -0,0 +1,75 @@
+#include "wrapper/include/sk_encode_queue.h"
+
+#include "wrapper/encode_queue.h"
+#include "wrapper/sk_types_priv.h"
+
+namespace {
+
+EncodeOptions as_encode_options(const sk_encode_options_t* coptions) {
+  EncodeOptions options;
+  if (!coptions) {
+    return options;
+  }
+  options.format = (SkEncodedImageFormat)coptions->fFormat;
+  options.png = AsPngEncoderOptions(&coptions->fPng);
+  options.jpeg = AsJpegEncoderOptions(&coptions->fJpeg);
+  options.xmp_metadata = sk_ref_sp(options.jpeg.xmpMetadata);
+  options.webp = AsWebpEncoderOptions(&coptions->fWebp);
+  return options;
+}
+
+EncodeQueue::Completion as_completion(sk_encode_result_t* cresult, sk_async_completion_proc completion, void* context) {
+  return [cresult, completion, context](AsyncTask& task, EncodeQueue::Result& result) {
+    cresult->fData = ToData(result.data.release());
+    cresult->fQueueNanos = result.queue_ns;
+    cresult->fEncodeNanos = result.encode_ns;
+    if (completion) {
+      completion(ToAsyncTask(&task), context);
+    }
+  };
+}
+
+}  // namespace
+
+sk_encode_queue_t* sk_encode_queue_new(int capacity) {
+  return ToEncodeQueue(new EncodeQueue(capacity));
+}
+
+void sk_encode_queue_delete(sk_encode_queue_t* queue) {
+  SkSafeUnref(AsEncodeQueue(queue));
+}
+
+int sk_encode_queue_get_capacity(const sk_encode_queue_t* queue) {
+  return AsEncodeQueue(queue)->capacity();
+}
+
+int sk_encode_queue_get_in_flight(const sk_encode_queue_t* queue) {
+  return AsEncodeQueue(queue)->in_flight();
+}
+
+sk_async_task_t* sk_encode_queue_encode_image_async(int64_t isolate_handle, sk_encode_queue_t* queue, const sk_image_t* image, const sk_encode_options_t* options, sk_encode_result_t* result, sk_async_completion_proc completion, void* context) {
+  return ToAsyncTask(AsEncodeQueue(queue)->submit(isolate_handle, sk_ref_sp(AsImage(image)), as_encode_options(options), as_completion(result, completion, context)));
+}
+
+sk_async_task_t* sk_encode_queue_encode_pixmap_async(int64_t isolate_handle, sk_encode_queue_t* queue, const sk_pixmap_t* pixmap, const sk_encode_options_t* options, sk_encode_result_t* result, sk_async_completion_proc completion, void* context) {
+  return ToAsyncTask(AsEncodeQueue(queue)->submit(isolate_handle, *AsPixmap(pixmap), as_encode_options(options), as_completion(result, completion, context)));
+}
+
+void sk_encode_queue_get_stats(const sk_encode_queue_t* queue, sk_encode_queue_stats_t* cstats) {
+  const EncodeQueue::Stats stats = AsEncodeQueue(queue)->stats();
+  cstats->fSubmitted = stats.submitted;
+  cstats->fRejected = stats.rejected;
+  cstats->fEncoded = stats.encoded;
+  cstats->fFailed = stats.failed;
+  cstats->fCancelled = stats.cancelled;
+  cstats->fInFlight = stats.in_flight;
+  cstats->fEncodedBytes = stats.encoded_bytes;
+  cstats->fTotalQueueNanos = stats.total_queue_ns;
+  cstats->fMaxQueueNanos = stats.max_queue_ns;
+  cstats->fTotalEncodeNanos = stats.total_encode_ns;
+  cstats->fMaxEncodeNanos = stats.max_encode_ns;
+}
+
+void sk_encode_queue_reset_stats(sk_encode_queue_t* queue) {
+  AsEncodeQueue(queue)->reset_stats();
+}
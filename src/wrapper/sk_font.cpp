@@ -9,7 +9,13 @@
 
 #include "wrapper/include/sk_font.h"
 
+#include <memory>
+#include <vector>
+
+#include "wrapper/async_task.h"
+#include "wrapper/font_prewarm.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/worker_pool.h"
 #include "include/core/SkFont.h"
 #include "include/core/SkTypeface.h"
 #include "include/utils/SkTextUtils.h"
@@ -215,6 +221,70 @@ size_t sk_font_get_intercepts(const sk_font_t* font, const uint16_t glyphs[], in
   return result.size();
 }
 
+// Glyph prewarming
+
+namespace {
+
+void prewarm_result(const FontPrewarmResult& prewarmed, sk_font_prewarm_result_t* result) {
+  result->fImageCount = prewarmed.images;
+  result->fPathCount = prewarmed.paths;
+  result->fNanos = prewarmed.nanos;
+}
+
+// A request copied so it can outlive the caller's arguments.
+struct PrewarmRequest {
+  SkFont font;
+  std::vector<SkGlyphID> glyphs;
+  SkMatrix matrix;
+  SkPaint paint;
+};
+
+}  // namespace
+
+void sk_font_prewarm_glyphs(const sk_font_t* font, const uint16_t glyphs[], size_t count, const sk_matrix_t* matrix, const sk_paint_t* paint, sk_font_prewarm_result_t* result) {
+  const FontPrewarmResult prewarmed = PrewarmGlyphs(*AsFont(font), {glyphs, count}, matrix ? AsMatrix(matrix) : SkMatrix::I(), paint ? *AsPaint(paint) : SkPaint());
+  if (result) {
+    prewarm_result(prewarmed, result);
+  }
+}
+
+void sk_font_prewarm_glyphs_batch(const sk_font_prewarm_request_t requests[], sk_font_prewarm_result_t results[], size_t count, int max_threads) {
+  WorkerPool::shared().parallel_for(count, max_threads, [&](size_t i) {
+    const sk_font_prewarm_request_t& request = requests[i];
+    sk_font_prewarm_glyphs(request.fFont, request.fGlyphs, request.fGlyphCount, request.fMatrix, request.fPaint, &results[i]);
+  });
+}
+
+sk_async_task_t* sk_font_prewarm_glyphs_async(int64_t isolate_handle, const sk_font_prewarm_request_t requests[], size_t count, sk_font_prewarm_result_t results[], sk_async_completion_proc completion, void* context) {
+  auto copies = std::make_shared<std::vector<PrewarmRequest>>();
+  copies->reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    const sk_font_prewarm_request_t& request = requests[i];
+    copies->push_back({
+        *AsFont(request.fFont),
+        std::vector<SkGlyphID>(request.fGlyphs, request.fGlyphs + request.fGlyphCount),
+        request.fMatrix ? AsMatrix(request.fMatrix) : SkMatrix::I(),
+        request.fPaint ? *AsPaint(request.fPaint) : SkPaint(),
+    });
+  }
+  AsyncTask::Callback work = [copies, results](AsyncTask& task) {
+    // The task already runs on a pool thread, which takes part in the loop.
+    WorkerPool::shared().parallel_for(copies->size(), 0, [&](size_t i) {
+      if (task.cancel_requested()) {
+        results[i] = {0, 0, 0};
+        return;
+      }
+      const PrewarmRequest& request = (*copies)[i];
+      prewarm_result(PrewarmGlyphs(request.font, request.glyphs, request.matrix, request.paint), &results[i]);
+    });
+  };
+  AsyncTask::Callback completion_callback;
+  if (completion) {
+    completion_callback = [completion, context](AsyncTask& task) { completion(ToAsyncTask(&task), context); };
+  }
+  return ToAsyncTask(AsyncTask::submit(isolate_handle, std::move(work), std::move(completion_callback)));
+}
+
 // sk_text_utils
 
 void sk_text_utils_get_path(const void* text, size_t length, sk_text_encoding_t encoding, float x, float y, const sk_font_t* font, sk_path_t* path) {
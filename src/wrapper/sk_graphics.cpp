@@ -10,6 +10,7 @@
 #include "wrapper/include/sk_graphics.h"
 
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/typeface_tables.h"
 #include "include/core/SkGraphics.h"
 
 void sk_graphics_init(void) {
@@ -18,6 +19,7 @@ void sk_graphics_init(void) {
 
 void sk_graphics_purge_font_cache(void) {
   SkGraphics::PurgeFontCache();
+  PurgeTypefaceTableCache();
 }
 
 void sk_graphics_purge_resource_cache(void) {
@@ -26,6 +28,7 @@ void sk_graphics_purge_resource_cache(void) {
 
 void sk_graphics_purge_all_caches(void) {
   SkGraphics::PurgeAllCaches();
+  PurgeTypefaceTableCache();
 }
 
 size_t sk_graphics_get_font_cache_used(void) {
@@ -10,9 +10,9 @@
 #include "wrapper/include/sk_paragraph.h"
 
 #include <algorithm>
-#include <cstring>
 #include <iterator>
 #include <limits>
+#include <numeric>
 #include <variant>
 #include <vector>
 
@@ -31,7 +31,12 @@
 #include "modules/skparagraph/include/ParagraphStyle.h"
 #include "modules/skparagraph/include/TextShadow.h"
 #include "modules/skparagraph/include/TextStyle.h"
+#include "wrapper/paragraph_builder_handle.h"
+#include "wrapper/paragraph_handle.h"
+#include "wrapper/paragraph_hash.h"
+#include "wrapper/paragraph_layout_cache.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/worker_pool.h"
 
 using skia::textlayout::ParagraphStyle;
 using skia::textlayout::StrutStyle;
@@ -39,126 +44,8 @@ using skia::textlayout::TextShadow;
 
 namespace {
 
-void HashMix(uint64_t* hash, uint64_t value) {
-  *hash ^= value;
-  *hash *= 1099511628211ull;
-}
-
-void HashMixFloat(uint64_t* hash, float value) {
-  uint32_t bits = 0;
-  std::memcpy(&bits, &value, sizeof(bits));
-  HashMix(hash, bits);
-}
-
-void HashMixString(uint64_t* hash, const SkString& value) {
-  HashMix(hash, value.size());
-  for (size_t i = 0; i < value.size(); ++i) {
-    HashMix(hash, static_cast<uint8_t>(value[i]));
-  }
-}
-
-void HashMixUtf16String(uint64_t* hash, const std::u16string& value) {
-  HashMix(hash, value.size());
-  for (char16_t ch : value) {
-    HashMix(hash, static_cast<uint16_t>(ch));
-  }
-}
-
-int64_t PaintHash(const SkPaint& paint) {
-  uint64_t hash = 1469598103934665603ull;
-  HashMix(&hash, reinterpret_cast<uintptr_t>(paint.getPathEffect()));
-  HashMix(&hash, reinterpret_cast<uintptr_t>(paint.getShader()));
-  HashMix(&hash, reinterpret_cast<uintptr_t>(paint.getMaskFilter()));
-  HashMix(&hash, reinterpret_cast<uintptr_t>(paint.getColorFilter()));
-  HashMix(&hash, reinterpret_cast<uintptr_t>(paint.getBlender()));
-  HashMix(&hash, reinterpret_cast<uintptr_t>(paint.getImageFilter()));
-
-  const SkColor4f color = paint.getColor4f();
-  HashMixFloat(&hash, color.fR);
-  HashMixFloat(&hash, color.fG);
-  HashMixFloat(&hash, color.fB);
-  HashMixFloat(&hash, color.fA);
-  HashMixFloat(&hash, paint.getStrokeWidth());
-  HashMixFloat(&hash, paint.getStrokeMiter());
-
-  HashMix(&hash, static_cast<uint8_t>(paint.isAntiAlias()));
-  HashMix(&hash, static_cast<uint8_t>(paint.isDither()));
-  HashMix(&hash, static_cast<uint8_t>(paint.getStrokeCap()));
-  HashMix(&hash, static_cast<uint8_t>(paint.getStrokeJoin()));
-  HashMix(&hash, static_cast<uint8_t>(paint.getStyle()));
-
-  return static_cast<int64_t>(hash);
-}
-
-void HashMixPaintOrID(uint64_t* hash, const skia::textlayout::ParagraphPainter::SkPaintOrID& value) {
-  if (const SkPaint* paint = std::get_if<SkPaint>(&value)) {
-    HashMix(hash, 1);
-    HashMix(hash, PaintHash(*paint));
-    return;
-  }
-  HashMix(hash, 2);
-  HashMix(hash, static_cast<uint32_t>(std::get<skia::textlayout::ParagraphPainter::PaintID>(value)));
-}
-
-int64_t TextStyleHash(const skia::textlayout::TextStyle& value) {
-  uint64_t hash = 1469598103934665603ull;
-
-  HashMix(&hash, value.getColor());
-
-  const auto decoration = value.getDecoration();
-  HashMix(&hash, decoration.fType);
-  HashMix(&hash, decoration.fMode);
-  HashMix(&hash, decoration.fColor);
-  HashMix(&hash, decoration.fStyle);
-  HashMixFloat(&hash, decoration.fThicknessMultiplier);
-
-  const SkFontStyle font_style = value.getFontStyle();
-  HashMix(&hash, font_style.weight());
-  HashMix(&hash, font_style.width());
-  HashMix(&hash, font_style.slant());
-
-  const auto& font_families = value.getFontFamilies();
-  HashMix(&hash, font_families.size());
-  for (const SkString& family : font_families) {
-    HashMixString(&hash, family);
-  }
-
-  HashMixFloat(&hash, value.getLetterSpacing());
-  HashMixFloat(&hash, value.getWordSpacing());
-  HashMixFloat(&hash, value.getHeight());
-  HashMix(&hash, value.getHeightOverride());
-  HashMix(&hash, value.getHalfLeading());
-  HashMixFloat(&hash, value.getBaselineShift());
-  HashMixFloat(&hash, value.getFontSize());
-  HashMixString(&hash, value.getLocale());
-
-  HashMix(&hash, value.hasForeground());
-  if (value.hasForeground()) {
-    HashMixPaintOrID(&hash, value.getForegroundPaintOrID());
-  }
-
-  HashMix(&hash, value.hasBackground());
-  if (value.hasBackground()) {
-    HashMixPaintOrID(&hash, value.getBackgroundPaintOrID());
-  }
-
-  const auto shadows = value.getShadows();
-  HashMix(&hash, shadows.size());
-  for (const TextShadow& shadow : shadows) {
-    HashMix(&hash, shadow.fColor);
-    HashMixFloat(&hash, shadow.fOffset.x());
-    HashMixFloat(&hash, shadow.fOffset.y());
-    HashMixFloat(&hash, shadow.fBlurSigma);
-  }
-
-  const auto font_features = value.getFontFeatures();
-  HashMix(&hash, font_features.size());
-  for (const skia::textlayout::FontFeature& feature : font_features) {
-    HashMixString(&hash, feature.fName);
-    HashMix(&hash, feature.fValue);
-  }
-
-  return static_cast<int64_t>(hash);
+skia::textlayout::Paragraph* AsParagraph(sk_paragraph_t* paragraph) {
+  return AsParagraphHandle(paragraph)->paragraph();
 }
 
 TextShadow AsTextShadowValue(const sk_text_shadow_t& shadow) {
@@ -213,29 +100,7 @@ bool sk_strut_style_equals(const sk_strut_style_t* style, const sk_strut_style_t
 }
 
 int64_t sk_strut_style_get_hash(const sk_strut_style_t* style) {
-  const StrutStyle& value = *AsStrutStyle(style);
-  uint64_t hash = 1469598103934665603ull;
-
-  HashMix(&hash, value.getStrutEnabled());
-  HashMix(&hash, value.getHeightOverride());
-  HashMix(&hash, value.getForceStrutHeight());
-  HashMix(&hash, value.getHalfLeading());
-  HashMixFloat(&hash, value.getLeading());
-  HashMixFloat(&hash, value.getHeight());
-  HashMixFloat(&hash, value.getFontSize());
-
-  const SkFontStyle font_style = value.getFontStyle();
-  HashMix(&hash, font_style.weight());
-  HashMix(&hash, font_style.width());
-  HashMix(&hash, font_style.slant());
-
-  const auto& font_families = value.getFontFamilies();
-  HashMix(&hash, font_families.size());
-  for (const SkString& family : font_families) {
-    HashMixString(&hash, family);
-  }
-
-  return static_cast<int64_t>(hash);
+  return StrutStyleHash(*AsStrutStyle(style));
 }
 
 size_t sk_strut_style_get_font_family_count(const sk_strut_style_t* style) {
@@ -341,19 +206,7 @@ bool sk_paragraph_style_equals(const sk_paragraph_style_t* style, const sk_parag
 }
 
 int64_t sk_paragraph_style_get_hash(const sk_paragraph_style_t* style) {
-  const ParagraphStyle& value = *AsParagraphStyle(style);
-  uint64_t hash = 1469598103934665603ull;
-
-  HashMixFloat(&hash, value.getHeight());
-  HashMixString(&hash, value.getEllipsis());
-  HashMixUtf16String(&hash, value.getEllipsisUtf16());
-  HashMix(&hash, static_cast<uint32_t>(value.getTextDirection()));
-  HashMix(&hash, static_cast<uint32_t>(value.getTextAlign()));
-  HashMix(&hash, TextStyleHash(value.getTextStyle()));
-  HashMix(&hash, value.getReplaceTabCharacters());
-  HashMix(&hash, value.fakeMissingFontStyles());
-
-  return static_cast<int64_t>(hash);
+  return ParagraphStyleHash(*AsParagraphStyle(style));
 }
 
 void sk_paragraph_style_get_strut_style(const sk_paragraph_style_t* style, sk_strut_style_t* strut_style) {
@@ -913,7 +766,7 @@ bool sk_line_metrics_get_style_metrics(const sk_line_metrics_t* metrics, size_t
 }
 
 void sk_paragraph_delete(sk_paragraph_t* paragraph) {
-  delete AsParagraph(paragraph);
+  delete AsParagraphHandle(paragraph);
 }
 
 float sk_paragraph_get_max_width(sk_paragraph_t* paragraph) {
@@ -949,7 +802,25 @@ bool sk_paragraph_did_exceed_max_lines(sk_paragraph_t* paragraph) {
 }
 
 void sk_paragraph_layout(sk_paragraph_t* paragraph, float width) {
-  AsParagraph(paragraph)->layout(width);
+  AsParagraphHandle(paragraph)->layout(width);
+}
+
+void sk_paragraph_layout_batch(sk_paragraph_t* paragraphs[], const float widths[], size_t count, int max_threads) {
+  std::vector<ParagraphHandle*> handles(count);
+  for (size_t i = 0; i < count; ++i) {
+    handles[i] = AsParagraphHandle(paragraphs[i]);
+    handles[i]->prepare_concurrent_layout();
+  }
+  // Longest text first so a long paragraph picked up last does not leave the
+  // other threads idle at the end of the batch.
+  std::vector<size_t> order(count);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return handles[a]->text_size() > handles[b]->text_size(); });
+
+  WorkerPool::shared().parallel_for(count, max_threads, [&](size_t index) {
+    const size_t i = order[index];
+    handles[i]->layout(widths[i]);
+  });
 }
 
 void sk_paragraph_paint(sk_paragraph_t* paragraph, sk_canvas_t* canvas, float x, float y) {
@@ -981,7 +852,22 @@ size_t sk_paragraph_get_rects_for_placeholders(sk_paragraph_t* paragraph, sk_par
 }
 
 sk_paragraph_position_with_affinity_t sk_paragraph_get_glyph_position_at_coordinate(sk_paragraph_t* paragraph, float dx, float dy) {
-  return ToParagraphPositionWithAffinity(AsParagraph(paragraph)->getGlyphPositionAtCoordinate(dx, dy));
+  return ToParagraphPositionWithAffinity(AsParagraphHandle(paragraph)->glyph_position_at_coordinate(dx, dy));
+}
+
+void sk_paragraph_get_glyph_positions_at_coordinates(sk_paragraph_t* paragraph, const sk_point_t points[], size_t count, sk_paragraph_position_with_affinity_t positions[]) {
+  ParagraphHandle* handle = AsParagraphHandle(paragraph);
+  for (size_t i = 0; i < count; ++i) {
+    positions[i] = ToParagraphPositionWithAffinity(handle->glyph_position_at_coordinate(points[i].x, points[i].y));
+  }
+}
+
+void sk_paragraph_set_hit_test_index_enabled(sk_paragraph_t* paragraph, bool enabled) {
+  AsParagraphHandle(paragraph)->set_hit_test_index_enabled(enabled);
+}
+
+bool sk_paragraph_is_hit_test_index_enabled(const sk_paragraph_t* paragraph) {
+  return AsParagraphHandle(paragraph)->hit_test_index_enabled();
 }
 
 sk_paragraph_text_range_t sk_paragraph_get_word_boundary(sk_paragraph_t* paragraph, unsigned offset) {
@@ -990,14 +876,11 @@ sk_paragraph_text_range_t sk_paragraph_get_word_boundary(sk_paragraph_t* paragra
 }
 
 size_t sk_paragraph_get_line_metrics_count(sk_paragraph_t* paragraph) {
-  std::vector<skia::textlayout::LineMetrics> line_metrics;
-  AsParagraph(paragraph)->getLineMetrics(line_metrics);
-  return line_metrics.size();
+  return AsParagraphHandle(paragraph)->line_metrics().size();
 }
 
 bool sk_paragraph_get_line_metrics_by_index(sk_paragraph_t* paragraph, size_t index, sk_line_metrics_t* line_metrics) {
-  std::vector<skia::textlayout::LineMetrics> metrics;
-  AsParagraph(paragraph)->getLineMetrics(metrics);
+  const auto& metrics = AsParagraphHandle(paragraph)->line_metrics();
   if (index >= metrics.size()) {
     return false;
   }
@@ -1005,12 +888,45 @@ bool sk_paragraph_get_line_metrics_by_index(sk_paragraph_t* paragraph, size_t in
   return true;
 }
 
+size_t sk_paragraph_get_style_metrics_count(sk_paragraph_t* paragraph) {
+  return AsParagraphHandle(paragraph)->style_metrics_count();
+}
+
+void sk_paragraph_get_all_line_metrics(sk_paragraph_t* paragraph, const sk_paragraph_line_metrics_buffer_t* buffer) {
+  const auto& lines = AsParagraphHandle(paragraph)->line_metrics();
+  const sk_paragraph_line_metrics_buffer_t& out = *buffer;
+  uint64_t style_run = 0;
+  for (size_t i = 0; i < lines.size(); ++i) {
+    const skia::textlayout::LineMetrics& line = lines[i];
+    if (out.start_index) out.start_index[i] = line.fStartIndex;
+    if (out.end_index) out.end_index[i] = line.fEndIndex;
+    if (out.end_excluding_whitespaces) out.end_excluding_whitespaces[i] = line.fEndExcludingWhitespaces;
+    if (out.end_including_newline) out.end_including_newline[i] = line.fEndIncludingNewline;
+    if (out.hard_break) out.hard_break[i] = line.fHardBreak;
+    if (out.ascent) out.ascent[i] = line.fAscent;
+    if (out.descent) out.descent[i] = line.fDescent;
+    if (out.unscaled_ascent) out.unscaled_ascent[i] = line.fUnscaledAscent;
+    if (out.height) out.height[i] = line.fHeight;
+    if (out.width) out.width[i] = line.fWidth;
+    if (out.left) out.left[i] = line.fLeft;
+    if (out.baseline) out.baseline[i] = line.fBaseline;
+    if (out.line_number) out.line_number[i] = line.fLineNumber;
+    if (out.style_run_offsets) out.style_run_offsets[i] = style_run;
+    for (const auto& [text_start, style_metrics] : line.fLineMetrics) {
+      if (out.style_run_text_starts) out.style_run_text_starts[style_run] = text_start;
+      if (out.style_run_font_metrics) *AsFontMetrics(&out.style_run_font_metrics[style_run]) = style_metrics.font_metrics;
+      ++style_run;
+    }
+  }
+  if (out.style_run_offsets) out.style_run_offsets[lines.size()] = style_run;
+}
+
 size_t sk_paragraph_get_line_number(sk_paragraph_t* paragraph) {
   return AsParagraph(paragraph)->lineNumber();
 }
 
 void sk_paragraph_mark_dirty(sk_paragraph_t* paragraph) {
-  AsParagraph(paragraph)->markDirty();
+  AsParagraphHandle(paragraph)->mark_dirty();
 }
 
 int32_t sk_paragraph_unresolved_glyphs(sk_paragraph_t* paragraph) {
@@ -1101,7 +1017,7 @@ bool sk_paragraph_get_glyph_cluster_at(sk_paragraph_t* paragraph, size_t code_un
 
 bool sk_paragraph_get_closest_glyph_cluster_at(sk_paragraph_t* paragraph, float dx, float dy, sk_paragraph_glyph_cluster_info_t* glyph_info) {
   skia::textlayout::Paragraph::GlyphClusterInfo info;
-  if (!AsParagraph(paragraph)->getClosestGlyphClusterAt(dx, dy, &info)) {
+  if (!AsParagraphHandle(paragraph)->closest_glyph_cluster_at(dx, dy, &info)) {
     return false;
   }
   *glyph_info = ToParagraphGlyphClusterInfo(info);
@@ -1227,50 +1143,103 @@ bool sk_font_collection_font_fallback_enabled(sk_font_collection_t* collection)
 
 void sk_font_collection_clear_caches(sk_font_collection_t* collection) {
   AsFontCollection(collection)->clearCaches();
+  ParagraphLayoutCache::PurgeAll(AsFontCollection(collection));
 }
 
 sk_paragraph_builder_t* sk_paragraph_builder_make(const sk_paragraph_style_t* style, sk_font_collection_t* font_collection, sk_unicode_t* unicode) {
-  return ToParagraphBuilder(skia::textlayout::ParagraphBuilder::make(*AsParagraphStyle(style), sk_ref_sp(AsFontCollection(font_collection)), sk_ref_sp(AsUnicode(unicode))).release());
+  return ToParagraphBuilderHandle(new ParagraphBuilderHandle(*AsParagraphStyle(style), sk_ref_sp(AsFontCollection(font_collection)), sk_ref_sp(AsUnicode(unicode)), false));
+}
+
+sk_paragraph_builder_t* sk_paragraph_builder_make_recording(const sk_paragraph_style_t* style, sk_font_collection_t* font_collection, sk_unicode_t* unicode) {
+  return ToParagraphBuilderHandle(new ParagraphBuilderHandle(*AsParagraphStyle(style), sk_ref_sp(AsFontCollection(font_collection)), sk_ref_sp(AsUnicode(unicode)), true));
 }
 
 void sk_paragraph_builder_delete(sk_paragraph_builder_t* builder) {
-  delete AsParagraphBuilder(builder);
+  delete AsParagraphBuilderHandle(builder);
 }
 
 void sk_paragraph_builder_push_style(sk_paragraph_builder_t* builder, const sk_text_style_t* style) {
-  AsParagraphBuilder(builder)->pushStyle(*AsTextStyle(style));
+  AsParagraphBuilderHandle(builder)->push_style(*AsTextStyle(style));
 }
 
 void sk_paragraph_builder_pop(sk_paragraph_builder_t* builder) {
-  AsParagraphBuilder(builder)->pop();
+  AsParagraphBuilderHandle(builder)->pop();
 }
 
 void sk_paragraph_builder_peek_style(sk_paragraph_builder_t* builder, sk_text_style_t* style) {
-  *AsTextStyle(style) = AsParagraphBuilder(builder)->peekStyle();
+  *AsTextStyle(style) = AsParagraphBuilderHandle(builder)->builder()->peekStyle();
 }
 
 void sk_paragraph_builder_add_text_len(sk_paragraph_builder_t* builder, const char* text, size_t len) {
-  AsParagraphBuilder(builder)->addText(text, len);
+  AsParagraphBuilderHandle(builder)->add_text(text, len);
 }
 
 void sk_paragraph_builder_add_placeholder(sk_paragraph_builder_t* builder, const sk_paragraph_placeholder_style_t* placeholder_style) {
-  AsParagraphBuilder(builder)->addPlaceholder(AsParagraphPlaceholderStyle(*placeholder_style));
+  AsParagraphBuilderHandle(builder)->add_placeholder(AsParagraphPlaceholderStyle(*placeholder_style));
+}
+
+bool sk_paragraph_builder_add_runs(sk_paragraph_builder_t* builder, const sk_text_style_t* const styles[], size_t style_count, const sk_paragraph_placeholder_style_t placeholders[], size_t placeholder_count, const sk_paragraph_text_run_t runs[], size_t run_count, const char* text, size_t length) {
+  size_t total = 0;
+  for (size_t i = 0; i < run_count; ++i) {
+    const sk_paragraph_text_run_t& run = runs[i];
+    if (run.style_index < -1 || (run.style_index >= 0 && static_cast<size_t>(run.style_index) >= style_count)) {
+      return false;
+    }
+    if (run.placeholder_index >= 0) {
+      if (static_cast<size_t>(run.placeholder_index) >= placeholder_count || run.text_length != 0) {
+        return false;
+      }
+    } else if (run.placeholder_index != -1) {
+      return false;
+    }
+    total += run.text_length;
+  }
+  if (total != length) {
+    return false;
+  }
+
+  ParagraphBuilderHandle* handle = AsParagraphBuilderHandle(builder);
+  // Runs are bracketed by push/pop only where the style changes.
+  int32_t current = -1;
+  size_t offset = 0;
+  for (size_t i = 0; i < run_count; ++i) {
+    const sk_paragraph_text_run_t& run = runs[i];
+    if (run.style_index != current) {
+      if (current >= 0) {
+        handle->pop();
+      }
+      if (run.style_index >= 0) {
+        handle->push_style(*AsTextStyle(styles[run.style_index]));
+      }
+      current = run.style_index;
+    }
+    if (run.placeholder_index >= 0) {
+      handle->add_placeholder(AsParagraphPlaceholderStyle(placeholders[run.placeholder_index]));
+    } else if (run.text_length > 0) {
+      handle->add_text(text + offset, run.text_length);
+      offset += run.text_length;
+    }
+  }
+  if (current >= 0) {
+    handle->pop();
+  }
+  return true;
 }
 
 sk_paragraph_t* sk_paragraph_builder_build(sk_paragraph_builder_t* builder) {
-  return ToParagraph(AsParagraphBuilder(builder)->Build().release());
+  return ToParagraphHandle(AsParagraphBuilderHandle(builder)->build());
 }
 
 void sk_paragraph_builder_get_text(sk_paragraph_builder_t* builder, char** text, size_t* length) {
-  const SkSpan<char> span = AsParagraphBuilder(builder)->getText();
+  const SkSpan<char> span = AsParagraphBuilderHandle(builder)->builder()->getText();
   *length = span.size();
   *text = span.data();
 }
 
 void sk_paragraph_builder_get_paragraph_style(const sk_paragraph_builder_t* builder, sk_paragraph_style_t* style) {
-  *AsParagraphStyle(style) = AsParagraphBuilder(builder)->getParagraphStyle();
+  *AsParagraphStyle(style) = AsParagraphBuilderHandle(builder)->builder()->getParagraphStyle();
 }
 
 void sk_paragraph_builder_reset(sk_paragraph_builder_t* builder) {
-  AsParagraphBuilder(builder)->Reset();
+  AsParagraphBuilderHandle(builder)->reset();
 }
@@ -0,0 +1,61 @@
+#include "wrapper/include/sk_paragraph_editor.h"
+
+#include "wrapper/paragraph_builder_handle.h"
+#include "wrapper/paragraph_editor.h"
+#include "wrapper/sk_types_priv.h"
+
+sk_paragraph_editor_t* sk_paragraph_editor_new(const sk_paragraph_builder_t* builder) {
+  const ParagraphRecipe* recipe = AsParagraphBuilderHandle(builder)->recipe();
+  if (!recipe) {
+    return nullptr;
+  }
+  return ToParagraphEditor(new ParagraphEditor(*recipe));
+}
+
+void sk_paragraph_editor_delete(sk_paragraph_editor_t* editor) {
+  delete AsParagraphEditor(editor);
+}
+
+void sk_paragraph_editor_get_text(const sk_paragraph_editor_t* editor, const char** text, size_t* length) {
+  const std::string& value = AsParagraphEditor(editor)->text();
+  *text = value.data();
+  *length = value.size();
+}
+
+bool sk_paragraph_editor_replace(sk_paragraph_editor_t* editor, size_t start, size_t end, const char* text, size_t length) {
+  return AsParagraphEditor(editor)->replace(start, end, text, length);
+}
+
+size_t sk_paragraph_editor_layout(sk_paragraph_editor_t* editor, float width) {
+  return AsParagraphEditor(editor)->layout(width);
+}
+
+float sk_paragraph_editor_get_height(const sk_paragraph_editor_t* editor) {
+  return AsParagraphEditor(editor)->height();
+}
+
+float sk_paragraph_editor_get_longest_line(const sk_paragraph_editor_t* editor) {
+  return AsParagraphEditor(editor)->longest_line();
+}
+
+size_t sk_paragraph_editor_get_line_count(const sk_paragraph_editor_t* editor) {
+  return AsParagraphEditor(editor)->line_count();
+}
+
+void sk_paragraph_editor_paint(sk_paragraph_editor_t* editor, sk_canvas_t* canvas, float x, float y) {
+  AsParagraphEditor(editor)->paint(AsCanvas(canvas), x, y);
+}
+
+sk_paragraph_position_with_affinity_t sk_paragraph_editor_get_glyph_position_at_coordinate(sk_paragraph_editor_t* editor, float dx, float dy) {
+  return ToParagraphPositionWithAffinity(AsParagraphEditor(editor)->glyph_position_at_coordinate(dx, dy));
+}
+
+size_t sk_paragraph_editor_get_rects_for_range(sk_paragraph_editor_t* editor, size_t start, size_t end, sk_paragraph_rect_height_style_t rect_height_style, sk_paragraph_rect_width_style_t rect_width_style, sk_paragraph_text_box_t boxes[]) {
+  std::vector<skia::textlayout::TextBox> rects = AsParagraphEditor(editor)->rects_for_range(start, end, AsParagraphRectHeightStyle(rect_height_style), AsParagraphRectWidthStyle(rect_width_style));
+  if (boxes != nullptr) {
+    for (size_t i = 0; i < rects.size(); ++i) {
+      boxes[i] = ToParagraphTextBox(rects[i]);
+    }
+  }
+  return rects.size();
+}
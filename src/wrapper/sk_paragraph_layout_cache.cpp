@@ -0,0 +1,46 @@
+#include "wrapper/include/sk_paragraph_layout_cache.h"
+
+#include "wrapper/paragraph_builder_handle.h"
+#include "wrapper/paragraph_layout_cache.h"
+#include "wrapper/sk_types_priv.h"
+
+sk_paragraph_layout_cache_t* sk_paragraph_layout_cache_new(size_t byte_budget) {
+  return ToParagraphLayoutCache(new ParagraphLayoutCache(byte_budget));
+}
+
+void sk_paragraph_layout_cache_delete(sk_paragraph_layout_cache_t* cache) {
+  delete AsParagraphLayoutCache(cache);
+}
+
+sk_paragraph_t* sk_paragraph_layout_cache_build(sk_paragraph_layout_cache_t* cache, const sk_paragraph_builder_t* builder, float width) {
+  const ParagraphRecipe* recipe = AsParagraphBuilderHandle(builder)->recipe();
+  if (!recipe) {
+    return nullptr;
+  }
+  return ToParagraphHandle(AsParagraphLayoutCache(cache)->get(*recipe, width));
+}
+
+size_t sk_paragraph_layout_cache_get_budget(const sk_paragraph_layout_cache_t* cache) {
+  return AsParagraphLayoutCache(cache)->budget();
+}
+
+void sk_paragraph_layout_cache_set_budget(sk_paragraph_layout_cache_t* cache, size_t byte_budget) {
+  AsParagraphLayoutCache(cache)->set_budget(byte_budget);
+}
+
+void sk_paragraph_layout_cache_purge(sk_paragraph_layout_cache_t* cache) {
+  AsParagraphLayoutCache(cache)->purge();
+}
+
+void sk_paragraph_layout_cache_get_stats(const sk_paragraph_layout_cache_t* cache, sk_paragraph_layout_cache_stats_t* stats) {
+  ParagraphLayoutCache::Stats s = AsParagraphLayoutCache(cache)->stats();
+  stats->hits = s.hits;
+  stats->misses = s.misses;
+  stats->evictions = s.evictions;
+  stats->bytes = s.bytes;
+  stats->entry_count = s.entries;
+}
+
+void sk_paragraph_layout_cache_reset_stats(sk_paragraph_layout_cache_t* cache) {
+  AsParagraphLayoutCache(cache)->reset_stats();
+}
@@ -9,8 +9,11 @@
 
 #include "wrapper/include/sk_picture.h"
 
+#include "wrapper/picture_damage.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/worker_pool.h"
 #include "include/core/SkBBHFactory.h"
+#include "include/core/SkCanvas.h"
 #include "include/core/SkDrawable.h"
 #include "include/core/SkPicture.h"
 #include "include/core/SkPictureRecorder.h"
@@ -112,6 +115,42 @@ size_t sk_picture_approximate_bytes_used(const sk_picture_t* picture) {
   return AsPicture(picture)->approximateBytesUsed();
 }
 
+bool sk_picture_playback_tiled(const sk_picture_t* cpicture, const sk_pixmap_t* cpixmap, const sk_matrix_t* cmatrix, int tile_width, int tile_height, int max_threads) {
+  const SkPicture* picture = AsPicture(cpicture);
+  const SkPixmap& pixmap = *AsPixmap(cpixmap);
+  if (tile_width <= 0 || tile_height <= 0 || !pixmap.addr()) {
+    return false;
+  }
+  // Make sure the pixmap is something a raster canvas can draw into before
+  // fanning out, so a failure does not leave some tiles drawn.
+  if (!SkCanvas::MakeRasterDirect(pixmap.info(), pixmap.writable_addr(), pixmap.rowBytes())) {
+    return false;
+  }
+
+  const SkMatrix matrix = cmatrix ? AsMatrix(cmatrix) : SkMatrix::I();
+  const int columns = (pixmap.width() + tile_width - 1) / tile_width;
+  const int rows = (pixmap.height() + tile_height - 1) / tile_height;
+
+  // Every tile draws through a canvas spanning the whole pixmap and is only
+  // limited by its clip. Geometry is therefore rasterized in the same device
+  // space as an untiled playback, and since tiles are disjoint no two threads
+  // ever write the same pixel.
+  WorkerPool::shared().parallel_for(static_cast<size_t>(columns) * rows, max_threads, [&](size_t index) {
+    const int x = static_cast<int>(index % columns) * tile_width;
+    const int y = static_cast<int>(index / columns) * tile_height;
+    auto canvas = SkCanvas::MakeRasterDirect(pixmap.info(), pixmap.writable_addr(), pixmap.rowBytes());
+    canvas->clipIRect(SkIRect::MakeXYWH(x, y, tile_width, tile_height));
+    canvas->concat(matrix);
+    picture->playback(canvas.get());
+  });
+  return true;
+}
+
+void sk_picture_compute_damage(const sk_picture_t* previous, const sk_picture_t* current, const sk_matrix_t* cmatrix, const sk_irect_t* device_bounds, sk_region_t* damage) {
+  const SkMatrix matrix = cmatrix ? AsMatrix(cmatrix) : SkMatrix::I();
+  *AsRegion(damage) = compute_picture_damage(AsPicture(previous), *AsPicture(current), matrix, *AsIRect(device_bounds));
+}
+
 // SkRTreeFactory
 
 sk_rtree_factory_t* sk_rtree_factory_new(void) {
@@ -9,13 +9,18 @@
 
 #include "wrapper/include/sk_pixmap.h"
 
+#include <vector>
+
 #include "include/core/SkPixmap.h"
 #include "include/core/SkSwizzle.h"
 #include "include/core/SkUnPreMultiply.h"
 #include "include/encode/SkJpegEncoder.h"
 #include "include/encode/SkPngEncoder.h"
 #include "include/encode/SkWebpEncoder.h"
+#include "wrapper/pixel_convert.h"
+#include "wrapper/pixmap_compare.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/webp_anim_encoder.h"
 
 // SkPixmap
 
@@ -179,12 +184,39 @@ bool sk_pixmap_erase_color4f(const sk_pixmap_t* cpixmap, const sk_color4f_t* col
   return AsPixmap(cpixmap)->erase(*AsColor4f(color), AsIRect(subset));
 }
 
+bool sk_pixmap_compare(const sk_pixmap_t* a, const sk_pixmap_t* b, int tolerance, const sk_pixmap_compare_options_t* options, sk_pixmap_compare_stats_t* stats, const sk_pixmap_t* diff_mask) {
+  PixmapCompareOptions compare_options;
+  if (options) {
+    compare_options.ignore_alpha = options->fIgnoreAlpha;
+    compare_options.diff_mode = options->fDiffMode == DELTA_SK_PIXMAP_DIFF_MODE ? PixmapDiffMode::kDelta : PixmapDiffMode::kMask;
+  }
+  PixmapCompareStats compare_stats;
+  if (!ComparePixmaps(*AsPixmap(a), *AsPixmap(b), tolerance, compare_options, AsPixmap(diff_mask), &compare_stats)) {
+    return false;
+  }
+  if (stats) {
+    stats->fMaxDelta = compare_stats.max_delta;
+    stats->fDifferentPixels = compare_stats.different_pixels;
+    stats->fBounds = ToIRect(compare_stats.bounds);
+  }
+  return true;
+}
+
 // Sk*Encoder
 
 bool sk_webpencoder_encode(sk_wstream_t* dst, const sk_pixmap_t* src, const sk_webpencoder_options_t* options) {
   return SkWebpEncoder::Encode(AsWStream(dst), *AsPixmap(src), AsWebpEncoderOptions(options));
 }
 
+bool sk_webpencoder_encode_animated(sk_wstream_t* dst, const sk_webpencoder_frame_t frames[], size_t count, const sk_webpencoder_options_t* options) {
+  std::vector<SkEncoder::Frame> skframes;
+  skframes.reserve(count);
+  for (size_t i = 0; i < count; ++i) {
+    skframes.push_back({*AsPixmap(frames[i].fPixmap), frames[i].fDuration});
+  }
+  return SkWebpEncoder::EncodeAnimated(AsWStream(dst), skframes, AsWebpEncoderOptions(options));
+}
+
 bool sk_jpegencoder_encode(sk_wstream_t* dst, const sk_pixmap_t* src, const sk_jpegencoder_options_t* options) {
   return SkJpegEncoder::Encode(AsWStream(dst), *AsPixmap(src), AsJpegEncoderOptions(options));
 }
@@ -193,6 +225,26 @@ bool sk_pngencoder_encode(sk_wstream_t* dst, const sk_pixmap_t* src, const sk_pn
   return SkPngEncoder::Encode(AsWStream(dst), *AsPixmap(src), AsPngEncoderOptions(options));
 }
 
+sk_webp_anim_encoder_t* sk_webp_anim_encoder_new(int width, int height, const sk_webpencoder_options_t* options, int loop_count) {
+  return ToWebpAnimEncoder(WebpAnimEncoder::Make(width, height, AsWebpEncoderOptions(options), loop_count).release());
+}
+
+void sk_webp_anim_encoder_delete(sk_webp_anim_encoder_t* encoder) {
+  delete AsWebpAnimEncoder(encoder);
+}
+
+bool sk_webp_anim_encoder_add_frame(sk_webp_anim_encoder_t* encoder, const sk_pixmap_t* frame, int duration) {
+  return AsWebpAnimEncoder(encoder)->add_frame(*AsPixmap(frame), duration);
+}
+
+int sk_webp_anim_encoder_get_frame_count(const sk_webp_anim_encoder_t* encoder) {
+  return AsWebpAnimEncoder(encoder)->frame_count();
+}
+
+bool sk_webp_anim_encoder_finish(sk_webp_anim_encoder_t* encoder, sk_wstream_t* dst) {
+  return AsWebpAnimEncoder(encoder)->finish(AsWStream(dst));
+}
+
 // SkSwizzle
 
 void sk_swizzle_swap_rb(uint32_t* dest, const uint32_t* src, int count) {
@@ -210,15 +262,11 @@ sk_pmcolor_t sk_color_premultiply(const sk_color_t color) {
 }
 
 void sk_color_unpremultiply_array(const sk_pmcolor_t* pmcolors, int size, sk_color_t* colors) {
-  for (int i = 0; i < size; ++i) {
-    colors[i] = SkUnPreMultiply::PMColorToColor(pmcolors[i]);
-  }
+  UnpremultiplyColors(pmcolors, size, colors);
 }
 
 void sk_color_premultiply_array(const sk_color_t* colors, int size, sk_pmcolor_t* pmcolors) {
-  for (int i = 0; i < size; ++i) {
-    pmcolors[i] = SkPreMultiplyColor(colors[i]);
-  }
+  PremultiplyColors(colors, size, pmcolors);
 }
 
 void sk_color_get_bit_shift(int* a, int* r, int* g, int* b) {
@@ -0,0 +1,47 @@
+#include "wrapper/include/sk_row_encoder.h"
+
+#include "wrapper/row_encoder.h"
+#include "wrapper/sk_types_priv.h"
+#include "wrapper/strip_renderer.h"
+
+sk_row_encoder_t* sk_row_encoder_new_png(sk_wstream_t* dst, int width, int height, bool opaque, const sk_pngencoder_options_t* options) {
+  const SkImageInfo info = SkImageInfo::MakeN32(width, height, opaque ? kOpaque_SkAlphaType : kUnpremul_SkAlphaType);
+  return ToRowEncoder(RowEncoder::MakePng(AsWStream(dst), info, AsPngEncoderOptions(options)).release());
+}
+
+sk_row_encoder_t* sk_row_encoder_new_jpeg(sk_wstream_t* dst, int width, int height, const sk_jpegencoder_options_t* options) {
+  const SkImageInfo info = SkImageInfo::MakeN32(width, height, kOpaque_SkAlphaType);
+  return ToRowEncoder(RowEncoder::MakeJpeg(AsWStream(dst), info, AsJpegEncoderOptions(options)).release());
+}
+
+void sk_row_encoder_delete(sk_row_encoder_t* encoder) {
+  delete AsRowEncoder(encoder);
+}
+
+int sk_row_encoder_get_rows_written(const sk_row_encoder_t* encoder) {
+  return AsRowEncoder(encoder)->rows_written();
+}
+
+bool sk_row_encoder_write_rows(sk_row_encoder_t* encoder, const sk_pixmap_t* rows) {
+  return AsRowEncoder(encoder)->write_rows(*AsPixmap(rows));
+}
+
+bool sk_row_encoder_finish(sk_row_encoder_t* encoder) {
+  return AsRowEncoder(encoder)->finish();
+}
+
+bool sk_picture_render_in_strips(const sk_picture_t* picture, int band_height, sk_color_t background, sk_row_encoder_t* encoder, sk_strip_render_stats_t* cstats) {
+  StripRenderStats stats = {};
+  const bool result = RenderPictureInStrips(*AsPicture(picture), band_height, background, AsRowEncoder(encoder), &stats);
+  if (cstats && encoder) {
+    const RowEncoder* row_encoder = AsRowEncoder(encoder);
+    const double pixels = static_cast<double>(row_encoder->info().width()) * row_encoder->rows_written();
+    cstats->fBandCount = stats.bands;
+    cstats->fRenderNanos = stats.render_nanos;
+    cstats->fEncodeNanos = stats.encode_nanos;
+    cstats->fTotalNanos = stats.total_nanos;
+    cstats->fBandBytes = stats.band_bytes;
+    cstats->fMegapixelsPerSecond = stats.total_nanos > 0 ? pixels * 1e3 / stats.total_nanos : 0;
+  }
+  return result;
+}
@@ -13,4 +13,16 @@ bool sk_run_loop_get_isolate_handle(const void* object, int64_t* handle) {
     return true;
   }
   return false;
+}
+
+void sk_run_loop_flush(int64_t isolate_handle) {
+  RunLoop::flush(isolate_handle);
+}
+
+size_t sk_run_loop_get_pending_destroy_count(int64_t isolate_handle) {
+  return RunLoop::pending_destroy_count(isolate_handle);
+}
+
+void sk_run_loop_shutdown(void* isolate_handle) {
+  RunLoop::shutdown(static_cast<int64_t>(reinterpret_cast<intptr_t>(isolate_handle)));
 }
\ No newline at end of file
@@ -10,6 +10,9 @@
 #include "wrapper/include/sk_shaper.h"
 
 #include "modules/skshaper/include/SkShaper.h"
+#include "wrapper/caching_shaper.h"
+#include "wrapper/shaper_buffer.h"
+#include "wrapper/shaping_cache.h"
 #include "wrapper/sk_types_priv.h"
 
 #ifdef SK_SHAPER_HARFBUZZ_AVAILABLE
@@ -137,6 +140,16 @@ sk_shaper_t* sk_shaper_new_hb_shape_then_wrap(sk_unicode_t* unicode, sk_fontmgr_
 #endif
 }
 
+sk_shaper_t* sk_shaper_new_hb_cached_shape_then_wrap(sk_unicode_t* unicode, sk_fontmgr_t* fallback, sk_shaping_cache_t* cache) {
+#ifdef SK_SHAPER_HARFBUZZ_AVAILABLE
+  sk_sp<SkUnicode> shared_unicode = sk_ref_sp(AsUnicode(unicode));
+  sk_sp<SkFontMgr> font_manager = sk_ref_sp(AsFontMgr(fallback));
+  return ToShaper(new CachingShaper(SkShapers::HB::ShapeDontWrapOrReorder(shared_unicode, font_manager), SkShapers::HB::ShapeThenWrap(shared_unicode, font_manager), font_manager, shared_unicode, sk_ref_sp(AsShapingCache(cache))));
+#else
+  return nullptr;
+#endif
+}
+
 sk_shaper_t* sk_shaper_new_hb_shape_dont_wrap_or_reorder(sk_unicode_t* unicode, sk_fontmgr_t* fallback) {
 #ifdef SK_SHAPER_HARFBUZZ_AVAILABLE
   return ToShaper(SkShapers::HB::ShapeDontWrapOrReorder(sk_ref_sp(AsUnicode(unicode)), sk_ref_sp(AsFontMgr(fallback))).release());
@@ -149,6 +162,7 @@ void sk_shaper_hb_purge_caches(void) {
 #ifdef SK_SHAPER_HARFBUZZ_AVAILABLE
   SkShapers::HB::PurgeCaches();
 #endif
+  ShapingCache::PurgeAll();
 }
 
 // CoreText shaper
@@ -298,3 +312,40 @@ void sk_textblob_builder_run_handler_end_point(sk_textblob_builder_run_handler_t
 void sk_shaper_shape(const sk_shaper_t* shaper, const char* utf8, size_t utf8Bytes, sk_shaper_font_run_iterator_t* fontIterator, sk_shaper_bidi_run_iterator_t* bidiIterator, sk_shaper_script_run_iterator_t* scriptIterator, sk_shaper_language_run_iterator_t* languageIterator, const sk_shaper_feature_t* features, size_t featuresCount, float width, sk_shaper_run_handler_t* handler) {
   AsShaper(shaper)->shape(utf8, utf8Bytes, *AsFontRunIterator(fontIterator), *AsBiDiRunIterator(bidiIterator), *AsScriptRunIterator(scriptIterator), *AsLanguageRunIterator(languageIterator), AsShaperFeature(features), featuresCount, width, AsRunHandler(handler));
 }
+
+// Bulk shaping
+
+sk_shaper_buffer_t* sk_shaper_buffer_new(void) {
+  return ToShaperBuffer(new ShaperBuffer());
+}
+
+void sk_shaper_buffer_delete(sk_shaper_buffer_t* buffer) {
+  delete AsShaperBuffer(buffer);
+}
+
+void sk_shaper_shape_to_buffer(const sk_shaper_t* shaper, const sk_shaper_buffer_text_t texts[], size_t count, sk_shaper_buffer_t* buffer) {
+  ShaperBuffer* result = AsShaperBuffer(buffer);
+  result->clear();
+  for (size_t i = 0; i < count; ++i) {
+    const sk_shaper_buffer_text_t& text = texts[i];
+    result->shape(*AsShaper(shaper), static_cast<uint32_t>(i), text.fUtf8, text.fUtf8Bytes, *AsFont(text.fFont), text.fLeftToRight, text.fWidth);
+  }
+}
+
+void sk_shaper_buffer_get_data(const sk_shaper_buffer_t* buffer, sk_shaper_buffer_data_t* data) {
+  const ShaperBuffer* result = AsShaperBuffer(buffer);
+  data->fGlyphs = result->glyphs().data();
+  data->fPositions = ToPoint(result->positions().data());
+  data->fClusters = result->clusters().data();
+  data->fGlyphCount = result->glyphs().size();
+  data->fRuns = result->runs().data();
+  data->fRunCount = result->runs().size();
+  data->fLines = result->lines().data();
+  data->fLineCount = result->lines().size();
+  data->fFontCount = result->fonts().size();
+}
+
+const sk_font_t* sk_shaper_buffer_get_font(const sk_shaper_buffer_t* buffer, size_t index) {
+  const ShaperBuffer* result = AsShaperBuffer(buffer);
+  return index < result->fonts().size() ? ToFont(&result->fonts()[index]) : nullptr;
+}
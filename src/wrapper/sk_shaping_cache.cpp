@@ -0,0 +1,37 @@
+#include "wrapper/include/sk_shaping_cache.h"
+
+#include "wrapper/shaping_cache.h"
+#include "wrapper/sk_types_priv.h"
+
+sk_shaping_cache_t* sk_shaping_cache_new(size_t byte_budget) {
+  return ToShapingCache(new ShapingCache(byte_budget));
+}
+
+void sk_shaping_cache_delete(sk_shaping_cache_t* cache) {
+  SkSafeUnref(AsShapingCache(cache));
+}
+
+size_t sk_shaping_cache_get_budget(const sk_shaping_cache_t* cache) {
+  return AsShapingCache(cache)->budget();
+}
+
+void sk_shaping_cache_set_budget(sk_shaping_cache_t* cache, size_t byte_budget) {
+  AsShapingCache(cache)->set_budget(byte_budget);
+}
+
+void sk_shaping_cache_purge(sk_shaping_cache_t* cache) {
+  AsShapingCache(cache)->purge();
+}
+
+void sk_shaping_cache_get_stats(const sk_shaping_cache_t* cache, sk_shaping_cache_stats_t* stats) {
+  const ShapingCache::Stats value = AsShapingCache(cache)->stats();
+  stats->fHits = value.hits;
+  stats->fMisses = value.misses;
+  stats->fEvictions = value.evictions;
+  stats->fBytes = value.bytes;
+  stats->fEntryCount = value.entries;
+}
+
+void sk_shaping_cache_reset_stats(sk_shaping_cache_t* cache) {
+  AsShapingCache(cache)->reset_stats();
+}
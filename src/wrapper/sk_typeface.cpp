@@ -10,12 +10,17 @@
 #include "wrapper/include/sk_typeface.h"
 
 #include <memory>
+#include <string>
+#include <vector>
 
 #include "include/core/SkFontMgr.h"
 #include "include/core/SkFontStyle.h"
 #include "include/core/SkStream.h"
 #include "include/core/SkTypeface.h"
+#include "wrapper/font_index.h"
+#include "wrapper/indexed_font_mgr.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/typeface_tables.h"
 
 #ifdef SK_BUILD_FOR_MAC
   #include "include/ports/SkFontMgr_mac_ct.h"
@@ -145,6 +150,22 @@ sk_data_t* sk_typeface_copy_table_data(const sk_typeface_t* typeface, sk_font_ta
   return ToData(AsTypeface(typeface)->copyTableData(tag).release());
 }
 
+sk_data_t* sk_typeface_ref_table_data(const sk_typeface_t* typeface, sk_font_table_tag_t tag, bool* borrowed) {
+  return ToData(RefTypefaceTable(*AsTypeface(typeface), tag, borrowed).release());
+}
+
+size_t sk_typeface_get_table_cache_budget(void) {
+  return GetTypefaceTableCacheBudget();
+}
+
+void sk_typeface_set_table_cache_budget(size_t bytes) {
+  SetTypefaceTableCacheBudget(bytes);
+}
+
+void sk_typeface_purge_table_cache(void) {
+  PurgeTypefaceTableCache();
+}
+
 int sk_typeface_get_units_per_em(const sk_typeface_t* typeface) {
   return AsTypeface(typeface)->getUnitsPerEm();
 }
@@ -273,6 +294,27 @@ sk_fontmgr_t* sk_fontmgr_create_fontconfig(void* config) {
 #endif
 }
 
+sk_fontmgr_t* sk_fontmgr_create_indexed(const char* const directories[], size_t directoryCount, const char* index_path, sk_fontmgr_index_info_t* info) {
+#ifdef SK_BUILD_FOR_UNIX
+  std::unique_ptr<SkFontScanner> scanner = SkFontScanner_Make_FreeType();
+  FontIndex::Info index_info{};
+  std::unique_ptr<FontIndex> index = FontIndex::Make(std::vector<std::string>(directories, directories + directoryCount), index_path, *scanner, &index_info);
+  if (!index) {
+    return nullptr;
+  }
+  if (info) {
+    info->fFileCount = index_info.files;
+    info->fFaceCount = index_info.faces;
+    info->fFamilyCount = index_info.families;
+    info->fRebuilt = index_info.rebuilt;
+    info->fNanos = index_info.nanos;
+  }
+  return ToFontMgr(new IndexedFontMgr(std::move(index), std::move(scanner)));
+#else
+  return nullptr;
+#endif
+}
+
 // font style
 
 sk_fontstyle_t* sk_fontstyle_new(int weight, int width, sk_font_style_slant_t slant) {
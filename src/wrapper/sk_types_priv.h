@@ -161,8 +161,16 @@ DEF_CLASS_MAP(SkTypeface, sk_typeface_t, Typeface)
 DEF_CLASS_MAP(SkVertices, sk_vertices_t, Vertices)
 DEF_CLASS_MAP(SkWStream, sk_wstream_t, WStream)
 
+DEF_CLASS_MAP(AsyncTask, sk_async_task_t, AsyncTask)
+DEF_CLASS_MAP(DecodedImageCache, sk_decoded_image_cache_t, DecodedImageCache)
+DEF_CLASS_MAP(EncodeQueue, sk_encode_queue_t, EncodeQueue)
+DEF_CLASS_MAP(RowEncoder, sk_row_encoder_t, RowEncoder)
+DEF_CLASS_MAP(WebpAnimEncoder, sk_webp_anim_encoder_t, WebpAnimEncoder)
+
 #include "modules/skunicode/include/SkUnicode.h"
 DEF_CLASS_MAP(SkUnicode, sk_unicode_t, Unicode)
+DEF_CLASS_MAP(UnicodeAnalysis, sk_unicode_analysis_t, UnicodeAnalysis)
+DEF_CLASS_MAP(UnicodeAnalysisCache, sk_unicode_analysis_cache_t, UnicodeAnalysisCache)
 
 #include "modules/skshaper/include/SkShaper.h"
 #include "modules/skshaper/include/SkShaper_factory.h"
@@ -176,6 +184,8 @@ DEF_CLASS_MAP_WITH_NS(SkShaper, BiDiRunIterator, sk_shaper_bidi_run_iterator_t,
 DEF_CLASS_MAP_WITH_NS(SkShaper, ScriptRunIterator, sk_shaper_script_run_iterator_t, ScriptRunIterator)
 DEF_CLASS_MAP_WITH_NS(SkShaper, LanguageRunIterator, sk_shaper_language_run_iterator_t, LanguageRunIterator)
 DEF_MAP(SkShaper::Feature, sk_shaper_feature_t, ShaperFeature)
+DEF_CLASS_MAP(ShaperBuffer, sk_shaper_buffer_t, ShaperBuffer)
+DEF_CLASS_MAP(ShapingCache, sk_shaping_cache_t, ShapingCache)
 
 #include "modules/skparagraph/include/FontCollection.h"
 #include "modules/skparagraph/include/Metrics.h"
@@ -187,8 +197,10 @@ DEF_MAP(SkShaper::Feature, sk_shaper_feature_t, ShaperFeature)
 DEF_MAP_WITH_NS(skia::textlayout, Affinity, sk_paragraph_affinity_t, ParagraphAffinity)
 DEF_CLASS_MAP_WITH_NS(skia::textlayout, FontCollection, sk_font_collection_t, FontCollection)
 DEF_MAP_WITH_NS(skia::textlayout, LineMetrics, sk_line_metrics_t, LineMetrics)
-DEF_CLASS_MAP_WITH_NS(skia::textlayout, Paragraph, sk_paragraph_t, Paragraph)
-DEF_CLASS_MAP_WITH_NS(skia::textlayout, ParagraphBuilder, sk_paragraph_builder_t, ParagraphBuilder)
+DEF_CLASS_MAP(ParagraphHandle, sk_paragraph_t, ParagraphHandle)
+DEF_CLASS_MAP(ParagraphBuilderHandle, sk_paragraph_builder_t, ParagraphBuilderHandle)
+DEF_CLASS_MAP(ParagraphEditor, sk_paragraph_editor_t, ParagraphEditor)
+DEF_CLASS_MAP(ParagraphLayoutCache, sk_paragraph_layout_cache_t, ParagraphLayoutCache)
 DEF_CLASS_MAP_WITH_NS(skia::textlayout, ParagraphPainter, sk_paragraph_painter_t, ParagraphPainter)
 DEF_MAP_WITH_NS(skia::textlayout, PlaceholderAlignment, sk_paragraph_placeholder_alignment_t, ParagraphPlaceholderAlignment)
 DEF_MAP_WITH_NS(skia::textlayout::Paragraph, VisitorFlags, sk_paragraph_visitor_flag_t, ParagraphVisitorFlags)
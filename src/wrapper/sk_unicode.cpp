@@ -16,6 +16,8 @@
 #include "modules/skunicode/include/SkUnicode_icu4x.h"
 #include "modules/skunicode/include/SkUnicode_libgrapheme.h"
 #include "wrapper/sk_types_priv.h"
+#include "wrapper/unicode_analysis.h"
+#include "wrapper/unicode_analysis_cache.h"
 
 #ifdef SK_UNICODE_ICU_IMPLEMENTATION
   #ifdef SK_BUILD_FOR_WIN
@@ -132,3 +134,54 @@ bool sk_icu_set_data(void* data) {
   std::call_once(icu_once_flag, sk_icu_set_data_once, data);
   return icu_data_result;
 }
+
+// Batched analysis
+
+sk_unicode_analysis_t* sk_unicode_analysis_new(void) {
+  return ToUnicodeAnalysis(new UnicodeAnalysis());
+}
+
+void sk_unicode_analysis_delete(sk_unicode_analysis_t* analysis) {
+  delete AsUnicodeAnalysis(analysis);
+}
+
+void sk_unicode_analysis_get_data(const sk_unicode_analysis_t* analysis, sk_unicode_analysis_data_t* data) {
+  AsUnicodeAnalysis(analysis)->get_data(data);
+}
+
+bool sk_unicode_analyze(sk_unicode_t* unicode, const sk_unicode_analysis_text_t texts[], size_t count, sk_unicode_analysis_cache_t* cache, int max_threads, sk_unicode_analysis_t* analysis) {
+  return AsUnicodeAnalysis(analysis)->analyze(AsUnicode(unicode), texts, count, AsUnicodeAnalysisCache(cache), max_threads);
+}
+
+sk_unicode_analysis_cache_t* sk_unicode_analysis_cache_new(size_t byte_budget) {
+  return ToUnicodeAnalysisCache(new UnicodeAnalysisCache(byte_budget));
+}
+
+void sk_unicode_analysis_cache_delete(sk_unicode_analysis_cache_t* cache) {
+  delete AsUnicodeAnalysisCache(cache);
+}
+
+size_t sk_unicode_analysis_cache_get_budget(const sk_unicode_analysis_cache_t* cache) {
+  return AsUnicodeAnalysisCache(cache)->budget();
+}
+
+void sk_unicode_analysis_cache_set_budget(sk_unicode_analysis_cache_t* cache, size_t byte_budget) {
+  AsUnicodeAnalysisCache(cache)->set_budget(byte_budget);
+}
+
+void sk_unicode_analysis_cache_purge(sk_unicode_analysis_cache_t* cache) {
+  AsUnicodeAnalysisCache(cache)->purge();
+}
+
+void sk_unicode_analysis_cache_get_stats(const sk_unicode_analysis_cache_t* cache, sk_unicode_analysis_cache_stats_t* stats) {
+  const UnicodeAnalysisCache::Stats value = AsUnicodeAnalysisCache(cache)->stats();
+  stats->fHits = value.hits;
+  stats->fMisses = value.misses;
+  stats->fEvictions = value.evictions;
+  stats->fBytes = value.bytes;
+  stats->fEntryCount = value.entries;
+}
+
+void sk_unicode_analysis_cache_reset_stats(sk_unicode_analysis_cache_t* cache) {
+  AsUnicodeAnalysisCache(cache)->reset_stats();
+}
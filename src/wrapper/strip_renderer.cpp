@@ -0,0 +1,85 @@
+#include "strip_renderer.h"
+
+#include <algorithm>
+#include <chrono>
+
+#include "include/core/SkCanvas.h"
+#include "include/core/SkPicture.h"
+#include "include/core/SkPixmap.h"
+#include "include/core/SkSurface.h"
+#include "row_encoder.h"
+#include "worker_pool.h"
+
+namespace {
+
+uint64_t nanos_since(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+}  // namespace
+
+bool RenderPictureInStrips(const SkPicture& picture, int band_height, SkColor background, RowEncoder* encoder, StripRenderStats* stats) {
+  if (!encoder || band_height <= 0 || encoder->rows_written() != 0) {
+    return false;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  const SkImageInfo& info = encoder->info();
+  band_height = std::min(band_height, info.height());
+  const int band_count = (info.height() + band_height - 1) / band_height;
+
+  const SkImageInfo band_info = SkImageInfo::MakeN32Premul(info.width(), band_height, info.refColorSpace());
+  sk_sp<SkSurface> surfaces[2];
+  for (int i = 0; i < std::min(band_count, 2); ++i) {
+    surfaces[i] = SkSurfaces::Raster(band_info);
+    if (!surfaces[i]) {
+      return false;
+    }
+  }
+
+  uint64_t render_nanos = 0;
+  uint64_t encode_nanos = 0;
+  bool encoded = true;
+  auto render = [&](int band) {
+    const auto render_start = std::chrono::steady_clock::now();
+    SkCanvas* canvas = surfaces[band % 2]->getCanvas();
+    canvas->clear(background);
+    canvas->save();
+    canvas->translate(0, -static_cast<SkScalar>(band) * band_height);
+    canvas->drawPicture(&picture);
+    canvas->restore();
+    render_nanos += nanos_since(render_start);
+  };
+  auto encode = [&](int band) {
+    const auto encode_start = std::chrono::steady_clock::now();
+    SkPixmap pixmap;
+    SkPixmap rows;
+    const int row_count = std::min(band_height, info.height() - band * band_height);
+    encoded = surfaces[band % 2]->peekPixels(&pixmap) && pixmap.extractSubset(&rows, SkIRect::MakeWH(info.width(), row_count)) && encoder->write_rows(rows);
+    encode_nanos += nanos_since(encode_start);
+  };
+
+  // Step i draws band i while band i - 1 is encoded from the other surface.
+  render(0);
+  for (int band = 1; band < band_count && encoded; ++band) {
+    WorkerPool::shared().parallel_for(2, 2, [&](size_t task) {
+      if (task == 0) {
+        render(band);
+      } else {
+        encode(band - 1);
+      }
+    });
+  }
+  if (encoded) {
+    encode(band_count - 1);
+  }
+  encoded = encoded && encoder->finish();
+
+  if (stats) {
+    stats->bands = band_count;
+    stats->render_nanos = render_nanos;
+    stats->encode_nanos = encode_nanos;
+    stats->total_nanos = nanos_since(start);
+    stats->band_bytes = band_info.computeMinByteSize() * std::min(band_count, 2);
+  }
+  return encoded;
+}
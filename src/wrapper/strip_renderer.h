@@ -0,0 +1,28 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "include/core/SkColor.h"
+
+class RowEncoder;
+class SkPicture;
+
+struct StripRenderStats {
+  uint32_t bands;
+  // Time spent drawing and encoding bands. The two overlap, so their sum may
+  // exceed the total.
+  uint64_t render_nanos;
+  uint64_t encode_nanos;
+  uint64_t total_nanos;
+  // The memory held by the band surfaces.
+  size_t band_bytes;
+};
+
+// Draws `picture` into bands of `band_height` rows, cleared to `background`,
+// and passes every band to `encoder`, which is finished once all of its rows
+// are written. The image size is the encoder's. Only two band surfaces exist
+// at a time: the next band is drawn on the worker pool while the previous one
+// is encoded. Pictures recorded with a bounding box hierarchy skip the ops
+// outside each band. `stats` may be null.
+bool RenderPictureInStrips(const SkPicture& picture, int band_height, SkColor background, RowEncoder* encoder, StripRenderStats* stats);
@@ -0,0 +1,170 @@
+#include "typeface_tables.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "include/core/SkStream.h"
+#include "wrapper/lru_cache.h"
+
+namespace {
+
+constexpr size_t kDefaultBudget = 32 * 1024 * 1024;
+
+uint16_t read16(const uint8_t* p) {
+  return static_cast<uint16_t>((p[0] << 8) | p[1]);
+}
+
+uint32_t read32(const uint8_t* p) {
+  return (static_cast<uint32_t>(p[0]) << 24) | (static_cast<uint32_t>(p[1]) << 16) | (static_cast<uint32_t>(p[2]) << 8) | p[3];
+}
+
+// Finds table `tag` of face `ttc_index` in sfnt data. Returns false if the
+// data is not an sfnt font or has no such table.
+bool find_table(const uint8_t* data, size_t size, int ttc_index, SkFontTableTag tag, size_t* offset, size_t* length) {
+  if (size < 12) {
+    return false;
+  }
+  size_t face = 0;
+  if (read32(data) == SkSetFourByteTag('t', 't', 'c', 'f')) {
+    const uint32_t count = read32(data + 8);
+    if (ttc_index < 0 || static_cast<uint32_t>(ttc_index) >= count || 12 + 4 * static_cast<size_t>(ttc_index) + 4 > size) {
+      return false;
+    }
+    face = read32(data + 12 + 4 * ttc_index);
+  } else if (ttc_index != 0) {
+    return false;
+  }
+  if (face > size || size - face < 12) {
+    return false;
+  }
+  const size_t table_count = read16(data + face + 4);
+  if ((size - face - 12) / 16 < table_count) {
+    return false;
+  }
+  for (size_t i = 0; i < table_count; ++i) {
+    const uint8_t* record = data + face + 12 + 16 * i;
+    if (read32(record) != tag) {
+      continue;
+    }
+    const uint32_t table_offset = read32(record + 8);
+    const uint32_t table_length = read32(record + 12);
+    if (table_offset > size || table_length > size - table_offset) {
+      return false;
+    }
+    *offset = table_offset;
+    *length = table_length;
+    return true;
+  }
+  return false;
+}
+
+// Returns the memory backing the typeface, or null if it is not memory based.
+// The result keeps the stream alive.
+sk_sp<SkData> ref_font_data(const SkTypeface& typeface, int* ttc_index) {
+  std::unique_ptr<SkStreamAsset> stream = typeface.openExistingStream(ttc_index);
+  if (!stream || !stream->getMemoryBase()) {
+    return nullptr;
+  }
+  // The stream shares the backing memory, so holding it keeps the view valid.
+  const void* base = stream->getMemoryBase();
+  const size_t length = stream->getLength();
+  SkStreamAsset* owner = stream.release();
+  return SkData::MakeWithProc(base, length, [](const void*, void* context) { delete static_cast<SkStreamAsset*>(context); }, owner);
+}
+
+struct Table {
+  sk_sp<SkData> data;
+  bool borrowed;
+};
+
+// The tables read from one typeface. Borrowed tables are subsets of
+// font_data, so the typeface's cache entry is charged for font_data once and
+// for each copied table as it is added.
+class TypefaceTables : public SkNVRefCnt<TypefaceTables> {
+ public:
+  TypefaceTables(sk_sp<SkData> font_data, int ttc_index) : font_data_(std::move(font_data)), ttc_index_(ttc_index) {}
+
+  size_t font_data_size() const { return font_data_ ? font_data_->size() : 0; }
+
+  // Returns the table, reading it on first use. `copied_bytes` is set to the
+  // size of a copy made by this call, or to zero.
+  Table ref_table(const SkTypeface& typeface, SkFontTableTag tag, size_t* copied_bytes) {
+    *copied_bytes = 0;
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = tables_.find(tag);
+    if (it != tables_.end()) {
+      return it->second;
+    }
+    Table table = {nullptr, false};
+    size_t offset = 0;
+    size_t length = 0;
+    // The stream may describe a different face than the one the typeface
+    // renders, for example after applying font arguments; only trust the
+    // view when it agrees with the typeface.
+    if (font_data_ && find_table(font_data_->bytes(), font_data_->size(), ttc_index_, tag, &offset, &length) && length == typeface.getTableSize(tag)) {
+      table = {SkData::MakeSubset(font_data_.get(), offset, length), true};
+    } else {
+      table = {typeface.copyTableData(tag), false};
+      *copied_bytes = table.data ? table.data->size() : 0;
+    }
+    if (table.data) {
+      tables_.emplace(tag, table);
+    }
+    return table;
+  }
+
+ private:
+  const sk_sp<SkData> font_data_;
+  const int ttc_index_;
+  std::mutex mutex_;
+  std::unordered_map<SkFontTableTag, Table> tables_;
+};
+
+// Keyed by typeface id. Ids are never reused, so the entries of destroyed
+// typefaces are never hit again and age out under the budget. Keeps the
+// newest entry even if it alone exceeds the budget, so that its tables are
+// returned the same on the next query.
+using TableCache = LruCache<SkTypefaceID, sk_sp<TypefaceTables>>;
+
+TableCache& Cache() {
+  // Intentionally leaked so that cached tables are never released during
+  // static destruction.
+  static TableCache* cache = new TableCache(kDefaultBudget, 1);
+  return *cache;
+}
+
+}  // namespace
+
+sk_sp<SkData> RefTypefaceTable(const SkTypeface& typeface, SkFontTableTag tag, bool* borrowed) {
+  const SkTypefaceID id = typeface.uniqueID();
+  sk_sp<TypefaceTables> tables;
+  if (!Cache().find(id, &tables)) {
+    int ttc_index = 0;
+    sk_sp<SkData> font_data = ref_font_data(typeface, &ttc_index);
+    tables = sk_make_sp<TypefaceTables>(std::move(font_data), ttc_index);
+    tables = Cache().insert(id, tables, tables->font_data_size());
+  }
+  size_t copied_bytes = 0;
+  Table table = tables->ref_table(typeface, tag, &copied_bytes);
+  if (copied_bytes) {
+    Cache().add_bytes(id, copied_bytes);
+  }
+  if (borrowed) {
+    *borrowed = table.borrowed;
+  }
+  return std::move(table.data);
+}
+
+size_t GetTypefaceTableCacheBudget() {
+  return Cache().budget();
+}
+
+void SetTypefaceTableCacheBudget(size_t budget) {
+  Cache().set_budget(budget);
+}
+
+void PurgeTypefaceTableCache() {
+  Cache().purge();
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstddef>
+
+#include "include/core/SkData.h"
+#include "include/core/SkRefCnt.h"
+#include "include/core/SkTypeface.h"
+
+// Returns table `tag` of `typeface`, or null if it has no such table.
+//
+// When the typeface was created from data or a memory mapped file, the result
+// points into that memory without copying and keeps it alive; `borrowed` is
+// set to true. Otherwise the table is copied. Either way the result is kept in
+// a process-wide LRU cache, keyed by typeface id and tag, so repeated queries
+// return the same SkData. Safe to call from several threads.
+sk_sp<SkData> RefTypefaceTable(const SkTypeface& typeface, SkFontTableTag tag, bool* borrowed);
+
+// Limits the total size of the cached tables. The borrowed tables of a
+// typeface count the size of its font file once, since they keep its mapping
+// alive.
+size_t GetTypefaceTableCacheBudget();
+void SetTypefaceTableCacheBudget(size_t budget);
+void PurgeTypefaceTableCache();
@@ -0,0 +1,179 @@
+#include "unicode_analysis.h"
+
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include <string>
+
+#include "modules/skunicode/include/SkUnicode.h"
+#include "src/base/SkUTF.h"
+#include "wrapper/unicode_analysis_cache.h"
+#include "wrapper/worker_pool.h"
+
+namespace {
+
+// Enough for the grapheme, line and word iterators of a few locales.
+constexpr size_t kPooledIteratorsPerThread = 8;
+
+struct PooledIterator {
+  sk_sp<SkUnicode> unicode;
+  SkUnicode::BreakType type;
+  std::string locale;
+  std::unique_ptr<SkBreakIterator> iterator;
+};
+
+// Returns a break iterator set to `utf8`, reusing one from the calling
+// thread's pool when possible. Creating an ICU break iterator loads its rules,
+// which costs far more than resetting the text of an existing one.
+SkBreakIterator* PooledBreakIterator(SkUnicode* unicode, SkUnicode::BreakType type, const char* locale, const char* utf8, int length) {
+  // Most recently used last.
+  thread_local std::vector<PooledIterator> pool;
+  const std::string locale_name = locale ? locale : "";
+  auto it = std::find_if(pool.begin(), pool.end(), [&](const PooledIterator& pooled) { return pooled.unicode.get() == unicode && pooled.type == type && pooled.locale == locale_name; });
+  if (it == pool.end()) {
+    std::unique_ptr<SkBreakIterator> iterator = locale ? unicode->makeBreakIterator(locale, type) : unicode->makeBreakIterator(type);
+    if (!iterator) {
+      return nullptr;
+    }
+    if (pool.size() >= kPooledIteratorsPerThread) {
+      pool.erase(pool.begin());
+    }
+    pool.push_back({sk_ref_sp(unicode), type, locale_name, std::move(iterator)});
+  } else {
+    std::rotate(it, it + 1, pool.end());
+  }
+  SkBreakIterator* iterator = pool.back().iterator.get();
+  return iterator->setText(utf8, length) ? iterator : nullptr;
+}
+
+// Sets `flag` at every boundary of the given kind, skipping offset 0 if
+// `skip_start` is set.
+bool MarkBreaks(SkUnicode* unicode, SkUnicode::BreakType type, const char* locale, const char* utf8, int length, uint8_t flag, bool skip_start, std::vector<uint8_t>* flags) {
+  SkBreakIterator* iterator = PooledBreakIterator(unicode, type, locale, utf8, length);
+  if (!iterator) {
+    return false;
+  }
+  for (SkBreakIterator::Position pos = iterator->first(); !iterator->isDone(); pos = iterator->next()) {
+    if (pos >= 0 && pos <= length && (pos > 0 || !skip_start)) {
+      (*flags)[pos] |= flag;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+bool AnalyzeUnicodeText(SkUnicode* unicode, const char* utf8, size_t length, const char* locale, bool left_to_right, UnicodeTextAnalysis* result) {
+  result->flags.assign(length + 1, 0);
+  result->bidi_regions.clear();
+  if (length == 0) {
+    return true;
+  }
+  if (length > INT_MAX) {
+    return false;
+  }
+  const int units = static_cast<int>(length);
+
+  // Character classes, and the offsets right after a hard line break
+  // character, where a line break is mandatory.
+  std::vector<uint8_t>& flags = result->flags;
+  std::vector<bool> after_hard_break(length + 1);
+  const char* ptr = utf8;
+  const char* end = utf8 + length;
+  while (ptr < end) {
+    const char* start = ptr;
+    const SkUnichar c = SkUTF::NextUTF8(&ptr, end);
+    if (c < 0) {
+      return false;
+    }
+    uint8_t bits = 0;
+    if (unicode->isWhitespace(c)) {
+      bits |= WHITESPACE_SK_UNICODE_ANALYSIS_FLAGS;
+    }
+    if (unicode->isControl(c)) {
+      bits |= CONTROL_SK_UNICODE_ANALYSIS_FLAGS;
+    }
+    if (bits) {
+      for (const char* unit = start; unit < ptr; ++unit) {
+        flags[unit - utf8] |= bits;
+      }
+    }
+    after_hard_break[ptr - utf8] = unicode->isHardBreak(c);
+  }
+
+  if (!MarkBreaks(unicode, SkUnicode::BreakType::kGraphemes, nullptr, utf8, units, GRAPHEME_START_SK_UNICODE_ANALYSIS_FLAGS, false, &flags) ||
+      !MarkBreaks(unicode, SkUnicode::BreakType::kLines, nullptr, utf8, units, SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS, true, &flags) ||
+      !MarkBreaks(unicode, SkUnicode::BreakType::kWords, locale, utf8, units, WORD_BREAK_SK_UNICODE_ANALYSIS_FLAGS, false, &flags)) {
+    return false;
+  }
+  // A line break right after a hard break character is a hard one. This
+  // leaves the break between CR and LF alone, since line breaking never
+  // breaks there.
+  for (size_t i = 1; i <= length; ++i) {
+    if (after_hard_break[i] && (flags[i] & SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS)) {
+      flags[i] ^= SOFT_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS | HARD_LINE_BREAK_BEFORE_SK_UNICODE_ANALYSIS_FLAGS;
+    }
+  }
+
+  std::vector<SkUnicode::BidiRegion> regions;
+  if (!unicode->getBidiRegions(utf8, units, left_to_right ? SkUnicode::TextDirection::kLTR : SkUnicode::TextDirection::kRTL, &regions)) {
+    return false;
+  }
+  result->bidi_regions.reserve(regions.size());
+  for (const auto& region : regions) {
+    result->bidi_regions.push_back({static_cast<uint32_t>(region.start), static_cast<uint32_t>(region.end), region.level});
+  }
+  return true;
+}
+
+bool UnicodeAnalysis::analyze(SkUnicode* unicode, const sk_unicode_analysis_text_t texts[], size_t count, UnicodeAnalysisCache* cache, int max_threads) {
+  std::vector<std::shared_ptr<const UnicodeTextAnalysis>> results(count);
+  // Written concurrently, so not a std::vector<bool>.
+  std::vector<uint8_t> cached(count);
+  WorkerPool::shared().parallel_for(count, max_threads, [&](size_t i) {
+    const sk_unicode_analysis_text_t& text = texts[i];
+    UnicodeAnalysisCache::Key key{};
+    if (cache) {
+      key = UnicodeAnalysisCache::MakeKey(text.fUtf8, text.fUtf8Bytes, text.fLocale, text.fLeftToRight);
+      results[i] = cache->find(key);
+      if (results[i]) {
+        cached[i] = 1;
+        return;
+      }
+    }
+    auto analysis = std::make_shared<UnicodeTextAnalysis>();
+    if (!AnalyzeUnicodeText(unicode, text.fUtf8, text.fUtf8Bytes, text.fLocale, text.fLeftToRight, analysis.get())) {
+      return;
+    }
+    if (cache) {
+      cache->insert(key, analysis);
+    }
+    results[i] = std::move(analysis);
+  });
+
+  flags_.clear();
+  bidi_regions_.clear();
+  texts_.clear();
+  bool all_analyzed = true;
+  for (size_t i = 0; i < count; ++i) {
+    const UnicodeTextAnalysis* result = results[i].get();
+    texts_.push_back({static_cast<uint32_t>(flags_.size()), static_cast<uint32_t>(bidi_regions_.size()), result ? static_cast<uint32_t>(result->bidi_regions.size()) : 0, cached[i] != 0});
+    if (result) {
+      flags_.insert(flags_.end(), result->flags.begin(), result->flags.end());
+      bidi_regions_.insert(bidi_regions_.end(), result->bidi_regions.begin(), result->bidi_regions.end());
+    } else {
+      flags_.resize(flags_.size() + texts[i].fUtf8Bytes + 1, 0);
+      all_analyzed = false;
+    }
+  }
+  return all_analyzed;
+}
+
+void UnicodeAnalysis::get_data(sk_unicode_analysis_data_t* data) const {
+  data->fFlags = flags_.data();
+  data->fFlagCount = flags_.size();
+  data->fBidiRegions = bidi_regions_.data();
+  data->fBidiRegionCount = bidi_regions_.size();
+  data->fTexts = texts_.data();
+  data->fTextCount = texts_.size();
+}
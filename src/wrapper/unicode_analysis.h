@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "wrapper/include/sk_unicode.h"
+
+class SkUnicode;
+class UnicodeAnalysisCache;
+
+// Breaks, character classes and bidi regions of one text, see
+// sk_unicode_analysis_flags_t.
+struct UnicodeTextAnalysis {
+  // One entry per UTF-8 code unit plus one for the end of the text.
+  std::vector<uint8_t> flags;
+  std::vector<sk_unicode_bidi_region_t> bidi_regions;
+};
+
+// Analyzes one text with break iterators pooled on the calling thread. Each
+// thread keeps its most recently used iterators, and the SkUnicode that made
+// them, alive for reuse by later calls.
+bool AnalyzeUnicodeText(SkUnicode* unicode, const char* utf8, size_t length, const char* locale, bool left_to_right, UnicodeTextAnalysis* result);
+
+// Flat results of analyzing a batch of texts. analyze() keeps the
+// allocations, so a reused analysis stops allocating once it has grown to fit
+// the largest batch.
+class UnicodeAnalysis {
+ public:
+  bool analyze(SkUnicode* unicode, const sk_unicode_analysis_text_t texts[], size_t count, UnicodeAnalysisCache* cache, int max_threads);
+  void get_data(sk_unicode_analysis_data_t* data) const;
+
+ private:
+  std::vector<uint8_t> flags_;
+  std::vector<sk_unicode_bidi_region_t> bidi_regions_;
+  std::vector<sk_unicode_analysis_text_result_t> texts_;
+};
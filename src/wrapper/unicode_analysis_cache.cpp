@@ -0,0 +1,34 @@
+#include "unicode_analysis_cache.h"
+
+#include "src/core/SkChecksum.h"
+
+namespace {
+
+size_t AnalysisBytes(const UnicodeAnalysisCache::Key& key, const UnicodeTextAnalysis& analysis) {
+  return sizeof(UnicodeAnalysisCache::Key) + key.text.size() + key.locale.size() + sizeof(UnicodeTextAnalysis) + analysis.flags.size() + analysis.bidi_regions.size() * sizeof(sk_unicode_bidi_region_t);
+}
+
+}  // namespace
+
+bool UnicodeAnalysisCache::Key::operator==(const Key& other) const {
+  return hash == other.hash && left_to_right == other.left_to_right && text == other.text && locale == other.locale;
+}
+
+UnicodeAnalysisCache::UnicodeAnalysisCache(size_t budget) : cache_(budget) {}
+
+UnicodeAnalysisCache::Key UnicodeAnalysisCache::MakeKey(const char* utf8, size_t length, const char* locale, bool left_to_right) {
+  Key key{0, std::string(utf8, length), locale ? locale : "", left_to_right};
+  key.hash = SkChecksum::Hash64(key.text.data(), key.text.size(), SkChecksum::Hash64(key.locale.data(), key.locale.size(), left_to_right ? 1 : 2));
+  return key;
+}
+
+std::shared_ptr<const UnicodeTextAnalysis> UnicodeAnalysisCache::find(const Key& key) {
+  std::shared_ptr<const UnicodeTextAnalysis> analysis;
+  cache_.find(key, &analysis);
+  return analysis;
+}
+
+void UnicodeAnalysisCache::insert(const Key& key, std::shared_ptr<const UnicodeTextAnalysis> analysis) {
+  const size_t bytes = AnalysisBytes(key, *analysis);
+  cache_.insert(key, std::move(analysis), bytes);
+}
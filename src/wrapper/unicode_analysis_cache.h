@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "wrapper/lru_cache.h"
+#include "wrapper/unicode_analysis.h"
+
+// LRU cache of UnicodeTextAnalysis results keyed by the text, the locale and
+// the paragraph direction. Lookups hash the text once; entries are evicted
+// least recently used first once their estimated size exceeds the byte
+// budget. Safe to use from several threads.
+class UnicodeAnalysisCache {
+ public:
+  struct Key {
+    uint64_t hash;
+    std::string text;
+    std::string locale;
+    bool left_to_right;
+
+    bool operator==(const Key& other) const;
+  };
+
+  using Stats = LruCacheStats;
+
+  explicit UnicodeAnalysisCache(size_t budget);
+
+  UnicodeAnalysisCache(const UnicodeAnalysisCache&) = delete;
+  UnicodeAnalysisCache& operator=(const UnicodeAnalysisCache&) = delete;
+
+  static Key MakeKey(const char* utf8, size_t length, const char* locale, bool left_to_right);
+
+  // Returns the cached analysis or null, counting a hit or a miss.
+  std::shared_ptr<const UnicodeTextAnalysis> find(const Key& key);
+  void insert(const Key& key, std::shared_ptr<const UnicodeTextAnalysis> analysis);
+
+  size_t budget() const { return cache_.budget(); }
+  // Evicts entries as needed to fit the new budget.
+  void set_budget(size_t budget) { cache_.set_budget(budget); }
+  void purge() { cache_.purge(); }
+
+  Stats stats() const { return cache_.stats(); }
+  void reset_stats() { cache_.reset_stats(); }
+
+ private:
+  struct KeyHash {
+    size_t operator()(const Key& key) const { return static_cast<size_t>(key.hash); }
+  };
+
+  LruCache<Key, std::shared_ptr<const UnicodeTextAnalysis>, KeyHash> cache_;
+};
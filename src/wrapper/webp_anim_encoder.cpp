@@ -0,0 +1,95 @@
+#include "webp_anim_encoder.h"
+
+#include <algorithm>
+
+#include "include/core/SkPixmap.h"
+#include "include/core/SkStream.h"
+#include "webp/encode.h"
+#include "webp/mux.h"
+
+namespace {
+
+// Mirrors the config SkWebpEncoder builds for still images, including its
+// speed/size trade-off: method 3 for lossy frames and the fastest method for
+// lossless ones, where `quality` already sets the effort.
+bool make_config(const SkWebpEncoder::Options& options, WebPConfig* config) {
+  if (!WebPConfigPreset(config, WEBP_PRESET_DEFAULT, std::clamp(options.fQuality, 0.0f, 100.0f))) {
+    return false;
+  }
+  if (options.fCompression == SkWebpEncoder::Compression::kLossy) {
+    config->lossless = 0;
+#ifndef SK_WEBP_ENCODER_USE_DEFAULT_METHOD
+    config->method = 3;
+#endif
+  } else {
+    config->lossless = 1;
+    config->method = 0;
+  }
+  return WebPValidateConfig(config);
+}
+
+}  // namespace
+
+std::unique_ptr<WebpAnimEncoder> WebpAnimEncoder::Make(int width, int height, const SkWebpEncoder::Options& options, int loop_count) {
+  WebPConfig config;
+  WebPAnimEncoderOptions anim_options;
+  if (width <= 0 || height <= 0 || loop_count < 0 || !make_config(options, &config) || !WebPAnimEncoderOptionsInit(&anim_options)) {
+    return nullptr;
+  }
+  anim_options.anim_params.loop_count = loop_count;
+  WebPAnimEncoder* encoder = WebPAnimEncoderNew(width, height, &anim_options);
+  if (!encoder) {
+    return nullptr;
+  }
+  return std::unique_ptr<WebpAnimEncoder>(new WebpAnimEncoder(encoder, options, width, height));
+}
+
+WebpAnimEncoder::WebpAnimEncoder(WebPAnimEncoder* encoder, const SkWebpEncoder::Options& options, int width, int height)
+    : encoder_(encoder),
+      options_(options),
+      frame_info_(SkImageInfo::Make(width, height, kRGBA_8888_SkColorType, kUnpremul_SkAlphaType)),
+      frame_(frame_info_.computeMinByteSize()) {}
+
+WebpAnimEncoder::~WebpAnimEncoder() {
+  WebPAnimEncoderDelete(encoder_);
+}
+
+bool WebpAnimEncoder::add_frame(const SkPixmap& frame, int duration_ms) {
+  if (finished_ || duration_ms < 0 || frame.width() != frame_info_.width() || frame.height() != frame_info_.height()) {
+    return false;
+  }
+  if (!frame.readPixels(frame_info_, frame_.data(), frame_info_.minRowBytes())) {
+    return false;
+  }
+  WebPConfig config;
+  WebPPicture picture;
+  if (!make_config(options_, &config) || !WebPPictureInit(&picture)) {
+    return false;
+  }
+  picture.width = frame_info_.width();
+  picture.height = frame_info_.height();
+  picture.use_argb = 1;
+  const bool added = WebPPictureImportRGBA(&picture, frame_.data(), static_cast<int>(frame_info_.minRowBytes())) && WebPAnimEncoderAdd(encoder_, &picture, timestamp_ms_, &config);
+  WebPPictureFree(&picture);
+  if (added) {
+    timestamp_ms_ += duration_ms;
+    ++frame_count_;
+  }
+  return added;
+}
+
+bool WebpAnimEncoder::finish(SkWStream* dst) {
+  if (finished_ || frame_count_ == 0 || !dst) {
+    return false;
+  }
+  finished_ = true;
+  // A null frame marks the end time of the last frame.
+  if (!WebPAnimEncoderAdd(encoder_, nullptr, timestamp_ms_, nullptr)) {
+    return false;
+  }
+  WebPData data;
+  WebPDataInit(&data);
+  const bool written = WebPAnimEncoderAssemble(encoder_, &data) && dst->write(data.bytes, data.size);
+  WebPDataClear(&data);
+  return written;
+}
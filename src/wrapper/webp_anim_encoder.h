@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "include/core/SkImageInfo.h"
+#include "include/encode/SkWebpEncoder.h"
+
+class SkPixmap;
+class SkWStream;
+struct WebPAnimEncoder;
+
+// Encodes an animated WebP one frame at a time with libwebp's WebPAnimEncoder,
+// which SkWebpEncoder::EncodeAnimated uses as well but only for a span of
+// frames that are all in memory. Each frame is compressed as it is added, so
+// only one frame is ever held uncompressed. The compressed frames are kept
+// until finish(), since the container can only be written once all of them
+// are known.
+class WebpAnimEncoder {
+ public:
+  // `loop_count` 0 loops forever. Returns null for an empty size or options
+  // libwebp rejects.
+  static std::unique_ptr<WebpAnimEncoder> Make(int width, int height, const SkWebpEncoder::Options& options, int loop_count);
+
+  ~WebpAnimEncoder();
+
+  WebpAnimEncoder(const WebpAnimEncoder&) = delete;
+  WebpAnimEncoder& operator=(const WebpAnimEncoder&) = delete;
+
+  int frame_count() const { return frame_count_; }
+
+  // Adds a frame shown for `duration_ms`, converting it from its color and
+  // alpha type. Fails if the frame does not have the animation's size or the
+  // duration is negative, and once finish() has been called.
+  bool add_frame(const SkPixmap& frame, int duration_ms);
+
+  // Writes the animation to `dst`. Fails if no frame was added.
+  bool finish(SkWStream* dst);
+
+ private:
+  WebpAnimEncoder(WebPAnimEncoder* encoder, const SkWebpEncoder::Options& options, int width, int height);
+
+  WebPAnimEncoder* encoder_;
+  SkWebpEncoder::Options options_;
+  SkImageInfo frame_info_;
+  // The current frame in unpremultiplied RGBA, reused for every frame.
+  std::vector<uint8_t> frame_;
+  int frame_count_ = 0;
+  int timestamp_ms_ = 0;
+  bool finished_ = false;
+};
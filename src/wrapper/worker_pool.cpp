@@ -0,0 +1,124 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+WorkerPool& WorkerPool::shared() {
+  // Intentionally leaked so that worker threads are never joined during static
+  // destruction while they may still be running tasks.
+  static WorkerPool* pool = new WorkerPool(std::max(1u, std::thread::hardware_concurrency()));
+  return *pool;
+}
+
+WorkerPool::WorkerPool(size_t thread_count) {
+  threads_.reserve(thread_count);
+  for (size_t i = 0; i < thread_count; ++i) {
+    threads_.emplace_back([this] { run(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  condition_.notify_all();
+  for (auto& thread : threads_) {
+    thread.join();
+  }
+}
+
+void WorkerPool::add(std::function<void()> task) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tasks_.push_back(std::move(task));
+  }
+  condition_.notify_one();
+}
+
+void WorkerPool::run() {
+  for (;;) {
+    std::function<void()> task;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] { return shutdown_ || !tasks_.empty(); });
+      if (tasks_.empty()) {
+        return;
+      }
+      task = std::move(tasks_.front());
+      tasks_.pop_front();
+    }
+    task();
+  }
+}
+
+namespace {
+
+struct ParallelFor {
+  ParallelFor(size_t count, const std::function<void(size_t)>& fn) : count(count), fn(fn) {}
+
+  void drain() {
+    for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)) {
+      fn(i);
+    }
+  }
+
+  const size_t count;
+  const std::function<void(size_t)>& fn;
+  std::atomic<size_t> next{0};
+
+  std::mutex mutex;
+  std::condition_variable condition;
+  int active_helpers = 0;
+  bool closed = false;
+};
+
+}  // namespace
+
+void WorkerPool::parallel_for(size_t count, int max_threads, const std::function<void(size_t)>& fn) {
+  if (count == 0) {
+    return;
+  }
+
+  size_t helpers = std::min(count - 1, thread_count());
+  if (max_threads > 0) {
+    helpers = std::min(helpers, static_cast<size_t>(max_threads - 1));
+  }
+
+  if (helpers == 0) {
+    for (size_t i = 0; i < count; ++i) {
+      fn(i);
+    }
+    return;
+  }
+
+  // Helpers that only get scheduled after the caller has finished all the work
+  // see `closed` and return without touching `fn`. The caller therefore only
+  // waits for helpers that actually started, which keeps nested calls from
+  // worker threads deadlock free.
+  auto state = std::make_shared<ParallelFor>(count, fn);
+  for (size_t i = 0; i < helpers; ++i) {
+    add([state] {
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (state->closed) {
+          return;
+        }
+        ++state->active_helpers;
+      }
+      state->drain();
+      {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        --state->active_helpers;
+      }
+      state->condition.notify_all();
+    });
+  }
+
+  state->drain();
+
+  std::unique_lock<std::mutex> lock(state->mutex);
+  state->closed = true;
+  state->condition.wait(lock, [&] { return state->active_helpers == 0; });
+}
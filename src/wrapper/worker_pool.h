@@ -0,0 +1,44 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fixed-size pool of native worker threads shared by the wrapper for
+// CPU-bound work that does not need to run on a Dart isolate.
+class WorkerPool {
+ public:
+  // Returns the process-wide pool with one thread per hardware thread.
+  static WorkerPool& shared();
+
+  explicit WorkerPool(size_t thread_count);
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool&) = delete;
+  WorkerPool& operator=(const WorkerPool&) = delete;
+
+  size_t thread_count() const { return threads_.size(); }
+
+  // Enqueues the task to be run on one of the worker threads.
+  void add(std::function<void()> task);
+
+  // Calls fn(i) for every i in [0, count) and returns once all calls have
+  // completed. The calling thread participates, so at most max_threads - 1
+  // workers are recruited (max_threads <= 0 means no limit). Indices are
+  // handed out in increasing order but may complete in any order.
+  // It is safe to call this from a worker thread.
+  void parallel_for(size_t count, int max_threads, const std::function<void(size_t)>& fn);
+
+ private:
+  void run();
+
+  std::vector<std::thread> threads_;
+  std::deque<std::function<void()>> tasks_;
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool shutdown_ = false;
+};